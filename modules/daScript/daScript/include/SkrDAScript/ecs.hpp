@@ -0,0 +1,35 @@
+#pragma once
+#include "SkrDAScript/ctx.hpp"
+#include "SkrRT/ecs/dual.h"
+
+namespace skr {
+namespace das {
+
+struct ECSSystemDescriptor
+{
+    // simulated context, worker threads run on clones of it and share its (AOT linked) code
+    Context* context = nullptr;
+    // script function called per chunk as fn(count : int; column0 : T0?; column1 : T1?; ...)
+    // columns follow the parameter order of query, missing optional components are null
+    const char8_t* function = nullptr;
+    dual_query_t* query = nullptr;
+    EIndex batch_size = 256;
+    // clones created up front, more are cloned on demand when all of them are busy
+    uint32_t initial_contexts = 0;
+};
+
+struct SKR_DASCRIPT_API ECSSystem
+{
+    static ECSSystem* Create(const ECSSystemDescriptor& desc) SKR_NOEXCEPT;
+    static void Free(ECSSystem* system) SKR_NOEXCEPT;
+
+    virtual ~ECSSystem() SKR_NOEXCEPT;
+
+    // run the script over every chunk matched by the query on the task workers
+    virtual bool schedule(skr::task::event_t* counter = nullptr) SKR_NOEXCEPT = 0;
+    // run the script over every chunk matched by the query on the calling thread
+    virtual void run() SKR_NOEXCEPT = 0;
+};
+
+} // namespace das
+} // namespace skr
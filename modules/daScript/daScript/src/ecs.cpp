@@ -0,0 +1,121 @@
+#include "types.hpp"
+#include "daScript/simulate/simulate.h"
+
+#include "tracy/Tracy.hpp"
+
+namespace skr {
+namespace das {
+
+ECSSystem::~ECSSystem() SKR_NOEXCEPT
+{
+
+}
+
+ECSSystem* ECSSystem::Create(const ECSSystemDescriptor& desc) SKR_NOEXCEPT
+{
+    SKR_ASSERT(desc.context && desc.function && desc.query);
+    auto Ctx = static_cast<ContextImpl*>(desc.context);
+    auto function = Ctx->ctx.findFunction((const char*)desc.function);
+    if (!function)
+    {
+        SKR_LOG_ERROR(u8"daScript ecs system: function %s not found", (const char*)desc.function);
+        return nullptr;
+    }
+    dual_parameters_t params;
+    dualQ_get(desc.query, nullptr, &params);
+    if (function->debugInfo && function->debugInfo->count != params.length + 1u)
+    {
+        SKR_LOG_ERROR(u8"daScript ecs system: function %s expects %d arguments, query provides %d columns", 
+            (const char*)desc.function, function->debugInfo->count, params.length);
+        return nullptr;
+    }
+    return SkrNew<ECSSystemImpl>(desc, function);
+}
+
+void ECSSystem::Free(ECSSystem* system) SKR_NOEXCEPT
+{
+    SkrDelete(system);
+}
+
+ECSSystemImpl::ECSSystemImpl(const ECSSystemDescriptor& desc, ::das::SimFunction* function) SKR_NOEXCEPT
+    : context(static_cast<ContextImpl*>(desc.context)), function(function), query(desc.query), batchSize(desc.batch_size)
+{
+    dualQ_get(query, nullptr, &params);
+    for (uint32_t i = 0; i < desc.initial_contexts; ++i)
+        contexts.enqueue(SkrNew<ContextImpl>(*context, (uint32_t)::das::ContextCategory::job_clone));
+}
+
+ECSSystemImpl::~ECSSystemImpl() SKR_NOEXCEPT
+{
+    ContextImpl* ctx = nullptr;
+    while (contexts.try_dequeue(ctx))
+        SkrDelete(ctx);
+}
+
+ContextImpl* ECSSystemImpl::acquire_context() SKR_NOEXCEPT
+{
+    ContextImpl* ctx = nullptr;
+    if (contexts.try_dequeue(ctx))
+        return ctx;
+    // every clone is busy, workers never share a context
+    return SkrNew<ContextImpl>(*context, (uint32_t)::das::ContextCategory::job_clone);
+}
+
+void ECSSystemImpl::release_context(ContextImpl* ctx) SKR_NOEXCEPT
+{
+    contexts.enqueue(ctx);
+}
+
+void ECSSystemImpl::process(ContextImpl* ctx, dual_chunk_view_t* view, const dual_type_index_t* localTypes) SKR_NOEXCEPT
+{
+    vec4f args[32];
+    SKR_ASSERT(params.length < 32);
+    args[0] = ::das::cast<int32_t>::from((int32_t)view->count);
+    for (TIndex i = 0; i < params.length; ++i)
+    {
+        void* column = nullptr;
+        if (localTypes && localTypes[i] != dual::kInvalidTypeIndex)
+        {
+            column = params.accesses[i].readonly ? 
+                (void*)dualV_get_owned_ro_local(view, localTypes[i]) : 
+                dualV_get_owned_rw_local(view, localTypes[i]);
+        }
+        else if (!localTypes)
+        {
+            column = params.accesses[i].readonly ? 
+                (void*)dualV_get_owned_ro(view, params.types[i]) : 
+                dualV_get_owned_rw(view, params.types[i]);
+        }
+        args[i + 1] = ::das::cast<void*>::from(column);
+    }
+    // a script exception must not unwind through the job system
+    ctx->ctx.evalWithCatch(function, args);
+    if (auto exception = ctx->ctx.getException())
+        ctx->ctx.to_err(exception);
+}
+
+bool ECSSystemImpl::schedule(skr::task::event_t* counter) SKR_NOEXCEPT
+{
+    ZoneScopedN("DAScriptECSSystem::Schedule");
+    auto callback = +[](void* u, dual_query_t* query, dual_chunk_view_t* view, dual_type_index_t* localTypes, EIndex entityIndex)
+    {
+        ZoneScopedN("DAScriptECSSystem::Chunk");
+        auto self = (ECSSystemImpl*)u;
+        auto ctx = self->acquire_context();
+        self->process(ctx, view, localTypes);
+        self->release_context(ctx);
+    };
+    return dualJ_schedule_ecs(query, batchSize, callback, this, nullptr, nullptr, nullptr, counter);
+}
+
+void ECSSystemImpl::run() SKR_NOEXCEPT
+{
+    ZoneScopedN("DAScriptECSSystem::Run");
+    auto callback = [&](dual_chunk_view_t* view) {
+        process(context, view, nullptr);
+    };
+    dualQ_get_views(query, DUAL_LAMBDA(callback));
+}
+
+} // namespace das
+} // namespace skr
@@ -10,6 +10,8 @@
 #include "SkrDAScript/ctx.hpp"
 #include "SkrDAScript/annotation.hpp"
 #include "SkrDAScript/module.hpp"
+#include "SkrDAScript/ecs.hpp"
+#include "SkrRT/containers/concurrent_queue.h"
 
 namespace skr {
 namespace das {
@@ -81,6 +83,7 @@ struct ScriptContext final : public ::das::Context
 struct ContextImpl : public Context
 {
     ContextImpl(uint32_t stackSize) : ctx(stackSize) {}
+    ContextImpl(ContextImpl& src, uint32_t category) : ctx(src.ctx, category) {}
     ~ContextImpl() SKR_NOEXCEPT {}
     // class ::das::Context* get_context() SKR_NOEXCEPT override { return &ctx; }
 
@@ -91,6 +94,26 @@ struct ContextImpl : public Context
     ScriptContext ctx;
 };
 
+struct ECSSystemImpl : public ECSSystem
+{
+    ECSSystemImpl(const ECSSystemDescriptor& desc, ::das::SimFunction* function) SKR_NOEXCEPT;
+    ~ECSSystemImpl() SKR_NOEXCEPT;
+
+    bool schedule(skr::task::event_t* counter) SKR_NOEXCEPT;
+    void run() SKR_NOEXCEPT;
+
+    ContextImpl* acquire_context() SKR_NOEXCEPT;
+    void release_context(ContextImpl* ctx) SKR_NOEXCEPT;
+    void process(ContextImpl* ctx, dual_chunk_view_t* view, const dual_type_index_t* localTypes) SKR_NOEXCEPT;
+
+    ContextImpl* context = nullptr;
+    ::das::SimFunction* function = nullptr;
+    dual_query_t* query = nullptr;
+    dual_parameters_t params;
+    EIndex batchSize = 0;
+    skr::ConcurrentQueue<ContextImpl*> contexts;
+};
+
 struct StructureAnnotationImpl : public StructureAnnotation
 {
     StructureAnnotationImpl(Library* library, const StructureAnnotationDescriptor& desc) SKR_NOEXCEPT;
@@ -0,0 +1,43 @@
+#pragma once
+#include "SkrGui/framework/element/render_object_element.hpp"
+#include "SkrGui/framework/render_object/virtualized_render_object.hpp"
+
+namespace skr::gui
+{
+// children are built from the layout of the render object, slot index is the item index
+// children leaving the built range are unmounted into a recycle pool and remounted for the next item whose widget can update them
+struct SKR_GUI_API VirtualizedElement : public RenderObjectElement, public IVirtualizedChildManager {
+    SKR_GUI_OBJECT(VirtualizedElement, "83467bd1-bde7-43da-930f-c5f257337a82", RenderObjectElement)
+    using Super = RenderObjectElement;
+    using Super::Super;
+
+    // lifecycle & tree
+    void first_mount(NotNull<Element*> parent, Slot slot) SKR_NOEXCEPT override;
+    void destroy() SKR_NOEXCEPT override;
+    void visit_children(VisitFuncRef visitor) const SKR_NOEXCEPT override;
+
+    // build & update
+    void update(NotNull<Widget*> new_widget) SKR_NOEXCEPT override;
+
+    // child render object ops
+    void add_render_object_child(NotNull<RenderObject*> child, Slot slot) SKR_NOEXCEPT override;
+    void remove_render_object_child(NotNull<RenderObject*> child, Slot slot) SKR_NOEXCEPT override;
+    void move_render_object_child(NotNull<RenderObject*> child, Slot old_slot, Slot new_slot) SKR_NOEXCEPT override;
+
+    // child manager
+    void update_built_range(uint64_t first, uint64_t last) SKR_NOEXCEPT override;
+
+    // getter
+    inline size_t built_count() const SKR_NOEXCEPT { return _children.size(); }
+    inline size_t recycled_count() const SKR_NOEXCEPT { return _recycled_children.size(); }
+
+private:
+    // help functions
+    Element* _build_item(uint64_t index) SKR_NOEXCEPT;
+    void     _recycle_child(NotNull<Element*> child) SKR_NOEXCEPT;
+
+private:
+    Map<uint64_t, Element*> _children          = {};
+    Array<Element*>         _recycled_children = {};
+};
+} // namespace skr::gui
@@ -19,6 +19,7 @@ struct SingleChildRenderObjectWidget;
 struct MultiChildRenderObjectWidget;
 struct LeafRenderObjectWidget;
 struct ProxyWidget;
+struct VirtualizedWidget;
 struct InheritedWidget;
 
 // element
@@ -31,6 +32,7 @@ struct InheritedElement;
 struct ComponentElement;
 struct RenderWindowElement;
 struct RenderNativeWindowElement;
+struct VirtualizedElement;
 
 // render object
 struct RenderObject;
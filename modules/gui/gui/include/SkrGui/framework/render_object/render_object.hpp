@@ -76,8 +76,11 @@ struct SKR_GUI_API RenderObject SKR_GUI_OBJECT_BASE {
     virtual void    apply_paint_transform(NotNull<RenderObject*> child, Matrix4& transform) const SKR_NOEXCEPT;
     virtual Matrix4 get_transform_to(RenderObject* ancestor) const SKR_NOEXCEPT;
 
+    // layout callback
+    // 允许在 perform_layout() 中修改子树 (创建/回收 child)，通常用于虚拟化列表与 Sliver
+    void invoke_layout_callback(FunctionRef<void()> callback) SKR_NOEXCEPT;
+
     // TODO
-    // invoke_layout_callback：用于在 layout 过程中创建 child，通常用于 Sliver
     // layer：repaint_boundary 存储对应 layer 用于局部重绘
     // _paint_with_context：call by PaintingContext
     // handle_event：处理输入事件
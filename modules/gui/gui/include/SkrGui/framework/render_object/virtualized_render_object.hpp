@@ -0,0 +1,22 @@
+#pragma once
+#include "SkrGui/fwd_config.hpp"
+#include "SkrGui/framework/fwd_framework.hpp"
+#include "SkrGui/framework/render_object/render_object.hpp"
+
+namespace skr::gui
+{
+// 虚拟化 render object 在 layout 时才知道哪些 item 可见，通过 child manager 按需构建/回收 child
+struct IVirtualizedChildManager {
+    virtual ~IVirtualizedChildManager() = default;
+
+    // called inside invoke_layout_callback(), after return the render object owns a child for every built item in [first, last)
+    virtual void update_built_range(uint64_t first, uint64_t last) SKR_NOEXCEPT = 0;
+};
+
+struct SKR_GUI_API IVirtualizedRenderObject SKR_GUI_INTERFACE_BASE {
+    SKR_GUI_INTERFACE_ROOT(IVirtualizedRenderObject, "6bc34f6f-ac6d-4cef-8957-06acd52a55ca")
+    virtual ~IVirtualizedRenderObject() = default;
+
+    virtual void set_child_manager(IVirtualizedChildManager* manager) SKR_NOEXCEPT = 0;
+};
+} // namespace skr::gui
@@ -0,0 +1,16 @@
+#pragma once
+#include "SkrGui/framework/widget/render_object_widget.hpp"
+#include "SkrGui/framework/fwd_framework.hpp"
+
+namespace skr::gui
+{
+// children are not listed up front, item_builder is called for the items the render object lays out
+struct SKR_GUI_API VirtualizedWidget : public RenderObjectWidget {
+    SKR_GUI_OBJECT(VirtualizedWidget, "4b47e799-18da-4b23-b90b-95f9395d6263", RenderObjectWidget);
+
+    NotNull<Element*> create_element() SKR_NOEXCEPT override;
+
+    uint64_t                    item_count   = 0;
+    Function<Widget*(uint64_t)> item_builder = {}; // return nullptr to leave the item empty
+};
+} // namespace skr::gui
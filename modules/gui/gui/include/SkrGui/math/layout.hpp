@@ -4,6 +4,7 @@
 #include "SkrGui/math/positional.hpp"
 #include "SkrGui/math/flex_layout.hpp"
 #include "SkrGui/math/stack_layout.hpp"
+#include "SkrGui/math/scroll_layout.hpp"
 
 namespace skr::gui
 {
@@ -0,0 +1,12 @@
+#pragma once
+#include "SkrGui/math/geometry.hpp"
+
+namespace skr::gui
+{
+// 滚动容器的主轴，scroll offset 沿主轴移动
+enum class EScrollAxis : uint8_t
+{
+    Vertical,   // items are laid out from top to bottom
+    Horizontal, // items are laid out from left to right
+};
+} // namespace skr::gui
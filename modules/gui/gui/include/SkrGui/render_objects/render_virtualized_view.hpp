@@ -0,0 +1,85 @@
+#pragma once
+#include "SkrGui/framework/render_object/render_box.hpp"
+#include "SkrGui/framework/render_object/multi_child_render_object.hpp"
+#include "SkrGui/framework/render_object/virtualized_render_object.hpp"
+#include "SkrGui/math/layout.hpp"
+
+namespace skr::gui
+{
+// 固定 item 尺寸的虚拟化列表/网格，item 按 cross_axis_count 一行排布
+// 只有 viewport + cache extent 内的 item 会被构建与布局，只有 viewport 内的 item 会被绘制
+struct SKR_GUI_API RenderVirtualizedView : public RenderBox, public IMultiChildRenderObject, public IVirtualizedRenderObject {
+public:
+    SKR_GUI_OBJECT(RenderVirtualizedView, "98fe8b53-4975-4d4a-a541-95e529e94d6d", RenderBox, IMultiChildRenderObject, IVirtualizedRenderObject);
+    using Super = RenderBox;
+
+    // intrinsic size, only the main axis is known without building items
+    float compute_min_intrinsic_width(float height) const SKR_NOEXCEPT override;
+    float compute_max_intrinsic_width(float height) const SKR_NOEXCEPT override;
+    float compute_min_intrinsic_height(float width) const SKR_NOEXCEPT override;
+    float compute_max_intrinsic_height(float width) const SKR_NOEXCEPT override;
+
+    // dry layout
+    Sizef compute_dry_layout(BoxConstraints constraints) const SKR_NOEXCEPT override;
+
+    // layout
+    void perform_layout() SKR_NOEXCEPT override;
+
+    // paint
+    void paint(NotNull<PaintingContext*> context, Offsetf offset) SKR_NOEXCEPT override;
+
+    // multi child render object, slot index is the item index
+    SKR_GUI_TYPE_ID accept_child_type() const SKR_NOEXCEPT override;
+    void            add_child(NotNull<RenderObject*> child, Slot slot) SKR_NOEXCEPT override;
+    void            remove_child(NotNull<RenderObject*> child, Slot slot) SKR_NOEXCEPT override;
+    void            move_child(NotNull<RenderObject*> child, Slot from, Slot to) SKR_NOEXCEPT override;
+    void            flush_updates() SKR_NOEXCEPT override;
+    void            visit_children(VisitFuncRef visitor) const SKR_NOEXCEPT override;
+
+    // virtualized render object
+    void set_child_manager(IVirtualizedChildManager* manager) SKR_NOEXCEPT override;
+
+    // setter
+    void set_scroll_axis(EScrollAxis value) SKR_NOEXCEPT;
+    void set_item_count(uint64_t value) SKR_NOEXCEPT;
+    void set_item_extent(float value) SKR_NOEXCEPT;
+    void set_cross_axis_count(uint32_t value) SKR_NOEXCEPT;
+    void set_main_axis_spacing(float value) SKR_NOEXCEPT;
+    void set_cross_axis_spacing(float value) SKR_NOEXCEPT;
+    void set_scroll_offset(float value) SKR_NOEXCEPT;
+    void set_cache_extent(float value) SKR_NOEXCEPT;
+
+    // getter, range & max offset are valid after layout
+    inline float    scroll_offset() const SKR_NOEXCEPT { return _scroll_offset; }
+    inline float    max_scroll_offset() const SKR_NOEXCEPT { return _max_scroll_offset; }
+    inline uint64_t first_built_index() const SKR_NOEXCEPT { return _first_built_index; }
+    inline uint64_t last_built_index() const SKR_NOEXCEPT { return _last_built_index; }
+    inline const auto& children() const SKR_NOEXCEPT { return _children; }
+
+    struct SlotData {
+        Offsetf offset = Offsetf::Zero();
+    };
+
+private:
+    friend struct _VirtualizedViewHelper;
+    IVirtualizedChildManager* _child_manager = nullptr;
+
+    EScrollAxis _scroll_axis        = EScrollAxis::Vertical;
+    uint64_t    _item_count         = 0;
+    float       _item_extent        = 0.0f; // main axis extent of each item
+    uint32_t    _cross_axis_count   = 1;
+    float       _main_axis_spacing  = 0.0f;
+    float       _cross_axis_spacing = 0.0f;
+    float       _scroll_offset      = 0.0f;
+    float       _cache_extent       = 250.0f; // built & laid out beyond each side of the viewport, but not painted
+
+    // layout result
+    float    _max_scroll_offset = 0.0f;
+    uint64_t _first_built_index = 0;
+    uint64_t _last_built_index  = 0;
+
+    // sorted by item index after flush_updates()
+    Array<SlotStorage<RenderBox, SlotData>> _children           = {};
+    bool                                    _need_flush_updates = false;
+};
+} // namespace skr::gui
@@ -0,0 +1,22 @@
+#pragma once
+#include "SkrGui/framework/widget/virtualized_widget.hpp"
+#include "SkrGui/math/layout.hpp"
+
+namespace skr::gui
+{
+// rows of cross_axis_count items sharing the cross axis, only the rows near the viewport are built
+struct SKR_GUI_API GridView : public VirtualizedWidget {
+    SKR_GUI_OBJECT(GridView, "7f15eb05-cecf-480d-87ea-9771a42b5375", VirtualizedWidget)
+
+    NotNull<RenderObject*> create_render_object() SKR_NOEXCEPT override;
+    void                   update_render_object(NotNull<IBuildContext*> context, NotNull<RenderObject*> render_object) SKR_NOEXCEPT override;
+
+    EScrollAxis scroll_axis        = EScrollAxis::Vertical;
+    uint32_t    cross_axis_count   = 1;
+    float       item_extent        = 0.0f; // main axis extent, the cross axis is shared evenly
+    float       main_axis_spacing  = 0.0f;
+    float       cross_axis_spacing = 0.0f;
+    float       scroll_offset      = 0.0f;
+    float       cache_extent       = 250.0f;
+};
+} // namespace skr::gui
@@ -0,0 +1,20 @@
+#pragma once
+#include "SkrGui/framework/widget/virtualized_widget.hpp"
+#include "SkrGui/math/layout.hpp"
+
+namespace skr::gui
+{
+// items of item_extent along the scroll axis, only the ones near the viewport are built
+struct SKR_GUI_API ListView : public VirtualizedWidget {
+    SKR_GUI_OBJECT(ListView, "c7d245b3-b8d5-4004-84f3-4deae06dc221", VirtualizedWidget)
+
+    NotNull<RenderObject*> create_render_object() SKR_NOEXCEPT override;
+    void                   update_render_object(NotNull<IBuildContext*> context, NotNull<RenderObject*> render_object) SKR_NOEXCEPT override;
+
+    EScrollAxis scroll_axis   = EScrollAxis::Vertical;
+    float       item_extent   = 0.0f;
+    float       item_spacing  = 0.0f;
+    float       scroll_offset = 0.0f;
+    float       cache_extent  = 250.0f;
+};
+} // namespace skr::gui
@@ -37,7 +37,6 @@ void Element::mount(NotNull<Element*> parent, Slot slot) SKR_NOEXCEPT
             }
         };
         _RecursiveHelper{ make_not_null(_parent->_owner) }(make_not_null(this));
-        this->visit_children(_RecursiveHelper{ make_not_null(_parent->_owner) });
 
         // attach render object when retake
         if (_lifecycle == EElementLifecycle::Unmounted)
@@ -83,7 +82,6 @@ void Element::unmount() SKR_NOEXCEPT
             }
         };
         _RecursiveHelper{}(make_not_null(this));
-        this->visit_children(_RecursiveHelper{});
     }
     _lifecycle = EElementLifecycle::Unmounted;
 }
@@ -428,9 +426,9 @@ void Element::_update_slot_for_child(NotNull<Element*> child, Slot new_slot) SKR
         Slot new_slot;
         void operator()(NotNull<Element*> obj) const SKR_NOEXCEPT
         {
-            obj->_slot = new_slot;
             if (auto render_object = obj->type_cast<RenderObjectElement>())
             {
+                // move with the old slot, then take the new one
                 if (render_object->slot() != new_slot)
                 {
                     render_object->update_slot(new_slot);
@@ -440,9 +438,10 @@ void Element::_update_slot_for_child(NotNull<Element*> child, Slot new_slot) SKR
             {
                 obj->visit_children(_RecursiveHelper{ new_slot });
             }
+            obj->_slot = new_slot;
         }
     };
-    child->visit_children(_RecursiveHelper{ new_slot });
+    _RecursiveHelper{ new_slot }(child);
 }
 void Element::_attach_render_object_children(Slot new_slot) SKR_NOEXCEPT
 {
@@ -461,7 +460,7 @@ void Element::_attach_render_object_children(Slot new_slot) SKR_NOEXCEPT
             obj->_slot = new_slot;
         }
     };
-    visit_children(_RecursiveHelper{ new_slot });
+    _RecursiveHelper{ new_slot }(make_not_null(this));
 }
 void Element::_detach_render_object_children() SKR_NOEXCEPT
 {
@@ -480,6 +479,6 @@ void Element::_detach_render_object_children() SKR_NOEXCEPT
             obj->_slot = Slot::Invalid();
         }
     };
-    visit_children(_RecursiveHelper{});
+    _RecursiveHelper{}(make_not_null(this));
 }
 } // namespace skr::gui
\ No newline at end of file
@@ -46,6 +46,10 @@ void SingleChildRenderObjectElement::remove_render_object_child(NotNull<RenderOb
 }
 void SingleChildRenderObjectElement::move_render_object_child(NotNull<RenderObject*> child, Slot old_slot, Slot new_slot) SKR_NOEXCEPT
 {
-    SKR_UNREACHABLE_CODE()
+    // our child is always built with our own slot (see first_mount & update), so this only runs when we are
+    // moved, e.g. remounted at another index of a virtualized list: update() hands the new slot down and
+    // _update_slot_for_child reports the move of the child render object here.
+    // the render object stays attached as our single child and a single child has no order, so there is
+    // nothing to move, mount state is untouched. a real reparent goes through remove/add instead.
 }
 } // namespace skr::gui
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "SkrGui/framework/element/virtualized_element.hpp"
+#include "SkrGui/framework/widget/virtualized_widget.hpp"
+#include "SkrGui/framework/render_object/multi_child_render_object.hpp"
+#include "SkrGui/framework/render_object/virtualized_render_object.hpp"
+
+namespace skr::gui
+{
+// lifecycle & tree
+void VirtualizedElement::first_mount(NotNull<Element*> parent, Slot slot) SKR_NOEXCEPT
+{
+    Super::first_mount(parent, slot);
+
+    // children are built later, from the first layout of the render object
+    if (auto virtualized_render_object = render_object()->type_cast<IVirtualizedRenderObject>())
+    {
+        virtualized_render_object->set_child_manager(this);
+    }
+    else
+    {
+        SKR_GUI_LOG_ERROR(u8"render object is not IVirtualizedRenderObject");
+    }
+}
+void VirtualizedElement::destroy() SKR_NOEXCEPT
+{
+    if (auto virtualized_render_object = render_object()->type_cast<IVirtualizedRenderObject>())
+    {
+        virtualized_render_object->set_child_manager(nullptr);
+    }
+    for (auto child : _recycled_children)
+    {
+        child->destroy();
+    }
+    _recycled_children.clear();
+    Super::destroy();
+}
+void VirtualizedElement::visit_children(VisitFuncRef visitor) const SKR_NOEXCEPT
+{
+    // recycled children are unmounted, they are not part of the tree
+    for (const auto& pair : _children)
+    {
+        visitor(make_not_null(pair.second));
+    }
+}
+
+// build & update
+void VirtualizedElement::update(NotNull<Widget*> new_widget) SKR_NOEXCEPT
+{
+    Super::update(new_widget);
+
+    // rebuild built items with the new builder, the render object picks the new range on its next layout
+    auto virtualized_widget = widget()->type_cast_fast<VirtualizedWidget>();
+    for (auto it = _children.begin(); it != _children.end();)
+    {
+        Element* child = nullptr;
+        if (it->first < virtualized_widget->item_count && virtualized_widget->item_builder)
+        {
+            child = _update_child(it->second, virtualized_widget->item_builder(it->first), Slot{ it->first });
+        }
+        else
+        {
+            _recycle_child(make_not_null(it->second));
+        }
+
+        if (child)
+        {
+            it->second = child;
+            ++it;
+        }
+        else
+        {
+            _children.erase(it++);
+        }
+    }
+    render_object()->mark_needs_layout();
+}
+
+// child render object ops
+void VirtualizedElement::add_render_object_child(NotNull<RenderObject*> child, Slot slot) SKR_NOEXCEPT
+{
+    auto multi_child_render_object = render_object()->type_cast<IMultiChildRenderObject>();
+    if (!child->type_based_on(multi_child_render_object->accept_child_type()))
+    {
+        SKR_GUI_LOG_ERROR(u8"child type not match");
+    }
+    multi_child_render_object->add_child(child, slot);
+}
+void VirtualizedElement::remove_render_object_child(NotNull<RenderObject*> child, Slot slot) SKR_NOEXCEPT
+{
+    auto multi_child_render_object = render_object()->type_cast<IMultiChildRenderObject>();
+    multi_child_render_object->remove_child(child, slot);
+}
+void VirtualizedElement::move_render_object_child(NotNull<RenderObject*> child, Slot old_slot, Slot new_slot) SKR_NOEXCEPT
+{
+    auto multi_child_render_object = render_object()->type_cast<IMultiChildRenderObject>();
+    multi_child_render_object->move_child(child, old_slot, new_slot);
+}
+
+// child manager
+void VirtualizedElement::update_built_range(uint64_t first, uint64_t last) SKR_NOEXCEPT
+{
+    last = std::min(last, widget()->type_cast_fast<VirtualizedWidget>()->item_count);
+
+    // step 1. park children that left the range, items entering the range reuse them
+    for (auto it = _children.begin(); it != _children.end();)
+    {
+        if (it->first < first || it->first >= last)
+        {
+            _recycle_child(make_not_null(it->second));
+            _children.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // step 2. build items entering the range
+    for (uint64_t index = first; index < last; ++index)
+    {
+        if (_children.find(index) != _children.end()) continue;
+        if (auto child = _build_item(index))
+        {
+            _children.insert_or_assign(index, child);
+        }
+    }
+
+    // step 3. keep at most one range worth of parked children, drop the oldest
+    const size_t max_recycled = std::max<size_t>(_children.size(), 1);
+    if (_recycled_children.size() > max_recycled)
+    {
+        const size_t drop_count = _recycled_children.size() - max_recycled;
+        for (size_t i = 0; i < drop_count; ++i)
+        {
+            _recycled_children[i]->destroy();
+        }
+        _recycled_children.erase(_recycled_children.begin(), _recycled_children.begin() + drop_count);
+    }
+}
+
+// help functions
+Element* VirtualizedElement::_build_item(uint64_t index) SKR_NOEXCEPT
+{
+    auto virtualized_widget = widget()->type_cast_fast<VirtualizedWidget>();
+    if (!virtualized_widget->item_builder) return nullptr;
+    Widget* new_widget = virtualized_widget->item_builder(index);
+    if (!new_widget) return nullptr;
+
+    // remount the latest parked child that can take the widget, its render object subtree is reused as is
+    for (size_t i = _recycled_children.size(); i > 0; --i)
+    {
+        auto child = _recycled_children[i - 1];
+        if (Widget::can_update(make_not_null(child->widget()), make_not_null(new_widget)))
+        {
+            _recycled_children.erase(_recycled_children.begin() + (i - 1));
+            child->mount(make_not_null(this), Slot{ index });
+            if (child->widget() != new_widget)
+            {
+                child->update(make_not_null(new_widget));
+            }
+            return child;
+        }
+    }
+    return _inflate_widget(make_not_null(new_widget), Slot{ index });
+}
+void VirtualizedElement::_recycle_child(NotNull<Element*> child) SKR_NOEXCEPT
+{
+    child->unmount();
+    _recycled_children.push_back(child);
+}
+} // namespace skr::gui
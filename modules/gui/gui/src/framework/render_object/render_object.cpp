@@ -48,7 +48,6 @@ void RenderObject::mount(NotNull<RenderObject*> parent) SKR_NOEXCEPT
             }
         };
         _RecursiveHelper{ make_not_null(_parent->owner()) }(make_not_null(this));
-        this->visit_children(_RecursiveHelper{ make_not_null(_parent->owner()) });
     }
     _lifecycle = ERenderObjectLifecycle::Mounted;
 }
@@ -68,7 +67,7 @@ void RenderObject::unmount() SKR_NOEXCEPT
                 obj->visit_children(_RecursiveHelper{});
             }
         };
-        this->visit_children(_RecursiveHelper{});
+        _RecursiveHelper{}(make_not_null(this));
     }
     _lifecycle = ERenderObjectLifecycle::Unmounted;
 }
@@ -198,6 +197,17 @@ void RenderObject::layout(bool parent_uses_size) SKR_NOEXCEPT
 }
 void RenderObject::perform_resize() SKR_NOEXCEPT {}
 void RenderObject::perform_layout() SKR_NOEXCEPT {}
+void RenderObject::invoke_layout_callback(FunctionRef<void()> callback) SKR_NOEXCEPT
+{
+    if (_doing_this_layout_with_callback)
+    {
+        SKR_GUI_LOG_ERROR(u8"recursive layout callback");
+        return;
+    }
+    _doing_this_layout_with_callback = true;
+    callback();
+    _doing_this_layout_with_callback = false;
+}
 
 // paint process
 void RenderObject::paint(NotNull<PaintingContext*> context, Offsetf offset) SKR_NOEXCEPT {}
@@ -0,0 +1,10 @@
+#include "SkrGui/framework/widget/virtualized_widget.hpp"
+#include "SkrGui/framework/element/virtualized_element.hpp"
+
+namespace skr::gui
+{
+NotNull<Element*> VirtualizedWidget::create_element() SKR_NOEXCEPT
+{
+    return make_not_null(SkrNew<VirtualizedElement>(make_not_null(this)));
+}
+} // namespace skr::gui
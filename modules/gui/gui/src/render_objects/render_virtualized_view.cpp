@@ -0,0 +1,278 @@
+#include "SkrGui/render_objects/render_virtualized_view.hpp"
+#include "SkrGui/framework/painting_context.hpp"
+
+namespace skr::gui
+{
+struct _VirtualizedViewHelper {
+    inline static bool     _is_vertical(const RenderVirtualizedView& self) SKR_NOEXCEPT { return self._scroll_axis == EScrollAxis::Vertical; }
+    inline static uint64_t _cross_count(const RenderVirtualizedView& self) SKR_NOEXCEPT { return std::max<uint64_t>(self._cross_axis_count, 1); }
+    inline static uint64_t _row_count(const RenderVirtualizedView& self) SKR_NOEXCEPT
+    {
+        const uint64_t cross_count = _cross_count(self);
+        return (self._item_count + cross_count - 1) / cross_count;
+    }
+    inline static float _row_extent(const RenderVirtualizedView& self) SKR_NOEXCEPT { return self._item_extent + self._main_axis_spacing; }
+    inline static float _content_extent(const RenderVirtualizedView& self) SKR_NOEXCEPT
+    {
+        const uint64_t row_count = _row_count(self);
+        return row_count ? (float)row_count * self._item_extent + (float)(row_count - 1) * self._main_axis_spacing : 0.0f;
+    }
+
+    inline static Sizef _compute_size(const RenderVirtualizedView& self, const BoxConstraints& constraints) SKR_NOEXCEPT
+    {
+        // unbounded main axis shrinks to the content, which builds every item
+        const float content = _content_extent(self);
+        if (_is_vertical(self))
+        {
+            return constraints.constrain({
+                constraints.has_bounded_width() ? constraints.max_width : constraints.min_width,
+                constraints.has_bounded_height() ? constraints.max_height : content,
+            });
+        }
+        else
+        {
+            return constraints.constrain({
+                constraints.has_bounded_width() ? constraints.max_width : content,
+                constraints.has_bounded_height() ? constraints.max_height : constraints.min_height,
+            });
+        }
+    }
+};
+} // namespace skr::gui
+
+namespace skr::gui
+{
+// intrinsic size
+float RenderVirtualizedView::compute_min_intrinsic_width(float height) const SKR_NOEXCEPT
+{
+    return _VirtualizedViewHelper::_is_vertical(*this) ? 0.0f : _VirtualizedViewHelper::_content_extent(*this);
+}
+float RenderVirtualizedView::compute_max_intrinsic_width(float height) const SKR_NOEXCEPT
+{
+    return _VirtualizedViewHelper::_is_vertical(*this) ? 0.0f : _VirtualizedViewHelper::_content_extent(*this);
+}
+float RenderVirtualizedView::compute_min_intrinsic_height(float width) const SKR_NOEXCEPT
+{
+    return _VirtualizedViewHelper::_is_vertical(*this) ? _VirtualizedViewHelper::_content_extent(*this) : 0.0f;
+}
+float RenderVirtualizedView::compute_max_intrinsic_height(float width) const SKR_NOEXCEPT
+{
+    return _VirtualizedViewHelper::_is_vertical(*this) ? _VirtualizedViewHelper::_content_extent(*this) : 0.0f;
+}
+
+// dry layout
+Sizef RenderVirtualizedView::compute_dry_layout(BoxConstraints constraints) const SKR_NOEXCEPT
+{
+    return _VirtualizedViewHelper::_compute_size(*this, constraints);
+}
+
+// layout
+void RenderVirtualizedView::perform_layout() SKR_NOEXCEPT
+{
+    const bool     vertical    = _VirtualizedViewHelper::_is_vertical(*this);
+    const uint64_t cross_count = _VirtualizedViewHelper::_cross_count(*this);
+    const uint64_t row_count   = _VirtualizedViewHelper::_row_count(*this);
+    const float    row_extent  = _VirtualizedViewHelper::_row_extent(*this);
+
+    set_size(_VirtualizedViewHelper::_compute_size(*this, constraints()));
+    const float viewport_extent = vertical ? size().height : size().width;
+    const float cross_extent    = vertical ? size().width : size().height;
+    _max_scroll_offset          = std::max(0.0f, _VirtualizedViewHelper::_content_extent(*this) - viewport_extent);
+    const float offset          = std::clamp(_scroll_offset, 0.0f, _max_scroll_offset);
+
+    // step 1. find rows touching [offset - cache_extent, offset + viewport + cache_extent)
+    _first_built_index = 0;
+    _last_built_index  = 0;
+    if (row_extent > 0.0f && row_count > 0)
+    {
+        const float    begin     = std::max(0.0f, offset - _cache_extent);
+        const float    end       = offset + viewport_extent + _cache_extent;
+        const uint64_t first_row = std::min<uint64_t>((uint64_t)(begin / row_extent), row_count);
+        const uint64_t last_row  = std::min<uint64_t>((uint64_t)std::ceil(end / row_extent), row_count);
+        _first_built_index       = first_row * cross_count;
+        _last_built_index        = std::min(last_row * cross_count, _item_count);
+    }
+
+    // step 2. build items entering the range and recycle the ones leaving it
+    if (_child_manager)
+    {
+        invoke_layout_callback([this]() {
+            _child_manager->update_built_range(_first_built_index, _last_built_index);
+        });
+    }
+    flush_updates();
+
+    // step 3. layout built items on their cell
+    const float item_cross        = std::max(0.0f, (cross_extent - (float)(cross_count - 1) * _cross_axis_spacing) / (float)cross_count);
+    const auto  child_constraints = BoxConstraints::Tight(vertical ? Sizef{ item_cross, _item_extent } : Sizef{ _item_extent, item_cross });
+    for (auto& slot : _children)
+    {
+        const uint64_t index        = slot.desired_slot.index;
+        const float    main_offset  = (float)(index / cross_count) * row_extent - offset;
+        const float    cross_offset = (float)(index % cross_count) * (item_cross + _cross_axis_spacing);
+        slot.data.offset            = vertical ? Offsetf{ cross_offset, main_offset } : Offsetf{ main_offset, cross_offset };
+        slot.child->set_constraints(child_constraints);
+        slot.child->layout();
+    }
+}
+
+// paint
+void RenderVirtualizedView::paint(NotNull<PaintingContext*> context, Offsetf offset) SKR_NOEXCEPT
+{
+    const Rectf viewport = Rectf::OffsetSize(Offsetf::Zero(), size());
+    for (const auto& slot : _children)
+    {
+        // items in the cache extent are ready for the next scroll but stay off the canvas
+        Rectf child_rect = Rectf::OffsetSize(slot.data.offset, slot.child->size());
+        if (child_rect.overlaps(viewport))
+        {
+            context->paint_child(make_not_null(slot.child), slot.data.offset + offset);
+        }
+    }
+}
+
+// multi child render object
+SKR_GUI_TYPE_ID RenderVirtualizedView::accept_child_type() const SKR_NOEXCEPT
+{
+    return SKR_GUI_TYPE_ID_OF_STATIC(RenderBox);
+}
+void RenderVirtualizedView::add_child(NotNull<RenderObject*> child, Slot slot) SKR_NOEXCEPT
+{
+    _children.emplace_back(slot, child->type_cast_fast<RenderBox>());
+    child->mount(make_not_null(this));
+    _need_flush_updates = true;
+}
+void RenderVirtualizedView::remove_child(NotNull<RenderObject*> child, Slot slot) SKR_NOEXCEPT
+{
+    for (auto& child_slot : _children)
+    {
+        if (child_slot.child == child)
+        {
+            if (child_slot.desired_slot != slot) { SKR_GUI_LOG_ERROR(u8"slot miss match when remove child"); }
+            child_slot.child->unmount();
+            child_slot.child    = nullptr;
+            _need_flush_updates = true;
+            return;
+        }
+    }
+    SKR_GUI_LOG_ERROR(u8"remove child that not belongs to this view");
+}
+void RenderVirtualizedView::move_child(NotNull<RenderObject*> child, Slot from, Slot to) SKR_NOEXCEPT
+{
+    for (auto& child_slot : _children)
+    {
+        if (child_slot.child == child)
+        {
+            if (child_slot.desired_slot != from) { SKR_GUI_LOG_ERROR(u8"slot miss match when move child"); }
+            child_slot.desired_slot = to;
+            _need_flush_updates     = true;
+            return;
+        }
+    }
+    SKR_GUI_LOG_ERROR(u8"move child that not belongs to this view");
+}
+void RenderVirtualizedView::flush_updates() SKR_NOEXCEPT
+{
+    if (_need_flush_updates)
+    {
+        // slots are sparse item indices, only the order is kept
+        _children.erase(
+        std::remove_if(_children.begin(), _children.end(), [](const auto& slot) { return slot.child == nullptr; }),
+        _children.end());
+        std::sort(_children.begin(), _children.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.desired_slot.index < rhs.desired_slot.index;
+        });
+        for (const auto& slot : _children)
+        {
+            slot.child->set_slot(slot.desired_slot);
+        }
+    }
+    _need_flush_updates = false;
+}
+void RenderVirtualizedView::visit_children(VisitFuncRef visitor) const SKR_NOEXCEPT
+{
+    for (const auto& slot : _children)
+    {
+        if (slot.child)
+        {
+            visitor(make_not_null(slot.child));
+        }
+    }
+}
+
+// virtualized render object
+void RenderVirtualizedView::set_child_manager(IVirtualizedChildManager* manager) SKR_NOEXCEPT
+{
+    if (_child_manager != manager)
+    {
+        _child_manager = manager;
+        mark_needs_layout();
+    }
+}
+
+// setter
+void RenderVirtualizedView::set_scroll_axis(EScrollAxis value) SKR_NOEXCEPT
+{
+    if (_scroll_axis != value)
+    {
+        _scroll_axis = value;
+        mark_needs_layout();
+    }
+}
+void RenderVirtualizedView::set_item_count(uint64_t value) SKR_NOEXCEPT
+{
+    if (_item_count != value)
+    {
+        _item_count = value;
+        mark_needs_layout();
+    }
+}
+void RenderVirtualizedView::set_item_extent(float value) SKR_NOEXCEPT
+{
+    if (_item_extent != value)
+    {
+        _item_extent = value;
+        mark_needs_layout();
+    }
+}
+void RenderVirtualizedView::set_cross_axis_count(uint32_t value) SKR_NOEXCEPT
+{
+    if (_cross_axis_count != value)
+    {
+        _cross_axis_count = value;
+        mark_needs_layout();
+    }
+}
+void RenderVirtualizedView::set_main_axis_spacing(float value) SKR_NOEXCEPT
+{
+    if (_main_axis_spacing != value)
+    {
+        _main_axis_spacing = value;
+        mark_needs_layout();
+    }
+}
+void RenderVirtualizedView::set_cross_axis_spacing(float value) SKR_NOEXCEPT
+{
+    if (_cross_axis_spacing != value)
+    {
+        _cross_axis_spacing = value;
+        mark_needs_layout();
+    }
+}
+void RenderVirtualizedView::set_scroll_offset(float value) SKR_NOEXCEPT
+{
+    if (_scroll_offset != value)
+    {
+        _scroll_offset = value;
+        mark_needs_layout();
+    }
+}
+void RenderVirtualizedView::set_cache_extent(float value) SKR_NOEXCEPT
+{
+    if (_cache_extent != value)
+    {
+        _cache_extent = value;
+        mark_needs_layout();
+    }
+}
+} // namespace skr::gui
@@ -0,0 +1,31 @@
+#include "SkrGui/widgets/grid_view.hpp"
+#include "SkrGui/render_objects/render_virtualized_view.hpp"
+
+namespace skr::gui
+{
+NotNull<RenderObject*> GridView::create_render_object() SKR_NOEXCEPT
+{
+    auto result = make_not_null(SkrNew<RenderVirtualizedView>());
+    result->set_scroll_axis(scroll_axis);
+    result->set_item_count(item_count);
+    result->set_item_extent(item_extent);
+    result->set_cross_axis_count(cross_axis_count);
+    result->set_main_axis_spacing(main_axis_spacing);
+    result->set_cross_axis_spacing(cross_axis_spacing);
+    result->set_scroll_offset(scroll_offset);
+    result->set_cache_extent(cache_extent);
+    return result;
+}
+void GridView::update_render_object(NotNull<IBuildContext*> context, NotNull<RenderObject*> render_object) SKR_NOEXCEPT
+{
+    auto view = render_object->type_cast_fast<RenderVirtualizedView>();
+    view->set_scroll_axis(scroll_axis);
+    view->set_item_count(item_count);
+    view->set_item_extent(item_extent);
+    view->set_cross_axis_count(cross_axis_count);
+    view->set_main_axis_spacing(main_axis_spacing);
+    view->set_cross_axis_spacing(cross_axis_spacing);
+    view->set_scroll_offset(scroll_offset);
+    view->set_cache_extent(cache_extent);
+}
+} // namespace skr::gui
@@ -0,0 +1,28 @@
+#include "SkrGui/widgets/list_view.hpp"
+#include "SkrGui/render_objects/render_virtualized_view.hpp"
+
+namespace skr::gui
+{
+NotNull<RenderObject*> ListView::create_render_object() SKR_NOEXCEPT
+{
+    auto result = make_not_null(SkrNew<RenderVirtualizedView>());
+    result->set_scroll_axis(scroll_axis);
+    result->set_item_count(item_count);
+    result->set_item_extent(item_extent);
+    result->set_main_axis_spacing(item_spacing);
+    result->set_scroll_offset(scroll_offset);
+    result->set_cache_extent(cache_extent);
+    return result;
+}
+void ListView::update_render_object(NotNull<IBuildContext*> context, NotNull<RenderObject*> render_object) SKR_NOEXCEPT
+{
+    auto view = render_object->type_cast_fast<RenderVirtualizedView>();
+    view->set_scroll_axis(scroll_axis);
+    view->set_item_count(item_count);
+    view->set_item_extent(item_extent);
+    view->set_cross_axis_count(1);
+    view->set_main_axis_spacing(item_spacing);
+    view->set_scroll_offset(scroll_offset);
+    view->set_cache_extent(cache_extent);
+}
+} // namespace skr::gui
@@ -219,7 +219,8 @@ void SkrImageUploadTask::from_image(const SkrImageData& image)
         data.count                                  = 1;
         data.binding_type                           = CGPU_RESOURCE_TYPE_TEXTURE;
         data.textures                               = &task->_texture_view;
-        cgpux_bind_table_update(task->_bind_table, &data, 1);
+        const CGPUXBindTableSlot color_texture_slot = 0; // index of the name in bind_table_desc.names
+        cgpux_bind_table_update_slots(task->_bind_table, &color_texture_slot, &data, 1);
 
         skr_atomicu32_store_release(&task->_async_is_okey, 1);
     };
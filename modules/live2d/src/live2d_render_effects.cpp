@@ -418,6 +418,8 @@ struct RenderEffectLive2D : public IRenderEffectProcessor {
 
 protected:
     const char8_t* color_texture_name = u8"color_texture";
+    // the bind tables below are made with color_texture_name alone
+    const CGPUXBindTableSlot color_texture_slot = 0;
     void updateTexture(skr_live2d_render_model_id render_model)
     {
         ZoneScopedN("Live2D::updateTexture");
@@ -446,7 +448,7 @@ protected:
                     datas[0].count = 1;
                     datas[0].textures = &texture_view;
                     datas[0].binding_type = CGPU_RESOURCE_TYPE_TEXTURE;
-                    cgpux_bind_table_update(bind_table, datas, 1);
+                    cgpux_bind_table_update_slots(bind_table, &color_texture_slot, datas, 1);
                 }
             }
             {
@@ -468,7 +470,7 @@ protected:
                     datas[0].count = 1;
                     datas[0].textures = &texture_view;
                     datas[0].binding_type = CGPU_RESOURCE_TYPE_TEXTURE;
-                    cgpux_bind_table_update(bind_table, datas, 1);
+                    cgpux_bind_table_update_slots(bind_table, &color_texture_slot, datas, 1);
                 }
             }
         }
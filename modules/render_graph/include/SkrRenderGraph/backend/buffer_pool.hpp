@@ -1,5 +1,6 @@
 #pragma once
 #include "SkrRT/platform/configure.h"
+#include "SkrRenderGraph/rg_config.h"
 #include <SkrRT/containers/hashmap.hpp>
 #include <EASTL/deque.h>
 #include "cgpu/api.h"
@@ -8,7 +9,7 @@ namespace skr
 {
 namespace render_graph
 {
-class BufferPool
+class SKR_RENDER_GRAPH_API BufferPool
 {
 public:
     struct AllocationMark {
@@ -27,6 +28,8 @@ public:
         ECGPUResourceState state;
         AllocationMark mark;
     };
+    // buffers are pooled by power-of-two size class, element layout only matters
+    // when the buffer carries SRV/UAV views
     struct Key {
         const CGPUDeviceId device = nullptr;
         CGPUResourceTypes descriptors = CGPU_RESOURCE_TYPE_NONE;
@@ -36,7 +39,8 @@ public:
         uint64_t first_element = 0;
         uint64_t elemet_count = 0;
         uint64_t element_stride = 0;
-        uint64_t padding = 0;
+        uint32_t size_class = 0;
+        uint32_t padding = 0;
         uint64_t padding1 = 0;
         operator size_t() const;
         struct hasher { inline size_t operator()(const Key& val) const { return (size_t)val; } };
@@ -46,14 +50,34 @@ public:
         Key(CGPUDeviceId device, const CGPUBufferDescriptor& desc);
     };
     friend class RenderGraphBackend;
+    static uint32_t size_class(uint64_t size);
+
     void initialize(CGPUDeviceId device);
     void finalize();
     eastl::pair<CGPUBufferId, ECGPUResourceState> allocate(const CGPUBufferDescriptor& desc, AllocationMark mark, uint64_t min_frame_index);
     void deallocate(const CGPUBufferDescriptor& desc, CGPUBufferId buffer, ECGPUResourceState final_state, AllocationMark mark);
 
+    // free pooled buffers idle for more than max_idle_frames, then the oldest ones until the budget is met.
+    // only buffers last used at or before latest_finished_frame are released.
+    uint32_t trim(uint64_t frame_index, uint64_t latest_finished_frame);
+    uint32_t collect(uint64_t critical_frame, uint32_t with_tags, uint32_t without_tags);
+
+    void set_budget(uint64_t bytes) { budget = bytes; }
+    void set_max_idle_frames(uint64_t frames) { max_idle_frames = frames; }
+    uint64_t get_allocated_bytes() const { return allocated_bytes; }
+    uint64_t get_pooled_bytes() const { return pooled_bytes; }
+    uint64_t get_pooled_count() const { return pooled.size(); }
+
 protected:
+    void release(eastl::deque<PooledBuffer>& queue);
+
     CGPUDeviceId device;
     skr::flat_hash_map<Key, eastl::deque<PooledBuffer>, Key::hasher> buffers;
+    skr::flat_hash_set<CGPUBufferId> pooled;
+    uint64_t allocated_bytes = 0;
+    uint64_t pooled_bytes = 0;
+    uint64_t budget = 0; // 0 means unlimited
+    uint64_t max_idle_frames = RG_POOL_MAX_IDLE_FRAMES;
 };
 } // namespace render_graph
-} // namespace skr
\ No newline at end of file
+} // namespace skr
@@ -95,6 +95,9 @@ protected:
 
     skr::vector<skr::SPtr<IRenderGraphPhase>> phases;
 
+    // graph owning the executors, pools and frame counter, this unless created with share_backend()
+    RenderGraphBackend* backend_owner = this;
+
     ECGPUBackend backend;
     CGPUDeviceId device;
     CGPUQueueId gfx_queue;
@@ -102,6 +105,9 @@ protected:
     TexturePool texture_pool;
     BufferPool buffer_pool;
     TextureViewPool texture_view_pool;
+    uint64_t pool_budget_textures = 0;
+    uint64_t pool_budget_buffers = 0;
+    uint64_t pool_max_idle_frames = RG_POOL_MAX_IDLE_FRAMES;
 };
 } // namespace render_graph
 } // namespace skr
\ No newline at end of file
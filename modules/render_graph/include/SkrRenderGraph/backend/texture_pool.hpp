@@ -1,5 +1,7 @@
 #pragma once
+#include "SkrRenderGraph/rg_config.h"
 #include <SkrRT/containers/hashmap.hpp>
+#include <SkrRT/containers/function_ref.hpp>
 #include <EASTL/deque.h>
 #include "cgpu/api.h"
 
@@ -7,7 +9,7 @@ namespace skr
 {
 namespace render_graph
 {
-class TexturePool
+class SKR_RENDER_GRAPH_API TexturePool
 {
 public:
     struct AllocationMark {
@@ -47,14 +49,32 @@ public:
         Key(CGPUDeviceId device, const CGPUTextureDescriptor& desc);
     };
     friend class RenderGraphBackend;
+    using ReleaseCallback = skr::function_ref<void(CGPUTextureId)>;
     void initialize(CGPUDeviceId device);
     void finalize();
     eastl::pair<CGPUTextureId, ECGPUResourceState> allocate(const CGPUTextureDescriptor& desc, AllocationMark mark);
     void deallocate(const CGPUTextureDescriptor& desc, CGPUTextureId texture, ECGPUResourceState final_state, AllocationMark mark);
 
+    // same policy as BufferPool::trim, on_release runs before each texture is freed (e.g. to drop its views)
+    uint32_t trim(uint64_t frame_index, uint64_t latest_finished_frame, ReleaseCallback on_release);
+    uint32_t collect(uint64_t critical_frame, uint32_t with_tags, uint32_t without_tags, ReleaseCallback on_release);
+
+    void set_budget(uint64_t bytes) { budget = bytes; }
+    void set_max_idle_frames(uint64_t frames) { max_idle_frames = frames; }
+    uint64_t get_allocated_bytes() const { return allocated_bytes; }
+    uint64_t get_pooled_bytes() const { return pooled_bytes; }
+    uint64_t get_pooled_count() const { return pooled.size(); }
+
 protected:
+    void release(eastl::deque<PooledTexture>& queue, ReleaseCallback on_release);
+
     CGPUDeviceId device;
     skr::flat_hash_map<Key, eastl::deque<PooledTexture>, Key::hasher> textures;
+    skr::flat_hash_set<CGPUTextureId> pooled;
+    uint64_t allocated_bytes = 0;
+    uint64_t pooled_bytes = 0;
+    uint64_t budget = 0; // 0 means unlimited
+    uint64_t max_idle_frames = RG_POOL_MAX_IDLE_FRAMES;
 };
 } // namespace render_graph
 } // namespace skr
\ No newline at end of file
@@ -43,6 +43,7 @@ class SKR_RENDER_GRAPH_API RenderGraph
 {
 public:
     friend class RenderGraphViz;
+    friend class RenderGraphPipeline;
     class SKR_RENDER_GRAPH_API RenderGraphBuilder
     {
     public:
@@ -53,9 +54,20 @@ public:
         RenderGraphBuilder& with_device(CGPUDeviceId device) SKR_NOEXCEPT;
         RenderGraphBuilder& with_gfx_queue(CGPUQueueId queue) SKR_NOEXCEPT;
         RenderGraphBuilder& enable_memory_aliasing() SKR_NOEXCEPT;
+        // 0 means unlimited, pooled resources are released oldest first once the budget is exceeded
+        RenderGraphBuilder& with_pool_budget(uint64_t texture_bytes, uint64_t buffer_bytes) SKR_NOEXCEPT;
+        RenderGraphBuilder& with_pool_max_idle_frames(uint64_t frames) SKR_NOEXCEPT;
+        // uses the device, executors, pools and frame counter of graph instead of creating its own,
+        // so another frame can be set up in this graph while graph executes.
+        // both graphs must be executed from the same thread and graph must outlive this one
+        RenderGraphBuilder& share_backend(RenderGraph* graph) SKR_NOEXCEPT;
 
     protected:
+        RenderGraph* shared_backend = nullptr;
         bool memory_aliasing = false;
+        uint64_t pool_budget_textures = 0;
+        uint64_t pool_budget_buffers = 0;
+        uint64_t pool_max_idle_frames = RG_POOL_MAX_IDLE_FRAMES;
         bool no_backend;
         ECGPUBackend api;
         CGPUDeviceId device;
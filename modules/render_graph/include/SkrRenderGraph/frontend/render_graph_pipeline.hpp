@@ -0,0 +1,46 @@
+#pragma once
+#include "SkrRenderGraph/frontend/render_graph.hpp"
+#include "SkrRT/async/async_progress.hpp"
+
+namespace skr
+{
+struct JobQueue;
+namespace render_graph
+{
+// Builds frame N+1 on a worker while frame N executes on the calling thread.
+// Two graphs take turns, the second one shares the backend (device, executors, pools, frame counter)
+// of the first, so only frontend state (nodes, blackboard, phases) is double buffered.
+class SKR_RENDER_GRAPH_API RenderGraphPipeline
+{
+public:
+    using FrameSetupFunction = eastl::function<void(RenderGraph&)>;
+    // setup_queue runs frame setup & compile, the pipeline creates a single thread queue if it is null
+    static RenderGraphPipeline* create(const RenderGraphSetupFunction& setup, skr::JobQueue* setup_queue = nullptr) SKR_NOEXCEPT;
+    static void destroy(RenderGraphPipeline* pipeline) SKR_NOEXCEPT;
+
+    // kicks setup & compile of a new frame on the worker, then executes the frame kicked by the previous call.
+    // setup runs concurrently with the execution of the previous frame, it must not share mutable state with
+    // pass executors. returns the executed frame index, UINT64_MAX when no frame was pending
+    uint64_t execute(const FrameSetupFunction& setup, RenderGraphProfiler* profiler = nullptr) SKR_NOEXCEPT;
+    // waits for the pending frame and executes it, e.g. before a resize or shutdown
+    uint64_t flush(RenderGraphProfiler* profiler = nullptr) SKR_NOEXCEPT;
+
+    // owns the backend, collect garbage through it
+    inline RenderGraph* get_primary() const SKR_NOEXCEPT { return graphs[0]; }
+    inline bool has_pending_frame() const SKR_NOEXCEPT { return pending != nullptr; }
+
+protected:
+    RenderGraph* wait_pending() SKR_NOEXCEPT;
+
+    RenderGraph* graphs[2] = { nullptr, nullptr };
+    // graph that receives the next setup
+    uint32_t next_graph = 0;
+    // index the next executed frame gets
+    uint64_t next_frame = 0;
+    RenderGraph* pending_graph = nullptr;
+    skr::IFuture<bool>* pending = nullptr;
+    skr::JobQueue* setup_queue = nullptr;
+    bool owns_queue = false;
+};
+} // namespace render_graph
+} // namespace skr
@@ -42,4 +42,9 @@
     #endif
 #endif
 
-#define RG_USE_FIXED_VECTOR
\ No newline at end of file
+#define RG_USE_FIXED_VECTOR
+
+// pooled transient resources unused for this many frames are released
+#ifndef RG_POOL_MAX_IDLE_FRAMES
+    #define RG_POOL_MAX_IDLE_FRAMES 120
+#endif
\ No newline at end of file
@@ -155,7 +155,17 @@ RenderGraphBackend::RenderGraphBackend(const RenderGraphBuilder& builder)
     : RenderGraph(builder)    
     , device(builder.device)
     , gfx_queue(builder.gfx_queue)
+    , pool_budget_textures(builder.pool_budget_textures)
+    , pool_budget_buffers(builder.pool_budget_buffers)
+    , pool_max_idle_frames(builder.pool_max_idle_frames)
 {
+    if (auto shared = static_cast<RenderGraphBackend*>(builder.shared_backend))
+    {
+        backend_owner = shared->backend_owner;
+        device = backend_owner->device;
+        gfx_queue = backend_owner->gfx_queue;
+        frame_index = backend_owner->frame_index;
+    }
     phases.emplace_back(
         skr::SPtr<CullPhase>::Create()
     );
@@ -170,7 +180,7 @@ RenderGraph* RenderGraph::create(const RenderGraphSetupFunction& setup) SKR_NOEX
         graph = SkrNew<RenderGraph>(builder);
     else
     {
-        if (!builder.gfx_queue) assert(0 && "not supported!");
+        if (!builder.gfx_queue && !builder.shared_backend) assert(0 && "not supported!");
         graph = SkrNew<RenderGraphBackend>(builder);
     }
     graph->initialize();
@@ -187,13 +197,20 @@ void RenderGraphBackend::initialize() SKR_NOEXCEPT
 {
     RenderGraph::initialize();
     backend = device->adapter->instance->backend;
-    for (uint32_t i = 0; i < RG_MAX_FRAME_IN_FLIGHT; i++)
+    if (backend_owner == this)
     {
-        executors[i].initialize(gfx_queue, device);
+        for (uint32_t i = 0; i < RG_MAX_FRAME_IN_FLIGHT; i++)
+        {
+            executors[i].initialize(gfx_queue, device);
+        }
+        buffer_pool.initialize(device);
+        buffer_pool.set_budget(pool_budget_buffers);
+        buffer_pool.set_max_idle_frames(pool_max_idle_frames);
+        texture_pool.initialize(device);
+        texture_pool.set_budget(pool_budget_textures);
+        texture_pool.set_max_idle_frames(pool_max_idle_frames);
+        texture_view_pool.initialize(device);
     }
-    buffer_pool.initialize(device);
-    texture_pool.initialize(device);
-    texture_view_pool.initialize(device);
 
     for (auto& phase : phases)
         phase->on_initialize(this);
@@ -202,13 +219,16 @@ void RenderGraphBackend::initialize() SKR_NOEXCEPT
 void RenderGraphBackend::finalize() SKR_NOEXCEPT
 {
     RenderGraph::finalize();
-    for (uint32_t i = 0; i < RG_MAX_FRAME_IN_FLIGHT; i++)
+    if (backend_owner == this)
     {
-        executors[i].finalize();
+        for (uint32_t i = 0; i < RG_MAX_FRAME_IN_FLIGHT; i++)
+        {
+            executors[i].finalize();
+        }
+        buffer_pool.finalize();
+        texture_pool.finalize();
+        texture_view_pool.finalize();
     }
-    buffer_pool.finalize();
-    texture_pool.finalize();
-    texture_view_pool.finalize();
     
     for (auto& phase : phases)
         phase->on_finalize(this);
@@ -248,7 +268,7 @@ uint64_t RenderGraphBackend::get_latest_finished_frame() SKR_NOEXCEPT
     if (frame_index < RG_MAX_FRAME_IN_FLIGHT) return 0;
 
     uint64_t result = frame_index - RG_MAX_FRAME_IN_FLIGHT;
-    for (auto&& executor : executors)
+    for (auto&& executor : backend_owner->executors)
     {
         if (!executor.exec_fence) continue;
         if (cgpu_query_fence_status(executor.exec_fence) == CGPU_FENCE_STATUS_COMPLETE)
@@ -271,7 +291,7 @@ CGPUTextureId RenderGraphBackend::resolve(RenderGraphFrameExecutor& executor, co
         }
         else
         {
-            auto allocated = texture_pool.allocate(node.descriptor, { frame_index, node.tags });
+            auto allocated = backend_owner->texture_pool.allocate(node.descriptor, { frame_index, node.tags });
             node.frame_texture = node.imported ? node.frame_texture : allocated.first;
             node.init_state = allocated.second;
         }
@@ -285,7 +305,7 @@ CGPUBufferId RenderGraphBackend::resolve(RenderGraphFrameExecutor& executor, con
     if (!node.frame_buffer)
     {
         uint64_t latest_frame = (node.tags & kRenderGraphDynamicResourceTag) ? get_latest_finished_frame() : UINT64_MAX;
-        auto allocated = buffer_pool.allocate(node.descriptor, { frame_index, node.tags }, latest_frame);
+        auto allocated = backend_owner->buffer_pool.allocate(node.descriptor, { frame_index, node.tags }, latest_frame);
         node.frame_buffer = node.imported ? node.frame_buffer : allocated.first;
         node.init_state = allocated.second;
     }
@@ -440,7 +460,7 @@ CGPUXBindTableId RenderGraphBackend::alloc_update_pass_bind_table(RenderGraphFra
                     CGPU_TVA_COLOR;
                 view_desc.usages = CGPU_TVU_SRV;
                 view_desc.dims = read_edge->get_dimension();
-                srvs[e_idx] = texture_view_pool.allocate(view_desc, frame_index);
+                srvs[e_idx] = backend_owner->texture_view_pool.allocate(view_desc, frame_index);
                 update.textures = &srvs[e_idx];
                 desc_set_updates.emplace_back(update);
             }
@@ -473,14 +493,18 @@ CGPUXBindTableId RenderGraphBackend::alloc_update_pass_bind_table(RenderGraphFra
                 view_desc.format = view_desc.texture->info->format;
                 view_desc.usages = CGPU_TVU_UAV;
                 view_desc.dims = CGPU_TEX_DIMENSION_2D;
-                uavs[e_idx] = texture_view_pool.allocate(view_desc, frame_index);
+                uavs[e_idx] = backend_owner->texture_view_pool.allocate(view_desc, frame_index);
                 update.textures = &uavs[e_idx];
                 desc_set_updates.emplace_back(update);
             }
         }
     }
     auto bind_table = executor.bind_table_pools[root_sig]->pop(bind_table_keys.u8_str(), bindTableValueNames.data(), (uint32_t)bindTableValueNames.size());
-    cgpux_bind_table_update(bind_table, desc_set_updates.data(), (uint32_t)desc_set_updates.size());
+    // the table is keyed by these names in this order, so update i goes to slot i
+    stack_vector<CGPUXBindTableSlot> desc_set_slots(desc_set_updates.size());
+    for (uint32_t i = 0; i < desc_set_slots.size(); i++)
+        desc_set_slots[i] = i;
+    cgpux_bind_table_update_slots(bind_table, desc_set_slots.data(), desc_set_updates.data(), (uint32_t)desc_set_updates.size());
     return bind_table;
 }
 
@@ -504,7 +528,7 @@ void RenderGraphBackend::deallocate_resources(PassNode* pass) SKR_NOEXCEPT
             {
                 ZoneScopedN("VirtualDeallocate::TextureFromPool");
 
-                texture_pool.deallocate(texture->descriptor, texture->frame_texture,
+                backend_owner->texture_pool.deallocate(texture->descriptor, texture->frame_texture,
                     edge->requested_state, { frame_index, texture->tags });
             }
         }
@@ -524,7 +548,7 @@ void RenderGraphBackend::deallocate_resources(PassNode* pass) SKR_NOEXCEPT
         {
             ZoneScopedN("VirtualDeallocate::BufferFromPool");
 
-            buffer_pool.deallocate(buffer->descriptor, buffer->frame_buffer,
+            backend_owner->buffer_pool.deallocate(buffer->descriptor, buffer->frame_buffer,
                 edge->requested_state, { frame_index, buffer->tags });
         }
     });
@@ -681,7 +705,7 @@ void RenderGraphBackend::execute_render_pass(RenderGraphFrameExecutor& executor,
             {
                 view_desc.dims = CGPU_TEX_DIMENSION_2DMS;
             }
-            ds_attachment.view = texture_view_pool.allocate(view_desc, frame_index);
+            ds_attachment.view = backend_owner->texture_view_pool.allocate(view_desc, frame_index);
             ds_attachment.depth_load_action = pass->depth_load_action;
             ds_attachment.depth_store_action = pass->depth_store_action;
             ds_attachment.stencil_load_action = pass->stencil_load_action;
@@ -705,7 +729,7 @@ void RenderGraphBackend::execute_render_pass(RenderGraphFrameExecutor& executor,
                 view_desc.aspects = CGPU_TVA_COLOR;
                 view_desc.usages = CGPU_TVU_RTV_DSV;
                 view_desc.dims = CGPU_TEX_DIMENSION_2D;
-                attachment.resolve_view = texture_view_pool.allocate(view_desc, frame_index);
+                attachment.resolve_view = backend_owner->texture_view_pool.allocate(view_desc, frame_index);
             }
             // allocate target view
             {
@@ -726,7 +750,7 @@ void RenderGraphBackend::execute_render_pass(RenderGraphFrameExecutor& executor,
                 {
                     view_desc.dims = CGPU_TEX_DIMENSION_2DMS;
                 }
-                attachment.view = texture_view_pool.allocate(view_desc, frame_index);
+                attachment.view = backend_owner->texture_view_pool.allocate(view_desc, frame_index);
             }
             attachment.load_action = pass->load_actions[write_edge->mrt_index];
             attachment.store_action = pass->store_actions[write_edge->mrt_index];
@@ -906,16 +930,18 @@ void RenderGraphBackend::execute_present_pass(RenderGraphFrameExecutor& executor
 
 uint64_t RenderGraphBackend::execute(RenderGraphProfiler* profiler) SKR_NOEXCEPT
 {
+    // graphs sharing a backend take turns on one frame timeline
+    frame_index = backend_owner->frame_index;
     for (auto& phase : phases)
         phase->on_execute(this, profiler);
 
     const auto executor_index = frame_index % RG_MAX_FRAME_IN_FLIGHT;
-    RenderGraphFrameExecutor& executor = executors[executor_index];
+    RenderGraphFrameExecutor& executor = backend_owner->executors[executor_index];
     if (device->is_lost)
     {
         for (uint32_t i = 0; i < RG_MAX_FRAME_IN_FLIGHT; i++)
         {
-            executors[i].print_error_trace(frame_index);
+            backend_owner->executors[i].print_error_trace(frame_index);
         }
         SKR_BREAK();
     }
@@ -926,7 +952,7 @@ uint64_t RenderGraphBackend::execute(RenderGraphProfiler* profiler) SKR_NOEXCEPT
     }
     {
         ZoneScopedN("GraphExecutePasses");
-        executor.reset_begin(texture_view_pool);
+        executor.reset_begin(backend_owner->texture_view_pool);
         if (profiler) profiler->on_cmd_begin(*this, executor);
         {
             ZoneScopedN("GraphExecutorBeginEvent");
@@ -1005,7 +1031,16 @@ uint64_t RenderGraphBackend::execute(RenderGraphProfiler* profiler) SKR_NOEXCEPT
         graph->clear();
         blackboard->clear();
     }
-    return frame_index++;
+    {
+        ZoneScopedN("TrimPools");
+        const auto latest_finished = get_latest_finished_frame();
+        backend_owner->texture_pool.trim(frame_index, latest_finished, 
+            [this](CGPUTextureId texture) { backend_owner->texture_view_pool.erase(texture); });
+        backend_owner->buffer_pool.trim(frame_index, latest_finished);
+    }
+    const auto executed = frame_index++;
+    backend_owner->frame_index = frame_index;
+    return executed;
 }
 
 inline static bool aliasing_capacity(TextureNode* aliased, TextureNode* aliasing) SKR_NOEXCEPT
@@ -1092,29 +1127,8 @@ uint32_t RenderGraphBackend::collect_texture_garbage(uint64_t critical_frame, ui
         SKR_LOG_ERROR(u8"undone frame on GPU detected, collect texture garbage may cause GPU Crash!!"
                       "\n\tcurrent: %d, latest finished: %d", critical_frame, get_latest_finished_frame());
     }
-    uint32_t total_count = 0;
-    for (auto&& [key, queue] : texture_pool.textures)
-    {
-        for (auto&& pooled: queue)
-        {
-            if (pooled.mark.frame_index <= critical_frame 
-                && (pooled.mark.tags & with_tags) && !(pooled.mark.tags & without_tags))
-            {
-                texture_view_pool.erase(pooled.texture);
-                cgpu_free_texture(pooled.texture);
-                pooled.texture = nullptr;
-            }
-        }
-        uint32_t prev_count = (uint32_t)queue.size();
-        queue.erase(
-            eastl::remove_if(queue.begin(), queue.end(),
-            [&](auto& element) {
-                return element.texture == nullptr;
-            }),
-            queue.end());
-        total_count += prev_count - (uint32_t)queue.size();
-    }
-    return total_count;
+    return backend_owner->texture_pool.collect(critical_frame, with_tags, without_tags, 
+        [this](CGPUTextureId texture) { backend_owner->texture_view_pool.erase(texture); });
 }
 
 uint32_t RenderGraphBackend::collect_buffer_garbage(uint64_t critical_frame, uint32_t with_tags, uint32_t without_tags) SKR_NOEXCEPT
@@ -1127,28 +1141,7 @@ uint32_t RenderGraphBackend::collect_buffer_garbage(uint64_t critical_frame, uin
         SKR_LOG_ERROR(u8"undone frame on GPU detected, collect buffer garbage may cause GPU Crash!!"
                       "\n\tcurrent: %d, latest finished: %d", critical_frame, get_latest_finished_frame());
     }
-    uint32_t total_count = 0;
-    for (auto&& [key, queue] : buffer_pool.buffers)
-    {
-        for (auto&& pooled : queue)
-        {
-            if (pooled.mark.frame_index <= critical_frame 
-                && (pooled.mark.tags & with_tags) && !(pooled.mark.tags & without_tags))
-            {
-                cgpu_free_buffer(pooled.buffer);
-                pooled.buffer = nullptr;
-            }
-        }
-        uint32_t prev_count = (uint32_t)queue.size();
-        queue.erase(
-            eastl::remove_if(queue.begin(), queue.end(),
-                [&](auto& element) {
-                    return element.buffer == nullptr;
-                }),
-                queue.end());
-        total_count += prev_count - (uint32_t)queue.size();
-    }
-    return total_count;
+    return backend_owner->buffer_pool.collect(critical_frame, with_tags, without_tags);
 }
 } // namespace render_graph
 } // namespace skr
\ No newline at end of file
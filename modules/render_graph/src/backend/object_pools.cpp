@@ -189,6 +189,9 @@ void TexturePool::finalize()
             queue.second.pop_front();
         }
     }
+    textures.clear();
+    pooled.clear();
+    allocated_bytes = pooled_bytes = 0;
 }
 
 eastl::pair<CGPUTextureId, ECGPUResourceState> TexturePool::allocate(const CGPUTextureDescriptor& desc, AllocationMark mark)
@@ -197,25 +200,101 @@ eastl::pair<CGPUTextureId, ECGPUResourceState> TexturePool::allocate(const CGPUT
         nullptr, CGPU_RESOURCE_STATE_UNDEFINED
     };
     auto key = make_zeroed<TexturePool::Key>(device, desc);
-    if (textures[key].empty())
+    auto& queue = textures[key];
+    if (queue.empty())
     {
         auto new_tex = cgpu_create_texture(device, &desc);
-        textures[key].emplace_back(new_tex, desc.start_state, mark);
+        allocated_bytes += new_tex->info->size_in_bytes;
+        return { new_tex, desc.start_state };
     }
-    textures[key].front().mark = mark;
-    allocated = { textures[key].front().texture, textures[key].front().state };
-    textures[key].pop_front();
+    allocated = { queue.front().texture, queue.front().state };
+    pooled_bytes -= allocated.first->info->size_in_bytes;
+    pooled.erase(allocated.first);
+    queue.pop_front();
     return allocated;
 }
 
 void TexturePool::deallocate(const CGPUTextureDescriptor& desc, CGPUTextureId texture, ECGPUResourceState final_state, AllocationMark mark)
 {
+    if (!pooled.emplace(texture).second) 
+        return;
     auto key = make_zeroed<TexturePool::Key>(device, desc);
-    for (auto&& iter : textures[key])
+    textures[key].emplace_back(texture, final_state, mark);
+    pooled_bytes += texture->info->size_in_bytes;
+}
+
+void TexturePool::release(eastl::deque<PooledTexture>& queue, ReleaseCallback on_release)
+{
+    auto texture = queue.front().texture;
+    const auto size = texture->info->size_in_bytes;
+    pooled_bytes -= size;
+    allocated_bytes -= size;
+    pooled.erase(texture);
+    queue.pop_front();
+    on_release(texture);
+    cgpu_free_texture(texture);
+}
+
+uint32_t TexturePool::trim(uint64_t frame_index, uint64_t latest_finished_frame, ReleaseCallback on_release)
+{
+    // queues are ordered by last use, so only their fronts are inspected
+    uint32_t count = 0;
+    const uint64_t critical_frame = (frame_index > max_idle_frames) ? frame_index - max_idle_frames : 0;
+    for (auto&& [key, queue] : textures)
     {
-        if (iter.texture == texture) return;
+        while (!queue.empty())
+        {
+            const auto last_use = queue.front().mark.frame_index;
+            if (last_use >= critical_frame || last_use > latest_finished_frame) break;
+            release(queue, on_release);
+            count++;
+        }
     }
-    textures[key].emplace_back(texture, final_state, mark);
+    while (budget && allocated_bytes > budget)
+    {
+        eastl::deque<PooledTexture>* oldest = nullptr;
+        for (auto&& [key, queue] : textures)
+        {
+            if (queue.empty() || queue.front().mark.frame_index > latest_finished_frame) continue;
+            if (!oldest || queue.front().mark.frame_index < oldest->front().mark.frame_index)
+                oldest = &queue;
+        }
+        if (!oldest) break;
+        release(*oldest, on_release);
+        count++;
+    }
+    return count;
+}
+
+uint32_t TexturePool::collect(uint64_t critical_frame, uint32_t with_tags, uint32_t without_tags, ReleaseCallback on_release)
+{
+    uint32_t count = 0;
+    for (auto&& [key, queue] : textures)
+    {
+        for (auto&& pooled_texture : queue)
+        {
+            if (pooled_texture.mark.frame_index <= critical_frame 
+                && (pooled_texture.mark.tags & with_tags) && !(pooled_texture.mark.tags & without_tags))
+            {
+                const auto size = pooled_texture.texture->info->size_in_bytes;
+                pooled_bytes -= size;
+                allocated_bytes -= size;
+                pooled.erase(pooled_texture.texture);
+                on_release(pooled_texture.texture);
+                cgpu_free_texture(pooled_texture.texture);
+                pooled_texture.texture = nullptr;
+            }
+        }
+        uint32_t prev_count = (uint32_t)queue.size();
+        queue.erase(
+            eastl::remove_if(queue.begin(), queue.end(),
+            [&](auto& element) {
+                return element.texture == nullptr;
+            }),
+            queue.end());
+        count += prev_count - (uint32_t)queue.size();
+    }
+    return count;
 }
 
 // Texture View Pool
@@ -304,10 +383,16 @@ BufferPool::Key::Key(CGPUDeviceId device, const CGPUBufferDescriptor& desc)
     , memory_usage(desc.memory_usage)
     , format(desc.format)
     , flags(desc.flags)
-    , first_element(desc.first_element)
-    , elemet_count(desc.elemet_count)
-    , element_stride(desc.element_stride)
+    , size_class(BufferPool::size_class(desc.size))
 {
+    const auto view_types = CGPU_RESOURCE_TYPE_BUFFER | CGPU_RESOURCE_TYPE_RW_BUFFER 
+        | CGPU_RESOURCE_TYPE_TEXEL_BUFFER | CGPU_RESOURCE_TYPE_RW_TEXEL_BUFFER;
+    if (desc.descriptors & view_types)
+    {
+        first_element = desc.first_element;
+        elemet_count = desc.elemet_count;
+        element_stride = desc.element_stride;
+    }
 }
 
 BufferPool::Key::operator size_t() const
@@ -315,6 +400,14 @@ BufferPool::Key::operator size_t() const
     return skr_hash(this, sizeof(*this), (size_t)device);
 }
 
+uint32_t BufferPool::size_class(uint64_t size)
+{
+    uint32_t cls = 0;
+    while (cls < 63 && (1ull << cls) < size) 
+        cls++;
+    return cls;
+}
+
 void BufferPool::initialize(CGPUDeviceId device_)
 {
     device = device_;
@@ -330,6 +423,9 @@ void BufferPool::finalize()
             queue.pop_front();
         }
     }
+    buffers.clear();
+    pooled.clear();
+    allocated_bytes = pooled_bytes = 0;
 }
 
 eastl::pair<CGPUBufferId, ECGPUResourceState> BufferPool::allocate(const CGPUBufferDescriptor& desc, AllocationMark mark, uint64_t min_frame_index)
@@ -338,41 +434,99 @@ eastl::pair<CGPUBufferId, ECGPUResourceState> BufferPool::allocate(const CGPUBuf
         nullptr, CGPU_RESOURCE_STATE_UNDEFINED
     };
     auto key = make_zeroed<BufferPool::Key>(device, desc);
-    int32_t found_index = -1;
-    for (uint32_t i = 0; i < buffers[key].size(); ++i)
+    auto& queue = buffers[key];
+    // queue is ordered by last use, every entry of the class is large enough
+    if (!queue.empty() && queue.front().mark.frame_index < min_frame_index)
     {
-        auto&& pooled = buffers[key][i];
-        if (pooled.mark.frame_index < min_frame_index && pooled.buffer->info->size >= desc.size)
-        {
-            found_index = i;
-            break;
-        }
+        allocated = { queue.front().buffer, queue.front().state };
+        pooled_bytes -= allocated.first->info->size;
+        pooled.erase(allocated.first);
+        queue.pop_front();
+        return allocated;
     }
-    if ( found_index > 0 )
+    auto class_desc = desc;
+    class_desc.size = 1ull << key.size_class;
+    auto new_buffer = cgpu_create_buffer(device, &class_desc);
+    allocated_bytes += new_buffer->info->size;
+    return { new_buffer, desc.start_state };
+}
+
+void BufferPool::deallocate(const CGPUBufferDescriptor& desc, CGPUBufferId buffer, ECGPUResourceState final_state, AllocationMark mark)
+{
+    if (!pooled.emplace(buffer).second) 
+        return;
+    auto key = make_zeroed<BufferPool::Key>(device, desc);
+    buffers[key].emplace_back(buffer, final_state, mark);
+    pooled_bytes += buffer->info->size;
+}
+
+void BufferPool::release(eastl::deque<PooledBuffer>& queue)
+{
+    auto buffer = queue.front().buffer;
+    pooled_bytes -= buffer->info->size;
+    allocated_bytes -= buffer->info->size;
+    pooled.erase(buffer);
+    queue.pop_front();
+    cgpu_free_buffer(buffer);
+}
+
+uint32_t BufferPool::trim(uint64_t frame_index, uint64_t latest_finished_frame)
+{
+    uint32_t count = 0;
+    const uint64_t critical_frame = (frame_index > max_idle_frames) ? frame_index - max_idle_frames : 0;
+    for (auto&& [key, queue] : buffers)
     {
-        PooledBuffer found = buffers[key][found_index];
-        buffers[key].erase(buffers[key].begin() + found_index);
-        buffers[key].emplace_front(found.buffer, found.state, mark);
+        while (!queue.empty())
+        {
+            const auto last_use = queue.front().mark.frame_index;
+            if (last_use >= critical_frame || last_use > latest_finished_frame) break;
+            release(queue);
+            count++;
+        }
     }
-    if ( found_index < 0 )
+    while (budget && allocated_bytes > budget)
     {
-        auto new_buffer = cgpu_create_buffer(device, &desc);
-        buffers[key].emplace_front(new_buffer, desc.start_state , mark);
+        eastl::deque<PooledBuffer>* oldest = nullptr;
+        for (auto&& [key, queue] : buffers)
+        {
+            if (queue.empty() || queue.front().mark.frame_index > latest_finished_frame) continue;
+            if (!oldest || queue.front().mark.frame_index < oldest->front().mark.frame_index)
+                oldest = &queue;
+        }
+        if (!oldest) break;
+        release(*oldest);
+        count++;
     }
-    allocated = { buffers[key].front().buffer, buffers[key].front().state };
-    buffers[key].pop_front();
-    return allocated;
+    return count;
 }
 
-void BufferPool::deallocate(const CGPUBufferDescriptor& desc, CGPUBufferId buffer, ECGPUResourceState final_state, AllocationMark mark)
+uint32_t BufferPool::collect(uint64_t critical_frame, uint32_t with_tags, uint32_t without_tags)
 {
-    auto key = make_zeroed<BufferPool::Key>(device, desc);
-    for (auto&& iter : buffers[key])
+    uint32_t count = 0;
+    for (auto&& [key, queue] : buffers)
     {
-        if (iter.buffer == buffer) 
-            return;
+        for (auto&& pooled_buffer : queue)
+        {
+            if (pooled_buffer.mark.frame_index <= critical_frame 
+                && (pooled_buffer.mark.tags & with_tags) && !(pooled_buffer.mark.tags & without_tags))
+            {
+                pooled_bytes -= pooled_buffer.buffer->info->size;
+                allocated_bytes -= pooled_buffer.buffer->info->size;
+                pooled.erase(pooled_buffer.buffer);
+                cgpu_free_buffer(pooled_buffer.buffer);
+                pooled_buffer.buffer = nullptr;
+            }
+        }
+        uint32_t prev_count = (uint32_t)queue.size();
+        queue.erase(
+            eastl::remove_if(queue.begin(), queue.end(),
+                [&](auto& element) {
+                    return element.buffer == nullptr;
+                }),
+                queue.end());
+        count += prev_count - (uint32_t)queue.size();
     }
-    buffers[key].emplace_back(buffer, final_state, mark);
+    return count;
 }
 
 }
@@ -26,6 +26,25 @@ RenderGraph::RenderGraphBuilder& RenderGraph::RenderGraphBuilder::enable_memory_
     return *this;
 }
 
+RenderGraph::RenderGraphBuilder& RenderGraph::RenderGraphBuilder::with_pool_budget(uint64_t texture_bytes, uint64_t buffer_bytes) SKR_NOEXCEPT
+{
+    pool_budget_textures = texture_bytes;
+    pool_budget_buffers = buffer_bytes;
+    return *this;
+}
+
+RenderGraph::RenderGraphBuilder& RenderGraph::RenderGraphBuilder::with_pool_max_idle_frames(uint64_t frames) SKR_NOEXCEPT
+{
+    pool_max_idle_frames = frames;
+    return *this;
+}
+
+RenderGraph::RenderGraphBuilder& RenderGraph::RenderGraphBuilder::share_backend(RenderGraph* graph) SKR_NOEXCEPT
+{
+    shared_backend = graph;
+    return *this;
+}
+
 RenderGraph::RenderGraphBuilder& RenderGraph::RenderGraphBuilder::with_gfx_queue(CGPUQueueId queue) SKR_NOEXCEPT
 {
     gfx_queue = queue;
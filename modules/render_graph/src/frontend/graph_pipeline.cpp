@@ -0,0 +1,98 @@
+#include "SkrRenderGraph/frontend/render_graph_pipeline.hpp"
+#include "SkrRT/async/thread_job.hpp"
+#include "SkrRT/misc/make_zeroed.hpp"
+#include "SkrRT/platform/memory.h"
+
+#include "tracy/Tracy.hpp"
+
+namespace skr
+{
+namespace render_graph
+{
+RenderGraphPipeline* RenderGraphPipeline::create(const RenderGraphSetupFunction& setup, skr::JobQueue* setup_queue) SKR_NOEXCEPT
+{
+    auto pipeline = SkrNew<RenderGraphPipeline>();
+    pipeline->graphs[0] = RenderGraph::create(setup);
+    pipeline->graphs[1] = RenderGraph::create(
+    [&](RenderGraphBuilder& builder) {
+        setup(builder);
+        builder.share_backend(pipeline->graphs[0]);
+    });
+    pipeline->next_frame = pipeline->graphs[0]->get_frame_index();
+    pipeline->setup_queue = setup_queue;
+    if (!setup_queue)
+    {
+        auto jqDesc = make_zeroed<skr::JobQueueDesc>();
+        jqDesc.thread_count = 1;
+        jqDesc.priority = SKR_THREAD_ABOVE_NORMAL;
+        jqDesc.name = u8"RenderGraphSetupQueue";
+        jqDesc.cpu_bound = true;
+        pipeline->setup_queue = SkrNew<skr::JobQueue>(jqDesc);
+        pipeline->owns_queue = true;
+    }
+    return pipeline;
+}
+
+void RenderGraphPipeline::destroy(RenderGraphPipeline* pipeline) SKR_NOEXCEPT
+{
+    // a kicked frame may hold nodes & imported resources, run it to release them
+    pipeline->flush();
+    // and let the GPU finish it before the executors & pools it records into are freed
+    if (auto gfx_queue = pipeline->graphs[0]->get_gfx_queue())
+        cgpu_wait_queue_idle(gfx_queue);
+    if (pipeline->owns_queue)
+        SkrDelete(pipeline->setup_queue);
+    // the secondary graph borrows the backend of the primary one
+    RenderGraph::destroy(pipeline->graphs[1]);
+    RenderGraph::destroy(pipeline->graphs[0]);
+    SkrDelete(pipeline);
+}
+
+RenderGraph* RenderGraphPipeline::wait_pending() SKR_NOEXCEPT
+{
+    if (!pending)
+        return nullptr;
+    ZoneScopedN("WaitGraphSetup");
+    pending->wait();
+    SkrDelete(pending);
+    pending = nullptr;
+    auto graph = pending_graph;
+    pending_graph = nullptr;
+    return graph;
+}
+
+uint64_t RenderGraphPipeline::execute(const FrameSetupFunction& setup, RenderGraphProfiler* profiler) SKR_NOEXCEPT
+{
+    auto ready = wait_pending();
+    {
+        ZoneScopedN("KickGraphSetup");
+        auto graph = graphs[next_graph];
+        next_graph = (next_graph + 1) % 2;
+        // the ready frame executes first, the kicked one gets the index after it
+        graph->frame_index = next_frame + (ready ? 1 : 0);
+        pending_graph = graph;
+        pending = skr::FutureLauncher<bool>(setup_queue).async([graph, setup]() {
+            ZoneScopedN("GraphSetup");
+            setup(*graph);
+            graph->compile();
+            return true;
+        });
+    }
+    if (!ready)
+        return UINT64_MAX;
+    const auto executed = ready->execute(profiler);
+    next_frame = executed + 1;
+    return executed;
+}
+
+uint64_t RenderGraphPipeline::flush(RenderGraphProfiler* profiler) SKR_NOEXCEPT
+{
+    auto ready = wait_pending();
+    if (!ready)
+        return UINT64_MAX;
+    const auto executed = ready->execute(profiler);
+    next_frame = executed + 1;
+    return executed;
+}
+} // namespace render_graph
+} // namespace skr
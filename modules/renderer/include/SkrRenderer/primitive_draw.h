@@ -38,6 +38,14 @@ typedef struct skr_primitive_draw_t {
     const skr_vertex_buffer_view_t* vertex_buffers;
     uint32_t vertex_buffer_count;
     skr_index_buffer_view_t index_buffer;
+    // per-instance payload (transform, material parameters) of instance_stride bytes, read by the pipeline
+    // from an instance rate vertex stream bound after vertex_buffers. draws that carry one and share pipeline,
+    // bind table, geometry & stride are merged into one instanced draw by SRenderInstancing
+    const uint8_t* instance_data;
+    uint32_t instance_stride;
+    // written by the renderer: instances of the merged draw and byte offset of the first one in the pass instance data
+    uint32_t instance_count;
+    uint32_t instance_offset;
     bool desperated;
 } skr_primitive_draw_t;
 
@@ -17,6 +17,9 @@ typedef struct skr_primitive_pass_context_t {
     SRendererId renderer;
     skr::render_graph::RenderGraph* render_graph;
     struct dual_storage_t* storage;
+    // instance payloads of the merged draws of this pass, the pass uploads them to its instance buffer
+    const uint8_t* instance_data;
+    uint64_t instance_data_size;
 } skr_primitive_pass_context_t;
 
 struct IPrimitiveRenderPass {
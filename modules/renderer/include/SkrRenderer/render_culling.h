@@ -0,0 +1,40 @@
+#pragma once
+#include "SkrRenderer/module.configure.h"
+#include "SkrRenderer/render_viewport.h"
+#include "SkrRT/ecs/dual.h"
+#ifdef __cplusplus
+    #include "SkrRT/containers/span.hpp"
+#endif
+#ifndef __meta__
+    #include "SkrRenderer/render_culling.generated.h" // IWYU pragma: export
+#endif
+
+// world space bounds of a render entity, refreshed by skr_render_bounds_update
+// effects that want to be culled add it to their render entity type set
+sreflect_struct("guid" : "5e0c3b8a-2f4d-4a61-9c7e-8b1d6f3a2e90", "component" : true)
+skr_render_bounds_comp_t
+{
+    skr_float3_t center;
+    skr_float3_t extents;
+    // false until the mesh provides bounds, such entities are never culled
+    bool valid;
+};
+typedef struct skr_render_bounds_comp_t skr_render_bounds_comp_t;
+
+// derives world bounds of render entities in r_cv from their [in]skr_render_mesh_comp_t and the transforms of game_entities
+SKR_RENDERER_EXTERN_C SKR_RENDERER_API
+void skr_render_bounds_update(dual_storage_t* storage, dual_chunk_view_t* r_cv, const dual_entity_t* game_entities);
+
+struct SKR_RENDERER_API SRenderCulling {
+#ifdef __cplusplus
+    // tests every entity with skr_render_bounds_comp_t against the frustums of the viewports,
+    // chunks are culled as parallel jobs, whole chunk bounds first and then four entities at a time
+    virtual void cull(const skr_render_viewport_t* const* viewports, uint32_t count) SKR_NOEXCEPT = 0;
+    // render entities that survived the last cull of the viewport, grouped by chunk
+    virtual skr::span<const dual_entity_t> get_visible_entities(uint32_t viewport_index) const SKR_NOEXCEPT = 0;
+
+    static SRenderCulling* Create(dual_storage_t* storage);
+    static void Free(SRenderCulling* culling);
+    virtual ~SRenderCulling() SKR_NOEXCEPT;
+#endif
+};
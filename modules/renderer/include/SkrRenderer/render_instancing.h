@@ -0,0 +1,21 @@
+#pragma once
+#include "SkrRenderer/module.configure.h"
+#include "SkrRenderer/primitive_pass.h"
+#ifdef __cplusplus
+    #include "SkrRT/containers/span.hpp"
+#endif
+
+struct SKR_RENDERER_API SRenderInstancing {
+#ifdef __cplusplus
+    // merges draws of the packets that carry instance data and share pipeline, bind table, geometry & instance stride,
+    // the first draw of a group becomes the instanced one and the rest are marked desperated.
+    // push constants of a merged draw are the ones of its first draw, payloads are packed into the instance data of the pass
+    virtual void merge(skr_render_pass_name_t pass, skr::span<const skr_primitive_draw_packet_t> packets) SKR_NOEXCEPT = 0;
+    // packed payloads of the last merge of the pass, valid until the next one
+    virtual skr::span<const uint8_t> get_instance_data(skr_render_pass_name_t pass) const SKR_NOEXCEPT = 0;
+
+    static SRenderInstancing* Create();
+    static void Free(SRenderInstancing* instancing);
+    virtual ~SRenderInstancing() SKR_NOEXCEPT;
+#endif
+};
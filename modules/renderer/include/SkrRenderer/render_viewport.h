@@ -1,6 +1,9 @@
 #pragma once
 #include "SkrRenderer/module.configure.h"
 #include "SkrScene/scene.h"
+#ifdef __cplusplus
+    #include "SkrRT/containers/span.hpp"
+#endif
 #ifndef __meta__
     #include "SkrRenderer/render_viewport.generated.h" // IWYU pragma: export
 #endif
@@ -26,6 +29,8 @@ struct SKR_RENDERER_API SViewportManager {
     virtual skr_render_viewport_t* find_viewport(uint32_t idx) SKR_NOEXCEPT = 0;
     virtual void remove_viewport(const char8_t* viewport_name) SKR_NOEXCEPT = 0;
     virtual void remove_viewport(uint32_t idx) SKR_NOEXCEPT = 0;
+    // every registered slot, removed viewports are left with index UINT32_MAX
+    virtual skr::span<const skr_render_viewport_t> get_viewports() const SKR_NOEXCEPT = 0;
 
     static SViewportManager* Create(dual_storage_t* storage);
     static void Free(SViewportManager* viewport_manager);
@@ -110,6 +110,11 @@ MeshResource
 
     using material_handle_t = skr::resource::TResourceHandle<skr_material_resource_t>;
     skr::vector<material_handle_t> materials;
+
+    // local space bounds of all primitives, left empty by cookers that do not provide them
+    skr_float3_t bounds_min;
+    skr_float3_t bounds_max;
+    bool has_bounds SKR_IF_CPP(= false);
     
     bool install_to_vram SKR_IF_CPP(= true);
     bool install_to_ram SKR_IF_CPP(= true); // TODO: configure this in asset
@@ -5,6 +5,8 @@
 
 struct dual_storage_t;
 struct SViewportManager;
+struct SRenderCulling;
+struct SRenderInstancing;
 
 struct SKR_RENDERER_API SRenderer {
 #ifdef __cplusplus
@@ -14,6 +16,10 @@ struct SKR_RENDERER_API SRenderer {
     virtual SRenderDeviceId get_render_device() const = 0;
     virtual dual_storage_t* get_dual_storage() const = 0;
     virtual SViewportManager* get_viewport_manager() const = 0;
+    // refreshed every frame before effects produce draw packets
+    virtual SRenderCulling* get_render_culling() const = 0;
+    // merges instanceable draws of every pass after effects produced their draw packets
+    virtual SRenderInstancing* get_render_instancing() const = 0;
 #endif
 };
 
@@ -0,0 +1,299 @@
+#include "SkrRT/math/rtm/vector4f.h"
+#include "SkrRT/math/rtm/mask4f.h"
+#include "SkrRT/misc/parallel_for.hpp"
+#include "SkrRT/containers/vector.hpp"
+
+#include "SkrScene/scene.h"
+#include "SkrScene/spatial.h"
+#include "SkrRenderer/render_mesh.h"
+#include "SkrRenderer/render_culling.h"
+
+#include <cfloat>
+
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+// six frustum planes in SoA form, a point p is inside plane i when n[i].p + w[i] >= 0
+// a[i] caches |n[i]| to project box extents on the plane normal
+struct SFrustumPlanes {
+    float nx[6], ny[6], nz[6], w[6];
+    float ax[6], ay[6], az[6];
+};
+
+SFrustumPlanes ExtractFrustumPlanes(const skr_float4x4_t& view_projection)
+{
+    const auto source = skr::scene::Frustum::FromViewProjection(view_projection);
+    const auto& planes = source.planes;
+    SFrustumPlanes frustum;
+    for (uint32_t i = 0; i < 6; ++i)
+    {
+        frustum.nx[i] = planes[i].x;
+        frustum.ny[i] = planes[i].y;
+        frustum.nz[i] = planes[i].z;
+        frustum.w[i] = planes[i].w;
+        frustum.ax[i] = fabsf(planes[i].x);
+        frustum.ay[i] = fabsf(planes[i].y);
+        frustum.az[i] = fabsf(planes[i].z);
+    }
+    return frustum;
+}
+
+enum class ECullResult
+{
+    Outside,
+    Intersect,
+    Inside
+};
+
+ECullResult CullBox(const SFrustumPlanes& f, const float center[3], const float extents[3])
+{
+    auto result = ECullResult::Inside;
+    for (uint32_t i = 0; i < 6; ++i)
+    {
+        const float d = f.nx[i] * center[0] + f.ny[i] * center[1] + f.nz[i] * center[2] + f.w[i];
+        const float r = f.ax[i] * extents[0] + f.ay[i] * extents[1] + f.az[i] * extents[2];
+        if (d + r < 0.f) return ECullResult::Outside;
+        if (d - r < 0.f) result = ECullResult::Intersect;
+    }
+    return result;
+}
+
+// tests four boxes at once, returns a bit per visible box
+uint32_t CullBoxes4(const SFrustumPlanes& f, const float* cx, const float* cy, const float* cz, const float* ex, const float* ey, const float* ez)
+{
+    const auto x = rtm::vector_load(cx);
+    const auto y = rtm::vector_load(cy);
+    const auto z = rtm::vector_load(cz);
+    const auto hx = rtm::vector_load(ex);
+    const auto hy = rtm::vector_load(ey);
+    const auto hz = rtm::vector_load(ez);
+    const auto zero = rtm::vector_zero();
+    rtm::mask4f outside = rtm::mask_set(false, false, false, false);
+    for (uint32_t i = 0; i < 6; ++i)
+    {
+        const auto d = rtm::vector_mul_add(x, f.nx[i], rtm::vector_mul_add(y, f.ny[i], rtm::vector_mul_add(z, f.nz[i], rtm::vector_set(f.w[i]))));
+        const auto r = rtm::vector_mul_add(hx, f.ax[i], rtm::vector_mul_add(hy, f.ay[i], rtm::vector_mul(hz, f.az[i])));
+        outside = rtm::mask_or(outside, rtm::vector_less_than(rtm::vector_add(d, r), zero));
+    }
+    return (rtm::mask_get_x(outside) ? 0u : 1u) | (rtm::mask_get_y(outside) ? 0u : 2u) |
+           (rtm::mask_get_z(outside) ? 0u : 4u) | (rtm::mask_get_w(outside) ? 0u : 8u);
+}
+
+// big enough to pass every plane, small enough to keep |n| * e finite
+static constexpr float kUnboundedExtent = 1e30f;
+} // namespace
+
+void skr_render_bounds_update(dual_storage_t* storage, dual_chunk_view_t* r_cv, const dual_entity_t* game_entities)
+{
+    ZoneScopedN("UpdateRenderBounds");
+
+    auto bounds = dual::get_owned_rw<skr_render_bounds_comp_t>(r_cv);
+    const auto meshes = dual::get_component_ro<skr_render_mesh_comp_t>(r_cv);
+    if (!bounds || !game_entities) return;
+
+    uint32_t r_idx = 0;
+    auto gBatchCallback = [&](dual_chunk_view_t* g_cv) {
+        const auto l2ws = dual::get_component_ro<skr_transform_comp_t>(g_cv);
+        const auto translations = dual::get_component_ro<skr_translation_comp_t>(g_cv);
+        const auto rotations = dual::get_component_ro<skr_rotation_comp_t>(g_cv);
+        const auto scales = dual::get_component_ro<skr_scale_comp_t>(g_cv);
+        for (uint32_t g_idx = 0; g_idx < g_cv->count; g_idx++, r_idx++)
+        {
+            auto& bound = bounds[r_idx];
+            bound.valid = false;
+            if (!meshes || meshes[r_idx].mesh_resource.get_status() != SKR_LOADING_STATUS_INSTALLED)
+                continue;
+            auto mesh = (skr_mesh_resource_t*)meshes[r_idx].mesh_resource.get_ptr();
+            if (!mesh->has_bounds)
+                continue;
+
+            skr_transform_t transform = {};
+            if (l2ws)
+                transform = l2ws[g_idx].value;
+            else if (translations)
+            {
+                transform.translation = translations[g_idx].value;
+                if (rotations) transform.rotation = rotations[g_idx].euler;
+                if (scales) transform.scale = scales[g_idx].value;
+            }
+            const skr_float3_t& min = mesh->bounds_min;
+            const skr_float3_t& max = mesh->bounds_max;
+            const skr_float3_t c = { (min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f };
+            const skr_float3_t e = { (max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f };
+            skr::scene::TransformBounds(transform, c, e, bound.center, bound.extents);
+            bound.valid = true;
+        }
+    };
+    dualS_batch(storage, game_entities, r_cv->count, DUAL_LAMBDA(gBatchCallback));
+}
+
+struct SRenderCullingImpl : public SRenderCulling
+{
+    SRenderCullingImpl(dual_storage_t* storage)
+    {
+        bounds_query = dualQ_from_literal(storage, "[in]skr_render_bounds_comp_t");
+    }
+
+    ~SRenderCullingImpl()
+    {
+        dualQ_release(bounds_query);
+    }
+
+    void cull(const skr_render_viewport_t* const* viewports, uint32_t count) SKR_NOEXCEPT final override
+    {
+        ZoneScopedN("RenderCulling");
+
+        for (auto& visible : visibles)
+            visible.clear();
+        if (!count) return;
+
+        frustums.clear();
+        uint32_t max_index = 0;
+        for (uint32_t v = 0; v < count; ++v)
+        {
+            frustums.emplace_back(ExtractFrustumPlanes(viewports[v]->view_projection));
+            max_index = eastl::max(max_index, viewports[v]->index);
+        }
+        if (visibles.size() <= max_index)
+            visibles.resize(max_index + 1);
+
+        chunk_views.clear();
+        auto collect = [&](dual_chunk_view_t* r_cv) { chunk_views.emplace_back(*r_cv); };
+        dualQ_sync(bounds_query);
+        dualQ_get_views(bounds_query, DUAL_LAMBDA(collect));
+
+        // chunk x viewport results, written by the jobs without sharing
+        const size_t result_count = chunk_views.size() * count;
+        if (chunk_results.size() < result_count)
+            chunk_results.resize(result_count);
+        for (size_t i = 0; i < result_count; ++i)
+            chunk_results[i].clear();
+
+        skr::parallel_for(chunk_views.begin(), chunk_views.end(), 4u,
+        [this, count](auto&& begin, auto&& end) {
+            ZoneScopedN("CullChunks");
+            skr::vector<float> soa;
+            for (auto iter = begin; iter != end; ++iter)
+            {
+                const size_t chunk_index = iter - chunk_views.begin();
+                cull_chunk(&*iter, chunk_results.data() + chunk_index * count, count, soa);
+            }
+        }, 2u);
+
+        // chunks stay in query order so every visible list batches into contiguous views
+        for (uint32_t v = 0; v < count; ++v)
+        {
+            auto& visible = visibles[viewports[v]->index];
+            for (size_t c = 0; c < chunk_views.size(); ++c)
+            {
+                const auto& result = chunk_results[c * count + v];
+                visible.insert(visible.end(), result.begin(), result.end());
+            }
+        }
+    }
+
+    skr::span<const dual_entity_t> get_visible_entities(uint32_t viewport_index) const SKR_NOEXCEPT final override
+    {
+        if (viewport_index >= visibles.size()) return {};
+        return { visibles[viewport_index].data(), visibles[viewport_index].size() };
+    }
+
+    void cull_chunk(const dual_chunk_view_t* r_cv, skr::vector<dual_entity_t>* results, uint32_t view_count, skr::vector<float>& soa)
+    {
+        const auto bounds = dual::get_component_ro<skr_render_bounds_comp_t>(r_cv);
+        const auto entities = dualV_get_entities(r_cv);
+        const uint32_t count = r_cv->count;
+        const uint32_t padded = (count + 3u) & ~3u;
+
+        // transpose to SoA and accumulate the chunk bounds of entities that have one
+        soa.resize(padded * 6);
+        float* cx = soa.data();
+        float* cy = cx + padded;
+        float* cz = cy + padded;
+        float* ex = cz + padded;
+        float* ey = ex + padded;
+        float* ez = ey + padded;
+        float chunk_min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+        float chunk_max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        bool has_unbounded = false;
+        for (uint32_t i = 0; i < padded; ++i)
+        {
+            if (i >= count)
+            {
+                cx[i] = cy[i] = cz[i] = ex[i] = ey[i] = ez[i] = 0.f;
+                continue;
+            }
+            const auto& bound = bounds[i];
+            if (!bound.valid)
+            {
+                has_unbounded = true;
+                cx[i] = cy[i] = cz[i] = 0.f;
+                ex[i] = ey[i] = ez[i] = kUnboundedExtent;
+                continue;
+            }
+            cx[i] = bound.center.x; cy[i] = bound.center.y; cz[i] = bound.center.z;
+            ex[i] = bound.extents.x; ey[i] = bound.extents.y; ez[i] = bound.extents.z;
+            chunk_min[0] = eastl::min(chunk_min[0], cx[i] - ex[i]);
+            chunk_min[1] = eastl::min(chunk_min[1], cy[i] - ey[i]);
+            chunk_min[2] = eastl::min(chunk_min[2], cz[i] - ez[i]);
+            chunk_max[0] = eastl::max(chunk_max[0], cx[i] + ex[i]);
+            chunk_max[1] = eastl::max(chunk_max[1], cy[i] + ey[i]);
+            chunk_max[2] = eastl::max(chunk_max[2], cz[i] + ez[i]);
+        }
+        const bool has_bounded = chunk_min[0] <= chunk_max[0];
+        const float chunk_center[3] = { (chunk_min[0] + chunk_max[0]) * 0.5f, (chunk_min[1] + chunk_max[1]) * 0.5f, (chunk_min[2] + chunk_max[2]) * 0.5f };
+        const float chunk_extents[3] = { (chunk_max[0] - chunk_min[0]) * 0.5f, (chunk_max[1] - chunk_min[1]) * 0.5f, (chunk_max[2] - chunk_min[2]) * 0.5f };
+
+        for (uint32_t v = 0; v < view_count; ++v)
+        {
+            const auto& frustum = frustums[v];
+            auto& result = results[v];
+            const auto chunk_result = has_bounded ? CullBox(frustum, chunk_center, chunk_extents) : ECullResult::Outside;
+            if (chunk_result == ECullResult::Inside && !has_unbounded)
+            {
+                result.insert(result.end(), entities, entities + count);
+                continue;
+            }
+            if (chunk_result == ECullResult::Outside)
+            {
+                // only entities without bounds survive a culled chunk
+                if (has_unbounded)
+                {
+                    for (uint32_t i = 0; i < count; ++i)
+                        if (!bounds[i].valid) result.emplace_back(entities[i]);
+                }
+                continue;
+            }
+            for (uint32_t i = 0; i < padded; i += 4)
+            {
+                const uint32_t mask = CullBoxes4(frustum, cx + i, cy + i, cz + i, ex + i, ey + i, ez + i);
+                for (uint32_t lane = 0; lane < 4 && i + lane < count; ++lane)
+                {
+                    if (mask & (1u << lane)) result.emplace_back(entities[i + lane]);
+                }
+            }
+        }
+    }
+
+    dual_query_t* bounds_query = nullptr;
+    skr::vector<SFrustumPlanes> frustums;
+    skr::vector<dual_chunk_view_t> chunk_views;
+    skr::vector<skr::vector<dual_entity_t>> chunk_results;
+    skr::vector<skr::vector<dual_entity_t>> visibles;
+};
+
+SRenderCulling* SRenderCulling::Create(dual_storage_t* storage)
+{
+    return SkrNew<SRenderCullingImpl>(storage);
+}
+
+void SRenderCulling::Free(SRenderCulling* culling)
+{
+    SkrDelete(culling);
+}
+
+SRenderCulling::~SRenderCulling() SKR_NOEXCEPT
+{
+
+}
@@ -0,0 +1,122 @@
+#include "SkrRT/containers/hashmap.hpp"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/containers/string.hpp"
+#include "SkrRenderer/render_instancing.h"
+
+#include <EASTL/sort.h>
+#include <string.h>
+
+#include "tracy/Tracy.hpp"
+
+namespace
+{
+// vertex buffer views are bound at this alignment, enough for every backend
+static constexpr uint32_t kInstanceDataAlignment = 16;
+
+template <typename T>
+int32_t InstancingCompareField(const T& a, const T& b)
+{
+    return (a < b) ? -1 : (b < a) ? 1 : 0;
+}
+
+// orders draws so that the ones that can share an instanced draw end up adjacent
+int32_t InstancingCompare(const skr_primitive_draw_t* a, const skr_primitive_draw_t* b)
+{
+    if (const auto r = InstancingCompareField((uintptr_t)a->pipeline, (uintptr_t)b->pipeline)) return r;
+    if (const auto r = InstancingCompareField((uintptr_t)a->bind_table, (uintptr_t)b->bind_table)) return r;
+    if (const auto r = InstancingCompareField(a->instance_stride, b->instance_stride)) return r;
+    const auto& aib = a->index_buffer;
+    const auto& bib = b->index_buffer;
+    if (const auto r = InstancingCompareField((uintptr_t)aib.buffer, (uintptr_t)bib.buffer)) return r;
+    if (const auto r = InstancingCompareField(aib.offset, bib.offset)) return r;
+    if (const auto r = InstancingCompareField(aib.stride, bib.stride)) return r;
+    if (const auto r = InstancingCompareField(aib.first_index, bib.first_index)) return r;
+    if (const auto r = InstancingCompareField(aib.index_count, bib.index_count)) return r;
+    if (const auto r = InstancingCompareField(a->vertex_buffer_count, b->vertex_buffer_count)) return r;
+    if (a->vertex_buffers == b->vertex_buffers) return 0;
+    // skinned or per-entity streams live in different arrays, compare the views themselves
+    for (uint32_t i = 0; i < a->vertex_buffer_count; i++)
+    {
+        const auto& avb = a->vertex_buffers[i];
+        const auto& bvb = b->vertex_buffers[i];
+        if (const auto r = InstancingCompareField((uintptr_t)avb.buffer, (uintptr_t)bvb.buffer)) return r;
+        if (const auto r = InstancingCompareField(avb.offset, bvb.offset)) return r;
+        if (const auto r = InstancingCompareField(avb.stride, bvb.stride)) return r;
+    }
+    return 0;
+}
+} // namespace
+
+struct SRenderInstancingImpl : public SRenderInstancing
+{
+    void merge(skr_render_pass_name_t pass, skr::span<const skr_primitive_draw_packet_t> packets) SKR_NOEXCEPT final override
+    {
+        ZoneScopedN("MergeInstancedDraws");
+
+        auto& data = instance_data[pass];
+        data.clear();
+        candidates.clear();
+        for (const auto& packet : packets)
+        for (uint32_t i = 0; i < packet.count; i++)
+        for (uint32_t j = 0; j < packet.lists[i].count; j++)
+        {
+            auto& dc = packet.lists[i].drawcalls[j];
+            dc.instance_count = 0;
+            dc.instance_offset = 0;
+            if (dc.desperated || !dc.instance_data || !dc.instance_stride) continue;
+            candidates.emplace_back(&dc);
+        }
+        if (candidates.empty()) return;
+
+        // stable, so every group keeps the submission order of its instances
+        eastl::stable_sort(candidates.begin(), candidates.end(),
+        [](const skr_primitive_draw_t* a, const skr_primitive_draw_t* b) {
+            return InstancingCompare(a, b) < 0;
+        });
+        for (size_t begin = 0; begin < candidates.size();)
+        {
+            auto first = candidates[begin];
+            size_t end = begin + 1;
+            while (end < candidates.size() && InstancingCompare(first, candidates[end]) == 0)
+                ++end;
+
+            const uint32_t stride = first->instance_stride;
+            const uint64_t offset = (data.size() + kInstanceDataAlignment - 1) & ~(uint64_t)(kInstanceDataAlignment - 1);
+            data.resize(offset + (end - begin) * stride);
+            auto dst = data.data() + offset;
+            for (size_t k = begin; k < end; k++, dst += stride)
+            {
+                memcpy(dst, candidates[k]->instance_data, stride);
+                if (k != begin) candidates[k]->desperated = true;
+            }
+            first->instance_count = (uint32_t)(end - begin);
+            first->instance_offset = (uint32_t)offset;
+            begin = end;
+        }
+    }
+
+    skr::span<const uint8_t> get_instance_data(skr_render_pass_name_t pass) const SKR_NOEXCEPT final override
+    {
+        auto found = instance_data.find(pass);
+        if (found == instance_data.end()) return {};
+        return { found->second.data(), found->second.size() };
+    }
+
+    skr::flat_hash_map<skr::string, skr::vector<uint8_t>, skr::hash<skr::string>> instance_data;
+    skr::vector<skr_primitive_draw_t*> candidates;
+};
+
+SRenderInstancing* SRenderInstancing::Create()
+{
+    return SkrNew<SRenderInstancingImpl>();
+}
+
+void SRenderInstancing::Free(SRenderInstancing* instancing)
+{
+    SkrDelete(instancing);
+}
+
+SRenderInstancing::~SRenderInstancing() SKR_NOEXCEPT
+{
+
+}
@@ -28,7 +28,7 @@ struct SViewportManagerImpl : public SViewportManager
             return found->second;
         }
         uint32_t idx = static_cast<uint32_t>(viewports.size());
-        auto newViewport = viewports.emplace_back();
+        auto& newViewport = viewports.emplace_back();
         idMap[viewport_name] = newViewport.index = idx;
         return idx;
     }
@@ -72,6 +72,11 @@ struct SViewportManagerImpl : public SViewportManager
         viewports[index].index = UINT32_MAX;
     }
 
+    skr::span<const skr_render_viewport_t> get_viewports() const SKR_NOEXCEPT final override
+    {
+        return { viewports.data(), viewports.size() };
+    }
+
     dual_query_t* camera_query = nullptr;
 
     skr::parallel_flat_hash_map<skr::string, uint32_t, skr::hash<skr::string>> idMap;
@@ -4,6 +4,8 @@
 #include "SkrRT/ecs/array.hpp"
 #include <SkrRT/containers/hashmap.hpp>
 #include "SkrRenderer/render_viewport.h"
+#include "SkrRenderer/render_culling.h"
+#include "SkrRenderer/render_instancing.h"
 #include "SkrRenderer/render_effect.h"
 #include "SkrRenderer/skr_renderer.h"
 #include "SkrRenderGraph/frontend/render_graph.hpp"
@@ -69,6 +71,8 @@ struct SKR_RENDERER_API SkrRendererImpl : public SRenderer
         : render_device(render_device), storage(storage)
     {
         viewport_manager = SViewportManager::Create(storage);
+        render_culling = SRenderCulling::Create(storage);
+        render_instancing = SRenderInstancing::Create();
     }
 
     ~SkrRendererImpl() override
@@ -77,6 +81,8 @@ struct SKR_RENDERER_API SkrRendererImpl : public SRenderer
         {
             if (proxy) SkrDelete(proxy);
         }
+        SRenderInstancing::Free(render_instancing);
+        SRenderCulling::Free(render_culling);
         SViewportManager::Free(viewport_manager);
     }
 
@@ -104,6 +110,8 @@ struct SKR_RENDERER_API SkrRendererImpl : public SRenderer
 
                 processor->on_update(&update_context);
             }
+            // effects refreshed their bounds in on_update
+            cull_viewports();
 
             for (auto& pass : passes)
             {
@@ -125,6 +133,7 @@ struct SKR_RENDERER_API SkrRendererImpl : public SRenderer
                         draw_packets[pass->identity()].emplace_back(packet);
                     }
                 }
+                render_instancing->merge(pass->identity(), draw_packets[pass->identity()]);
             }
 
             for (auto& processor : processors)
@@ -149,6 +158,9 @@ struct SKR_RENDERER_API SkrRendererImpl : public SRenderer
                     pass_context.renderer = this;
                     pass_context.render_graph = render_graph;
                     pass_context.storage = storage;
+                    const auto instance_data = render_instancing->get_instance_data(pass->identity());
+                    pass_context.instance_data = instance_data.data();
+                    pass_context.instance_data_size = instance_data.size();
 
                     pass->on_update(&pass_context);
 
@@ -173,7 +185,30 @@ struct SKR_RENDERER_API SkrRendererImpl : public SRenderer
         return viewport_manager;
     }
 
+    SRenderCulling* get_render_culling() const override
+    {
+        return render_culling;
+    }
+
+    SRenderInstancing* get_render_instancing() const override
+    {
+        return render_instancing;
+    }
+
+    void cull_viewports()
+    {
+        eastl::fixed_vector<const skr_render_viewport_t*, 4> viewports;
+        for (const auto& viewport : viewport_manager->get_viewports())
+        {
+            if (viewport.index != UINT32_MAX)
+                viewports.emplace_back(&viewport);
+        }
+        render_culling->cull(viewports.data(), (uint32_t)viewports.size());
+    }
+
     SViewportManager* viewport_manager = nullptr;
+    SRenderCulling* render_culling = nullptr;
+    SRenderInstancing* render_instancing = nullptr;
 
     template<typename T>
     using FlatStringMap = skr::flat_hash_map<skr::string, T, skr::hash<skr::string>>;
@@ -189,50 +189,9 @@ struct SMaterialFactoryImpl : public SMaterialFactory
     const char* sampler_name = "color_sampler";
     CGPUXBindTableId createMaterialBindTable(const skr_material_resource_t* material, CGPURootSignatureId root_signature) const
     {
-        // 1.make bind table
+        // 1.collect values, the table is made with one name per override so update i goes to slot i
         // TODO: multi bind table
-        CGPUXBindTableDescriptor table_desc = {};
-        table_desc.root_signature = root_signature;
         eastl::fixed_vector<const char8_t*, 16> slot_names;
-        for (uint32_t i = 0; i < root_signature->table_count; i++)
-        {
-            const auto& table = root_signature->tables[i];
-            for (uint32_t j = 0; j < table.resources_count; j++)
-            {
-                const auto& resource = table.resources[j];
-                if (resource.type == CGPU_RESOURCE_TYPE_SAMPLER)
-                {
-                    for (const auto& override : material->overrides.samplers)
-                    {
-                        if (override.slot_name.starts_with(resource.name) 
-                        && strlen((const char*)resource.name) == override.slot_name.size()) // slot name matches
-                        {
-                            slot_names.emplace_back(resource.name);
-                        }
-                    }
-                }
-                else if (resource.type == CGPU_RESOURCE_TYPE_TEXTURE)
-                {
-                    for (const auto& override : material->overrides.textures)
-                    {
-                        if (override.slot_name.starts_with(resource.name) 
-                        && strlen((const char*)resource.name) == override.slot_name.size()) // slot name matches
-                        {
-                            slot_names.emplace_back(resource.name);
-                        }
-                    }
-                }
-                else if (resource.type == CGPU_RESOURCE_TYPE_BUFFER)
-                {
-                    // SKR_UNIMPLEMENTED_FUNCTION();
-                }
-            }
-        }
-        table_desc.names_count = (uint32_t)slot_names.size();
-        table_desc.names = slot_names.data();
-        const auto bind_table = cgpux_create_bind_table(root.device, &table_desc);
-
-        // 2.update values
         eastl::fixed_vector<CGPUDescriptorData, 16> updates;
         for (const auto& override : material->overrides.samplers)
         {
@@ -244,6 +203,7 @@ struct SMaterialFactoryImpl : public SMaterialFactory
             update.count = 1;
             update.samplers = &hdl.get_resolved()->sampler;
             update.binding_type = CGPU_RESOURCE_TYPE_SAMPLER;
+            slot_names.emplace_back(update.name);
         }
         for (const auto& override : material->overrides.textures)
         {
@@ -255,8 +215,21 @@ struct SMaterialFactoryImpl : public SMaterialFactory
             update.count = 1; // TODO: Tex array parameter
             update.textures = &hdl.get_resolved()->texture_view;
             update.binding_type = CGPU_RESOURCE_TYPE_TEXTURE;
+            slot_names.emplace_back(update.name);
         }
-        cgpux_bind_table_update(bind_table, updates.data(), (uint32_t)updates.size());
+
+        // 2.make bind table, overrides the root signature does not use stay unresolved and are skipped
+        CGPUXBindTableDescriptor table_desc = {};
+        table_desc.root_signature = root_signature;
+        table_desc.names_count = (uint32_t)slot_names.size();
+        table_desc.names = slot_names.data();
+        const auto bind_table = cgpux_create_bind_table(root.device, &table_desc);
+
+        // 3.update values
+        eastl::fixed_vector<CGPUXBindTableSlot, 16> slots(updates.size());
+        for (uint32_t i = 0; i < slots.size(); i++)
+            slots[i] = i;
+        cgpux_bind_table_update_slots(bind_table, slots.data(), updates.data(), (uint32_t)updates.size());
         return bind_table;
     }
 
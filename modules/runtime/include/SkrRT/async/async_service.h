@@ -3,6 +3,7 @@
 #ifdef __cplusplus
 #include "SkrRT/async/named_thread.hpp"
 #include "SkrRT/async/condlock.hpp"
+#include <atomic>
 #endif
 
 typedef enum SkrAsyncServiceStatus
@@ -93,12 +94,23 @@ struct SKR_STATIC_API AsyncService : public skr::ServiceThread
         return (SkrAsyncServiceStatus)skr_atomicu32_load_acquire(&service_status);
     }
 
+    // services decide what sleep_time means, io runners wait it to batch requests after a wakeup
     void set_sleep_time(uint32_t time) SKR_NOEXCEPT
     {
         skr_atomicu32_store_release(&sleep_time, time);
     }
 
+    uint32_t get_sleep_time() const SKR_NOEXCEPT
+    {
+        return skr_atomicu32_load_acquire(&sleep_time);
+    }
+
+    // block until awake() is called
     void sleep() SKR_NOEXCEPT;
+    // block until awake() is called or `ms` passes, UINT32_MAX waits for awake() only
+    void sleep_for(uint32_t ms) SKR_NOEXCEPT;
+    // busy wait for up to `spin_count` pauses, returns true as soon as awake() is called
+    bool spin(uint32_t spin_count) SKR_NOEXCEPT;
 
     void request_stop() SKR_NOEXCEPT override
     {
@@ -114,10 +126,17 @@ struct SKR_STATIC_API AsyncService : public skr::ServiceThread
 
     void awake() SKR_NOEXCEPT
     {
-        condlock.lock();
-        event = true;
-        condlock.signal();
-        condlock.unlock();
+        skr_atomicu32_store_release(&event, 1);
+        // pairs with the fence in sleep_for: the store of event and of waiting are both ordered
+        // before the load of the other flag, so at least one side sees the other and no wakeup is lost
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // only pay for the lock when the service thread is actually blocked
+        if (skr_atomicu32_load_relaxed(&waiting))
+        {
+            condlock.lock();
+            condlock.signal();
+            condlock.unlock();
+        }
     }
 
 protected:
@@ -128,7 +147,8 @@ protected:
 
 private:
     SAtomicU32 sleep_time = 16u;
-    bool event = false;
+    SAtomicU32 event = 0;
+    SAtomicU32 waiting = 0;
     CondLock condlock;
     SAtomicU32 service_status = SKR_ASYNC_SERVICE_STATUS_SLEEPING;
 };
@@ -86,40 +86,28 @@ namespace task2
         std::coroutine_handle<promise_type> coroutine;
     };
 
-    struct condvar_t
+    struct scheduler_t;
+    // intrusive waiter node, lives in the awaitable (coroutine frame) or on the stack of a blocking thread
+    struct waiter_t
     {
-        SConditionVariable cv;
-        skr::vector<std::coroutine_handle<skr_task_t::promise_type>> waiters;
-        skr::vector<int> workerIndices;
-        std::atomic<int> numWaiting = {0};
-        std::atomic<int> numWaitingOnCondition = {0};
-        condvar_t()
-        {
-            skr_init_condition_var(&cv);
-        }
-        ~condvar_t()
-        {
-            skr_destroy_condition_var(&cv);
-        }
+        waiter_t* next = nullptr;
+        std::coroutine_handle<skr_task_t::promise_type> handle = nullptr; // null for blocking threads
+        struct scheduler_t* scheduler = nullptr;
+        int workerIdx = -1;
+    };
+    // lock-free waiter stack, notify() detaches the whole list and wakes every waiter on it
+    struct SKR_RUNTIME_API waiter_list_t
+    {
+        std::atomic<waiter_t*> head = {nullptr};
+        void push(waiter_t* waiter);
         void notify();
-        void add_waiter(std::coroutine_handle<skr_task_t::promise_type> waiter, int workerIndex);
-        void wait(SMutex& mutex);
     };
     struct event_t
     {
         struct State
         {
-            condvar_t cv;
-            SMutex mutex;
-            bool signalled = false;
-            State()
-            {
-                skr_init_mutex(&mutex);
-            }
-            ~State()
-            {
-                skr_destroy_mutex(&mutex);
-            }
+            std::atomic<bool> signalled = false;
+            waiter_list_t waiters;
         };
 
         event_t()
@@ -144,8 +132,7 @@ namespace task2
         { 
             if(!state) 
                 return true;
-            SMutexLock guard(state->mutex);
-            return state->signalled; 
+            return state->signalled.load(); 
         }
         explicit operator bool() const { return (bool)state; }
         bool operator==(const event_t& other) const { return state == other.state; }
@@ -168,18 +155,9 @@ namespace task2
     {
         struct State
         {
-            SMutex mutex;
             std::atomic<uint32_t> count = 0;
             bool inverse = false;
-            condvar_t cv;
-            State()
-            {
-                skr_init_mutex(&mutex);
-            }
-            ~State()
-            {
-                skr_destroy_mutex(&mutex);
-            }
+            waiter_list_t waiters;
         };
 
         counter_t()
@@ -209,7 +187,7 @@ namespace task2
         { 
             if(!state) 
                 return true;
-            return (state->count == 0) == (!state->inverse); 
+            return (state->count.load() == 0) == (!state->inverse); 
         }
         explicit operator bool() const { return (bool)state; }
         bool operator==(const counter_t& other) const { return state == other.state; }
@@ -248,6 +226,7 @@ namespace task2
             scheduler_t& scheduler;
             event_t event;
             int workerIdx = -1;
+            waiter_t waiter;
         };
         struct SKR_RUNTIME_API CounterAwaitable
         {
@@ -258,6 +237,7 @@ namespace task2
             scheduler_t& scheduler;
             counter_t counter;
             int workerIdx = -1;
+            waiter_t waiter;
         };
         void sync(event_t event);
         void sync(counter_t counter);
@@ -32,6 +32,9 @@ struct JobQueueDesc
     JobQueuePriority priority = SKR_THREAD_NORMAL;
     uint32_t stack_size = 16 * 1024;
     uint32_t thread_count = 1;
+    // items run against the shared WorkerPool budget, only for queues that do cpu work.
+    // io & callback queues spend most of their time blocked and are left out of the budget
+    bool cpu_bound = false;
 };
 
 struct JobItemDesc
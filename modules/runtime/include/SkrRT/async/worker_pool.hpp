@@ -0,0 +1,84 @@
+#pragma once
+#include "SkrRT/platform/configure.h"
+#include "SkrRT/platform/thread.h"
+#include <atomic>
+
+namespace skr
+{
+struct WorkerPoolDesc
+{
+    // number of threads allowed to run engine work at once, 0 means skr_cpu_cores_count()
+    uint32_t concurrency = 0;
+    // slots kept for latency sensitive services (io runners, log worker), shared workers never take them
+    uint32_t reserved_slots = 2;
+    // a shared worker waits at most this long for a slot before overcommitting,
+    // so pools that wait on each other can never deadlock on the budget
+    uint32_t overcommit_timeout_ms = 2;
+};
+
+typedef enum EWorkerSlotKind
+{
+    // task scheduler workers and cpu bound job queues, limited by the shared budget
+    kWorkerSlotShared = 0,
+    // latency sensitive service threads, never blocked but counted against the budget
+    kWorkerSlotReserved = 1
+} EWorkerSlotKind;
+
+// process-wide cpu budget that skr::task, task2, cpu bound JobQueue and AsyncService threads run against.
+// threads hold a slot while they are doing work and give it back before they block,
+// so the number of runnable engine threads stays close to the core count.
+struct SKR_RUNTIME_API WorkerPool
+{
+public:
+    static WorkerPool* Get();
+
+    WorkerPool() SKR_NOEXCEPT;
+    ~WorkerPool() SKR_NOEXCEPT;
+
+    // must be called before any scheduler or queue is created
+    void configure(const WorkerPoolDesc& desc) SKR_NOEXCEPT;
+
+    uint32_t get_concurrency() const SKR_NOEXCEPT { return concurrency; }
+    // slots left for shared workers once reserved services are accounted for
+    uint32_t get_shared_slots() const SKR_NOEXCEPT;
+    // default thread count for task schedulers, sized so they do not oversubscribe the budget
+    uint32_t get_worker_count() const SKR_NOEXCEPT;
+
+    // block until a slot of `kind` is free (reserved slots never block)
+    void acquire(EWorkerSlotKind kind) SKR_NOEXCEPT;
+    // @retval true if a slot was taken
+    bool try_acquire(EWorkerSlotKind kind) SKR_NOEXCEPT;
+    void release(EWorkerSlotKind kind) SKR_NOEXCEPT;
+
+    uint32_t get_active_count(EWorkerSlotKind kind) const SKR_NOEXCEPT;
+    uint64_t get_overcommit_count() const SKR_NOEXCEPT { return overcommits; }
+
+private:
+    WorkerPoolDesc desc;
+    uint32_t concurrency = 0;
+    std::atomic<uint32_t> shared_active = 0;
+    std::atomic<uint32_t> reserved_active = 0;
+    std::atomic<uint32_t> waiting = 0;
+    std::atomic<uint64_t> overcommits = 0;
+    SMutex mutex;
+    SConditionVariable cv;
+};
+
+struct WorkerPoolSlot
+{
+    WorkerPoolSlot(EWorkerSlotKind kind) SKR_NOEXCEPT
+        : kind(kind)
+    {
+        WorkerPool::Get()->acquire(kind);
+    }
+    ~WorkerPoolSlot() SKR_NOEXCEPT
+    {
+        WorkerPool::Get()->release(kind);
+    }
+    WorkerPoolSlot(const WorkerPoolSlot&) = delete;
+    WorkerPoolSlot& operator=(const WorkerPoolSlot&) = delete;
+
+private:
+    EWorkerSlotKind kind;
+};
+} // namespace skr
@@ -0,0 +1,77 @@
+#pragma once
+#include "SkrRT/containers/string.hpp"
+#include "SkrRT/misc/hash.h"
+
+namespace skr
+{
+// one interned string, entries live in the global name table until the process exits
+struct NameEntry
+{
+    uint32_t hash;
+    uint32_t size;
+    const char8_t* data() const { return reinterpret_cast<const char8_t*>(this + 1); }
+};
+
+// literal with its hash folded by the compiler, see SKR_NAME
+struct NameLiteral
+{
+    template <size_t N>
+    constexpr NameLiteral(const char8_t (&str)[N])
+        : str(str)
+        , size((uint32_t)(N - 1))
+        , hash(skr::hash_crc32(std::basic_string_view<char8_t>(str, N - 1)))
+    {
+    }
+    const char8_t* str;
+    uint32_t size;
+    uint32_t hash;
+};
+
+// interned, immutable identifier.
+// equal strings share one entry of a global sharded table, so copies are a pointer,
+// equality is a pointer compare and the hash is precomputed.
+// lookups of existing names never lock, only the first insertion of a string does.
+// entries are never freed, only intern bounded sets (literals, type & property ids),
+// never strings formatted per frame or per asset.
+struct SKR_RUNTIME_API Name
+{
+public:
+    Name() SKR_NOEXCEPT = default;
+    Name(std::nullptr_t) SKR_NOEXCEPT {}
+    Name(const char8_t* str) SKR_NOEXCEPT;
+    Name(const char8_t* str, uint32_t size) SKR_NOEXCEPT;
+    Name(skr::string_view str) SKR_NOEXCEPT;
+    Name(const skr::string& str) SKR_NOEXCEPT;
+    Name(const NameLiteral& literal) SKR_NOEXCEPT;
+
+    // returns the interned name or an empty one if the string was never interned, never inserts
+    static Name Find(const char8_t* str, uint32_t size) SKR_NOEXCEPT;
+    static Name Find(const char8_t* str) SKR_NOEXCEPT;
+    static uint32_t Hash(const char8_t* str, uint32_t size) SKR_NOEXCEPT;
+
+    inline const char8_t* u8_str() const SKR_NOEXCEPT { return entry ? entry->data() : u8""; }
+    inline const char* c_str() const SKR_NOEXCEPT { return reinterpret_cast<const char*>(u8_str()); }
+    // size in bytes
+    inline uint32_t size() const SKR_NOEXCEPT { return entry ? entry->size : 0; }
+    inline uint32_t hash() const SKR_NOEXCEPT { return entry ? entry->hash : 0; }
+    inline bool is_empty() const SKR_NOEXCEPT { return entry == nullptr; }
+    inline skr::string_view view() const SKR_NOEXCEPT { return skr::string_view(u8_str(), size()); }
+    inline explicit operator bool() const SKR_NOEXCEPT { return entry != nullptr; }
+
+    inline bool operator==(const Name& other) const SKR_NOEXCEPT { return entry == other.entry; }
+    inline bool operator!=(const Name& other) const SKR_NOEXCEPT { return entry != other.entry; }
+
+private:
+    explicit Name(const NameEntry* entry) SKR_NOEXCEPT : entry(entry) {}
+    const NameEntry* entry = nullptr;
+};
+
+template <>
+struct hash<Name>
+{
+    inline size_t operator()(const Name& x) const { return x.hash(); }
+};
+} // namespace skr
+
+// interns a u8 literal once per call site, the hash is computed at compile time
+#define SKR_NAME(literal) ([]() -> const ::skr::Name& { static const ::skr::Name __name{ ::skr::NameLiteral(literal) }; return __name; }())
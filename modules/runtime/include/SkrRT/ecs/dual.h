@@ -52,6 +52,7 @@ enum dual_type_flags SKR_IF_CPP(: uint32_t)
 {
     DTF_PIN = 0x1,
     DTF_CHUNK = 0x2,
+    DTF_SIMD = 0x4,
 };
 
 enum dual_callback_flags SKR_IF_CPP(: uint32_t)
@@ -74,6 +75,7 @@ typedef struct dual_type_description_t {
     /**
      * a pinned component will not removed when destroying or copy when instantiating, and user should remove them manually
      * destroyed entity with pinned component will be marked by a dead component and will be erased when all pinned component is removed
+     * archetypes containing a DTF_SIMD component use the simd chunk layout, @see dualS_set_simd_layout
      */
     uint32_t flags;
     /**
@@ -285,6 +287,15 @@ SKR_RUNTIME_API void dualS_release(dual_storage_t* storage);
 * @return void
 */
 SKR_RUNTIME_API void dualS_set_userdata(dual_storage_t* storage, void* u);
+/**
+ * @brief use simd chunk layout for every archetype created after this call
+ * simd layout aligns every component column to dual::kSimdColumnAlignment bytes and rounds chunk capacity down to
+ * a multiple of dual::kSimdLaneCount, so kernels can process whole chunks with aligned vector loads,
+ * slots between count and capacity stay readable. archetypes containing a DTF_SIMD component always use it
+ * @param storage
+ * @param enable
+ */
+SKR_RUNTIME_API void dualS_set_simd_layout(dual_storage_t* storage, bool enable);
 /**
  * @brief get userdata of storage
  *
@@ -399,6 +410,34 @@ SKR_RUNTIME_API void dualS_access(dual_storage_t* storage, dual_entity_t ent, du
  * @param callback callback for each batched chunk view
  */
 SKR_RUNTIME_API void dualS_batch(dual_storage_t* storage, const dual_entity_t* ents, EIndex count, dual_view_callback_t callback, void* u);
+/**
+ * @brief get the chunk views of scattered entities
+ * sort entities by (group, chunk, index) so an unordered list is merged into the fewest chunk views, 
+ * views are reported back to front inside each chunk so the callback can destroy or cast them
+ * @param storage
+ * @param ents
+ * @param count
+ * @param callback callback for each batched chunk view
+ */
+SKR_RUNTIME_API void dualS_batch_scattered(dual_storage_t* storage, const dual_entity_t* ents, EIndex count, dual_view_callback_t callback, void* u);
+/**
+ * @brief destroy entities
+ * destroy an unordered entity list, entities are grouped into chunk views first
+ * @param storage
+ * @param ents
+ * @param count
+ */
+SKR_RUNTIME_API void dualS_destroy_entities(dual_storage_t* storage, const dual_entity_t* ents, EIndex count);
+/**
+ * @brief change entities' type
+ * cast an unordered entity list, entities are grouped into chunk views and the target group is resolved once per source group
+ * @param storage
+ * @param ents
+ * @param count
+ * @param delta
+ * @param callback optional callback before casting chunk view
+ */
+SKR_RUNTIME_API void dualS_cast_entities_delta(dual_storage_t* storage, const dual_entity_t* ents, EIndex count, const dual_delta_type_t* delta, dual_cast_callback_t callback, void* u);
 /**
  * @brief get all chunk view matching given filter
  *
@@ -723,6 +762,13 @@ SKR_RUNTIME_API void dualS_disable_components(const dual_chunk_view_t* view, con
  */
 SKR_RUNTIME_API void dualS_set_version(dual_storage_t* storage, uint64_t number);
 
+/**
+ * @brief get version of storage, advance it with dualS_set_version(storage, dualS_get_version(storage) + 1) when several systems detect changes
+ *
+ * @param storage
+ */
+SKR_RUNTIME_API uint64_t dualS_get_version(dual_storage_t* storage);
+
 /**
  * @brief get group of chunk
  *
@@ -741,6 +787,20 @@ SKR_RUNTIME_API dual_storage_t* dualC_get_storage(const dual_chunk_t* chunk);
  * @param chunk
  */
 SKR_RUNTIME_API uint32_t dualC_get_count(const dual_chunk_t* chunk);
+/**
+ * @brief get capacity of chunk, multiple of dual::kSimdLaneCount when chunk uses simd layout
+ *
+ * @param chunk
+ */
+SKR_RUNTIME_API uint32_t dualC_get_capacity(const dual_chunk_t* chunk);
+/**
+ * @brief get the storage version at which a component of chunk was last accessed for write or had entities constructed or moved into it
+ * @see dualS_set_version
+ * @param chunk
+ * @param type
+ * @return 0 if the component is not owned by chunk
+ */
+SKR_RUNTIME_API uint32_t dualC_get_timestamp(const dual_chunk_t* chunk, dual_type_index_t type);
 
 
 SKR_RUNTIME_API void dual_set_bit(uint32_t* mask, int32_t bit);
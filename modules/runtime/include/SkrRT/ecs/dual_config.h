@@ -53,5 +53,5 @@ SKR_RUNTIME_API extern const char* kDualMemoryName;
 #define dual_calloc_aligned(count, size, alignment) sakura_calloc_alignedN((count), (size), (alignment), kDualMemoryName)
 #define dual_memalign dual_malloc_aligned
 #define dual_free(ptr) sakura_freeN((ptr), kDualMemoryName)
-#define dual_free_aligned(p, alignment) sakura_free_aligned((p), (alignment), kDualMemoryName)
+#define dual_free_aligned(p, alignment) sakura_free_alignedN((p), (alignment), kDualMemoryName)
 #define dual_realloc(p, newsize) sakura_reallocN((p), (newsize), kDualMemoryName)
\ No newline at end of file
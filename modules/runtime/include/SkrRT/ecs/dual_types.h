@@ -43,6 +43,9 @@ namespace dual
 
 [[maybe_unused]] static constexpr size_t kGroupBlockSize = 128 * 4;
 [[maybe_unused]] static constexpr size_t kGroupBlockCount = 256;
+[[maybe_unused]] static constexpr size_t kGroupTransitionCount = 8;
+[[maybe_unused]] static constexpr uint32_t kSimdColumnAlignment = 64;
+[[maybe_unused]] static constexpr uint32_t kSimdLaneCount = 16;
 [[maybe_unused]] static constexpr size_t kStorageArenaSize = 128 * 128;
 [[maybe_unused]] static constexpr size_t kLinkComponentSize = 8;
 
@@ -64,14 +64,43 @@ typedef enum ESkrIOEndpoint
     SKR_IO_ENDPOINT_MAX_ENUM = UINT32_MAX
 } ESkrIOEndpoint;
 
+// bandwidth classes, lower values are dispatched first when several classes wait
+typedef enum ESkrIOQoSClass
+{
+    // latency critical streaming
+    SKR_IO_QOS_CLASS_STREAMING,
+    SKR_IO_QOS_CLASS_DEFAULT,
+    // bulk work like prefetch, cache warmup and save games
+    SKR_IO_QOS_CLASS_BACKGROUND,
+    SKR_IO_QOS_CLASS_COUNT,
+    SKR_IO_QOS_CLASS_MAX_ENUM = UINT32_MAX
+} ESkrIOQoSClass;
+
+typedef struct skr_io_qos_budget_t {
+    // sustained rate of the class, 0 for unlimited
+    uint64_t bytes_per_second SKR_IF_CPP(= 0);
+    // bytes the class can dispatch at once after idling, 0 for one second worth of bytes_per_second
+    uint64_t burst_bytes SKR_IF_CPP(= 0);
+} skr_io_qos_budget_t;
+
+typedef struct skr_io_qos_stats_t {
+    uint64_t dispatched_requests SKR_IF_CPP(= 0);
+    uint64_t dispatched_bytes SKR_IF_CPP(= 0);
+    // dispatches held back because the class was over its budget
+    uint64_t throttled_count SKR_IF_CPP(= 0);
+} skr_io_qos_stats_t;
+
 typedef struct skr_guid_t skr_io_decompress_method_t;
 typedef struct skr_guid_t skr_io_request_resolve_pass_t;
 
 typedef struct skr_io_future_t {
     SAtomicU32 status SKR_IF_CPP(= 0);
     SAtomicU32 request_cancel SKR_IF_CPP(= 0);
+    // the source could not be read (e.g. missing file), the request still completes with nothing loaded
+    SAtomicU32 failed SKR_IF_CPP(= 0);
 #ifdef __cplusplus
     SKR_RUNTIME_API bool is_ready() const SKR_NOEXCEPT;
+    SKR_RUNTIME_API bool is_failed() const SKR_NOEXCEPT;
     SKR_RUNTIME_API bool is_enqueued() const SKR_NOEXCEPT;
     SKR_RUNTIME_API bool is_cancelled() const SKR_NOEXCEPT;
     SKR_RUNTIME_API bool is_loading() const SKR_NOEXCEPT;
@@ -127,6 +156,9 @@ struct SKR_RUNTIME_API IIORequest : public skr::SInterface
 
     virtual void add_callback(ESkrIOStage stage, IOCallback callback, void* data) SKR_NOEXCEPT = 0;
     virtual void add_finish_callback(ESkrIOFinishPoint point, IOCallback callback, void* data) SKR_NOEXCEPT = 0;
+
+    virtual void set_qos_class(ESkrIOQoSClass qos) SKR_NOEXCEPT = 0;
+    virtual ESkrIOQoSClass get_qos_class() const SKR_NOEXCEPT = 0;
 #pragma endregion
 };
 using IORequestId = SObjectPtr<IIORequest>;
@@ -234,6 +266,18 @@ struct SKR_RUNTIME_API IIOService
     // get service status (sleeping or running)
     virtual SkrAsyncServiceStatus get_service_status() const SKR_NOEXCEPT = 0;
 
+    // limit the bandwidth of a qos class, requests of the class wait for tokens before they are read or uploaded
+    virtual void set_qos_budget(ESkrIOQoSClass qos, const skr_io_qos_budget_t& budget) SKR_NOEXCEPT = 0;
+
+    // bytes and requests dispatched per qos class since the service was created
+    virtual skr_io_qos_stats_t get_qos_stats(ESkrIOQoSClass qos) const SKR_NOEXCEPT = 0;
+
+    // record every request enqueued from now on into a binary trace file, see SkrRT/io/io_trace.hpp
+    virtual bool begin_trace(skr_vfs_t* vfs, const char8_t* path) SKR_NOEXCEPT = 0;
+
+    // flush and close the trace, requests still in flight are not recorded
+    virtual void end_trace() SKR_NOEXCEPT = 0;
+
     virtual ~IIOService() SKR_NOEXCEPT = default;
     IIOService() SKR_NOEXCEPT = default;
 };
@@ -0,0 +1,39 @@
+#pragma once
+#include "SkrRT/io/io.h"
+#include "SkrRT/containers/string.hpp"
+#include "SkrRT/containers/vector.hpp"
+
+namespace skr {
+namespace io {
+
+// a finished request of a session recorded with IIOService::begin_trace
+// times are microseconds since the trace began
+struct IOTraceRecord
+{
+    static constexpr uint64_t kStageSkipped = UINT64_MAX;
+
+    ESkrIOEndpoint endpoint = SKR_IO_ENDPOINT_RAM;
+    SkrAsyncServicePriority priority = SKR_ASYNC_SERVICE_PRIORITY_NORMAL;
+    ESkrIOQoSClass qos_class = SKR_IO_QOS_CLASS_DEFAULT;
+    // SKR_IO_STAGE_COMPLETED or SKR_IO_STAGE_CANCELLED
+    ESkrIOStage final_stage = SKR_IO_STAGE_COMPLETED;
+    uint64_t bytes = 0;
+    // kStageSkipped for stages the request never entered
+    uint64_t stage_usecs[SKR_IO_STAGE_COUNT];
+    // relative to the mount dir of the vfs the request was issued with
+    skr::string path;
+    // resolved ranges, empty for requests without blocks (whole file)
+    skr::vector<skr_io_block_t> blocks;
+
+    uint64_t get_enqueue_usec() const SKR_NOEXCEPT { return stage_usecs[SKR_IO_STAGE_ENQUEUED]; }
+    uint64_t get_latency_usec() const SKR_NOEXCEPT { return stage_usecs[final_stage] - stage_usecs[SKR_IO_STAGE_ENQUEUED]; }
+};
+
+struct SKR_RUNTIME_API IOTrace
+{
+    // reads a trace file, records are sorted by enqueue time
+    static bool Load(skr_vfs_t* vfs, const char8_t* path, skr::vector<IOTraceRecord>& records) SKR_NOEXCEPT;
+};
+
+} // namespace io
+} // namespace skr
@@ -10,6 +10,7 @@ typedef struct skr_ram_io_service_desc_t {
     skr_job_queue_id callback_job_queue SKR_IF_CPP(= nullptr);
     bool awake_at_request SKR_IF_CPP(= true);
     bool use_dstorage SKR_IF_CPP(= true);
+    skr_io_qos_budget_t qos_budgets[SKR_IO_QOS_CLASS_COUNT];
 } skr_ram_io_service_desc_t;
 
 namespace skr {
@@ -42,6 +43,10 @@ struct SKR_RUNTIME_API IBlocksRAMRequest : public IIORequest
 #pragma region BlocksComponent
     virtual skr::span<skr_io_block_t> get_blocks() SKR_NOEXCEPT = 0;
     virtual void add_block(const skr_io_block_t& block) SKR_NOEXCEPT = 0;
+    // reads the block straight into caller memory (final resource storage, mapped upload memory...)
+    // instead of the returned buffer, which then only holds the other blocks.
+    // block.size must be set, the memory must stay valid until the request completes or is cancelled
+    virtual void add_block(const skr_io_block_t& block, uint8_t* destination) SKR_NOEXCEPT = 0;
     virtual void reset_blocks() SKR_NOEXCEPT = 0;
 #pragma endregion
 
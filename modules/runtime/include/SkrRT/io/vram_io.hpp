@@ -13,6 +13,7 @@ typedef struct skr_vram_io_service2_desc_t {
     skr_job_queue_id callback_job_queue SKR_IF_CPP(= nullptr);
     bool awake_at_request SKR_IF_CPP(= true);
     bool use_dstorage SKR_IF_CPP(= true);
+    skr_io_qos_budget_t qos_budgets[SKR_IO_QOS_CLASS_COUNT];
 } skr_vram_io_service2_desc_t;
 
 #ifdef __cplusplus
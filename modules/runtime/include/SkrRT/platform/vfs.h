@@ -12,6 +12,8 @@ typedef enum ESkrFileMode
     SKR_FM_APPEND = 1 << 2,
     SKR_FM_BINARY = 1 << 3,
     SKR_FM_ALLOW_READ = 1 << 4, // Read Access to Other Processes, Usefull for Log System
+    SKR_FM_DIRECT = 1 << 5, // Bypass the OS page cache where supported (O_DIRECT/F_NOCACHE), reads should be sector aligned
+    SKR_FM_SEQUENTIAL = 1 << 6, // Streaming access hint, lets the OS read ahead aggressively
     SKR_FM_READ_WRITE = SKR_FM_READ | SKR_FM_WRITE,
     SKR_FM_READ_APPEND = SKR_FM_READ | SKR_FM_APPEND,
     SKR_FM_WRITE_BINARY = SKR_FM_WRITE | SKR_FM_BINARY,
@@ -137,7 +139,7 @@ SKR_RUNTIME_API void skr_vfs_get_native_procs(struct skr_vfs_proctable_t* procs)
 
 static FORCEINLINE const char8_t* skr_vfs_filemode_to_string(ESkrFileMode mode)
 {
-    mode = (ESkrFileMode)(mode & ~SKR_FM_ALLOW_READ);
+    mode = (ESkrFileMode)(mode & ~(SKR_FM_ALLOW_READ | SKR_FM_DIRECT | SKR_FM_SEQUENTIAL));
     switch (mode)
     {
         case SKR_FM_READ: return u8"r";
@@ -155,7 +157,7 @@ static FORCEINLINE const char8_t* skr_vfs_filemode_to_string(ESkrFileMode mode)
 }
 static FORCEINLINE const char8_t* skr_vfs_overwirte_filemode_to_string(ESkrFileMode mode)
 {
-    switch (mode)
+    switch (mode & ~(SKR_FM_ALLOW_READ | SKR_FM_DIRECT | SKR_FM_SEQUENTIAL))
     {
         case SKR_FM_READ_WRITE:
             return u8"w+";
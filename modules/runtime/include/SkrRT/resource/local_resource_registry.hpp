@@ -1,15 +1,66 @@
 #pragma once
 #include "SkrRT/misc/types.h"
+#include "SkrRT/platform/guid.hpp"
+#include "SkrRT/containers/hashmap.hpp"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/containers/string.hpp"
+#include "SkrRT/io/ram_io.hpp"
+#include "SkrRT/resource/resource_header.hpp"
 #include "resource_system.h"
 
 struct skr_vfs_t;
 namespace skr::resource
 {
 struct SKR_RUNTIME_API SLocalResourceRegistry : SResourceRegistry {
-    SLocalResourceRegistry(skr_vfs_t* vfs);
-    virtual ~SLocalResourceRegistry() = default;
+    // ram_service: headers are read through it in batches, falls back to the resource system's service when null
+    SLocalResourceRegistry(skr_vfs_t* vfs, skr_io_ram_service_t* ram_service = nullptr);
+    virtual ~SLocalResourceRegistry();
     bool RequestResourceFile(SResourceRequest* request) override;
     void CancelRequestFile(SResourceRequest* requst) override;
+    void Update() override;
+
+    // fill the header cache from a per-project index, requests found there never touch the .rh files
+    bool LoadHeaderIndex(const char8_t* path);
+    // write every cached header to an index that LoadHeaderIndex can read back
+    bool SaveHeaderIndex(const char8_t* path);
+    void ClearHeaderCache();
+    // resolve the resources of a bundle written by the resource compiler to ranges of the bundle file,
+    // their headers are cached too so neither .rh nor .bin files are touched
+    bool LoadBundleIndex(const char8_t* path);
+
+    // where the payload of a resource is read from, a range of a loaded bundle or its whole <guid>.bin
+    struct ResourceLocation {
+        skr::string uri;
+        uint64_t offset = 0;
+        uint64_t size = kReadToEnd;
+    };
+    ResourceLocation ResolveLocation(const skr_guid_t& guid);
+
     skr_vfs_t* vfs;
+    skr_io_ram_service_t* ram_service = nullptr;
+
+protected:
+    struct HeaderRead {
+        SResourceRequest* request = nullptr;
+        skr_guid_t guid;
+        skr_io_future_t future;
+        skr::io::RAMIOBufferId buffer;
+    };
+    bool ReadHeaderFile(const skr_guid_t& guid, skr_resource_header_t& header);
+    void FinishRequest(SResourceRequest* request, const skr_resource_header_t& header);
+
+    SMutexObject headerMutex;
+    skr::flat_hash_map<skr_guid_t, skr_resource_header_t, skr::guid::hash> headerCache;
+    struct BundleLocation {
+        uint32_t bundle = 0;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+    // guarded by headerMutex
+    skr::vector<skr::string> bundleUris;
+    skr::flat_hash_map<skr_guid_t, BundleLocation, skr::guid::hash> bundleLocations;
+    // requested this update, submitted as one batch from Update()
+    skr::vector<HeaderRead*> queuedReads;
+    skr::vector<HeaderRead*> inflightReads;
 };
-} // namespace skr::resource
\ No newline at end of file
+} // namespace skr::resource
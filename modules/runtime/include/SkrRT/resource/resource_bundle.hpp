@@ -0,0 +1,33 @@
+#pragma once
+#include "SkrRT/containers/string.hpp"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/resource/resource_header.hpp"
+#include <EASTL/vector.h>
+
+namespace skr::resource
+{
+// cooked resource data laid out back to back in first access order, so a level streams
+// front to back instead of seeking between hundreds of <guid>.bin files
+struct SResourceBundleEntry {
+    skr_resource_header_t header;
+    // range of the .bin payload inside the bundle file
+    uint64_t offset = 0;
+    uint64_t size = 0;
+};
+
+// index written next to a bundle by the resource compiler, see SLocalResourceRegistry::LoadBundleIndex
+struct SKR_RUNTIME_API SResourceBundleIndex {
+    static constexpr uint32_t kMagic = 0x4C444E42; // "BNDL"
+    static constexpr uint32_t kVersion = 1;
+    // entry offsets are multiples of it so they can be read unbuffered
+    static constexpr uint32_t kDefaultAlignment = 4096;
+
+    // relative to the resource vfs
+    skr::string bundle_uri;
+    uint32_t alignment = kDefaultAlignment;
+    skr::vector<SResourceBundleEntry> entries;
+
+    bool Read(skr::span<const uint8_t> data);
+    void Write(eastl::vector<uint8_t>& buffer) const;
+};
+} // namespace skr::resource
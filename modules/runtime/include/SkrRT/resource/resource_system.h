@@ -78,10 +78,16 @@ protected:
 
 struct SKR_RUNTIME_API SResourceRegistry {
 public:
+    virtual ~SResourceRegistry() = default;
+    // may resolve the request right away or later from Update(), either way through request->OnRequestFileFinished()
     virtual bool RequestResourceFile(SResourceRequest* request) = 0;
     virtual void CancelRequestFile(SResourceRequest* requst) = 0;
+    // called by the resource system around each request update to flush and poll pending lookups
+    virtual void Update() {}
 
-    void FillRequest(SResourceRequest* request, skr_resource_header_t header, skr_vfs_t* vfs, const char8_t* uri);
+    static constexpr uint64_t kReadToEnd = UINT64_MAX;
+    // kReadToEnd reads the file from offset to its end, size 0 is an empty payload and skips the io
+    void FillRequest(SResourceRequest* request, skr_resource_header_t header, skr_vfs_t* vfs, const char8_t* uri, uint64_t offset = 0, uint64_t size = kReadToEnd);
 };
 
 struct SKR_RUNTIME_API SResourceSystem {
@@ -2,6 +2,9 @@
 #include "cgpu/api.h"
 
 typedef const char8_t* CGPUXName;
+// index of a name in CGPUXBindTableDescriptor::names, resolve once and update by slot afterwards
+typedef uint32_t CGPUXBindTableSlot;
+#define CGPUX_INVALID_BIND_TABLE_SLOT UINT32_MAX
 DEFINE_CGPU_OBJECT(CGPUXBindTable)
 DEFINE_CGPU_OBJECT(CGPUXMergedBindTable)
 struct CGPUXBindTableDescriptor;
@@ -13,6 +16,12 @@ CGPUXBindTableId cgpux_create_bind_table(CGPUDeviceId device, const struct CGPUX
 SKR_EXTERN_C CGPU_API
 void cgpux_bind_table_update(CGPUXBindTableId table, const struct CGPUDescriptorData* datas, uint32_t count);
 
+SKR_EXTERN_C CGPU_API
+CGPUXBindTableSlot cgpux_bind_table_find_slot(CGPUXBindTableId table, CGPUXName name);
+
+SKR_EXTERN_C CGPU_API
+void cgpux_bind_table_update_slots(CGPUXBindTableId table, const CGPUXBindTableSlot* slots, const struct CGPUDescriptorData* datas, uint32_t count);
+
 SKR_EXTERN_C CGPU_API
 void cgpux_render_encoder_bind_bind_table(CGPURenderPassEncoderId encoder, CGPUXBindTableId table);
 
@@ -41,6 +50,10 @@ typedef struct CGPUXBindTableDescriptor {
     CGPURootSignatureId root_signature;
     const CGPUXName* names;
     uint32_t names_count;
+    // descriptor set versions per set, an update rewrites the next version instead of the bound one.
+    // must cover the updates that can be in flight (e.g. frames in flight for per-frame updates),
+    // 0 or 1 updates the sets in place
+    uint32_t versions_count;
 } CGPUXBindTableDescriptor;
 
 typedef struct CGPUXMergedBindTableDescriptor {
@@ -46,7 +46,12 @@ public:
     CGPU_API static CGPUXBindTableId Create(CGPUDeviceId device, const struct CGPUXBindTableDescriptor* desc) SKR_NOEXCEPT;
     CGPU_API static void Free(CGPUXBindTableId table) SKR_NOEXCEPT;
 
+    // slow path, hashes every name, prefer FindSlot once + UpdateSlots
     CGPU_API void Update(const struct CGPUDescriptorData* datas, uint32_t count) SKR_NOEXCEPT;
+    // @retval CGPUX_INVALID_BIND_TABLE_SLOT if the name is not in the table or not used by the root signature
+    CGPU_API CGPUXBindTableSlot FindSlot(CGPUXName name) const SKR_NOEXCEPT;
+    // datas[i].name is ignored, slots[i] tells where it goes
+    CGPU_API void UpdateSlots(const CGPUXBindTableSlot* slots, const struct CGPUDescriptorData* datas, uint32_t count) SKR_NOEXCEPT;
     CGPU_API void Bind(CGPURenderPassEncoderId encoder) const SKR_NOEXCEPT;
     CGPU_API void Bind(CGPUComputePassEncoderId encoder) const SKR_NOEXCEPT;
 
@@ -54,9 +59,15 @@ public:
     {
         return root_signature;
     }
+    // currently bound version of the set, nullptr if the table writes nothing to it
+    inline CGPUDescriptorSetId GetDescriptorSet(uint32_t set_index) const SKR_NOEXCEPT
+    {
+        return sets[set_index];
+    }
 
 protected:
-    void updateDescSetsIfDirty() const SKR_NOEXCEPT;
+    void updateSlot(CGPUXBindTableSlot slot, const CGPUDescriptorData& data) SKR_NOEXCEPT;
+    void updateDescSetsIfDirty() SKR_NOEXCEPT;
 
     CGPURootSignatureId root_signature = nullptr;
     // flatten name hashes 
@@ -65,9 +76,15 @@ protected:
     CGPUXBindTableLocation* name_locations = nullptr;
     // count of flattened name hashes
     uint32_t names_count = 0;
-    // all sets
+    // all sets, the currently bound version of each
     uint32_t sets_count = 0;
     CGPUDescriptorSetId* sets = nullptr;
+    // sets_count * versions_count, created on first use
+    CGPUDescriptorSetId* set_versions = nullptr;
+    uint32_t* current_versions = nullptr;
+    uint32_t versions_count = 1;
+    // bit i: set i has locations that are not written yet
+    uint32_t dirty_sets = 0;
 };
 
 struct CGPUXMergedBindTable
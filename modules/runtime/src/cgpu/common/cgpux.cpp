@@ -39,28 +39,42 @@ void CGPUXBindTableValue::Initialize(const CGPUXBindTableLocation& loc, const CG
     }
 }
 
+static constexpr uint32_t kInvalidBindTableSet = UINT32_MAX;
+
 CGPUXBindTableId CGPUXBindTable::Create(CGPUDeviceId device, const struct CGPUXBindTableDescriptor* desc) SKR_NOEXCEPT
 {
     auto rs = desc->root_signature;
+    SKR_ASSERT(rs->table_count <= 32 && "dirty sets are tracked in a 32-bit mask");
+    const auto versions_count = desc->versions_count ? desc->versions_count : 1;
     const auto hashes_size = desc->names_count * sizeof(uint64_t);
     const auto locations_size = desc->names_count * sizeof(CGPUXBindTableLocation);
     const auto sets_size = rs->table_count * sizeof(CGPUDescriptorSetId);
-    const auto total_size = sizeof(CGPUXBindTable) + hashes_size + locations_size + sets_size;
+    const auto versions_size = rs->table_count * versions_count * sizeof(CGPUDescriptorSetId);
+    const auto current_versions_size = rs->table_count * sizeof(uint32_t);
+    const auto total_size = sizeof(CGPUXBindTable) + hashes_size + locations_size + sets_size + versions_size + current_versions_size;
     CGPUXBindTable* table = (CGPUXBindTable*)cgpu_calloc_aligned(1, total_size, alignof(CGPUXBindTable));
     uint64_t* pHashes = (uint64_t*)(table + 1);
     CGPUXBindTableLocation* pLocations = (CGPUXBindTableLocation*)(pHashes + desc->names_count);
     CGPUDescriptorSetId* pSets = (CGPUDescriptorSetId*)(pLocations + desc->names_count);
+    CGPUDescriptorSetId* pSetVersions = pSets + rs->table_count;
+    uint32_t* pCurrentVersions = (uint32_t*)(pSetVersions + rs->table_count * versions_count);
     table->names_count = desc->names_count;
     table->name_hashes = pHashes;
     table->name_locations = pLocations;
     table->sets_count = rs->table_count;
     table->sets = pSets;
+    table->set_versions = pSetVersions;
+    table->current_versions = pCurrentVersions;
+    table->versions_count = versions_count;
     table->root_signature = desc->root_signature;
     // calculate hashes for each name
     for (uint32_t i = 0; i < desc->names_count; i++)
     {
         const auto name = desc->names[i];
         pHashes[i] = cgpu_name_hash(name, strlen((const char*)name));
+        // names the root signature does not use stay unresolved
+        new (pLocations + i) CGPUXBindTableLocation();
+        const_cast<uint32_t&>(pLocations[i].tbl_idx) = kInvalidBindTableSet;
     }
     // calculate active sets
     for (uint32_t setIdx = 0; setIdx < rs->table_count; setIdx++)
@@ -74,7 +88,6 @@ CGPUXBindTableId CGPUXBindTable::Create(CGPUDeviceId device, const struct CGPUXB
                 if (hash == pHashes[k])
                 {
                     // initialize location set/binding
-                    new (pLocations + k) CGPUXBindTableLocation();
                     const_cast<uint32_t&>(pLocations[k].tbl_idx) = setIdx;
                     const_cast<uint32_t&>(pLocations[k].binding) = res.binding;
 
@@ -84,6 +97,7 @@ CGPUXBindTableId CGPUXBindTable::Create(CGPUDeviceId device, const struct CGPUXB
                     if (!pSets[setIdx]) 
                     {
                         pSets[setIdx] = cgpu_create_descriptor_set(device, &setDesc);
+                        pSetVersions[setIdx * versions_count] = pSets[setIdx];
                     }
                     break;
                 }
@@ -93,66 +107,97 @@ CGPUXBindTableId CGPUXBindTable::Create(CGPUDeviceId device, const struct CGPUXB
     return table;
 }
 
+CGPUXBindTableSlot CGPUXBindTable::FindSlot(CGPUXName name) const SKR_NOEXCEPT
+{
+    const auto name_hash = cgpu_name_hash(name, strlen((const char*)name));
+    for (uint32_t j = 0; j < names_count; j++)
+    {
+        if (name_hash == name_hashes[j])
+            return name_locations[j].tbl_idx != kInvalidBindTableSet ? j : CGPUX_INVALID_BIND_TABLE_SLOT;
+    }
+    return CGPUX_INVALID_BIND_TABLE_SLOT;
+}
+
 void CGPUXBindTable::Update(const struct CGPUDescriptorData* datas, uint32_t count) SKR_NOEXCEPT
 {
     for (uint32_t i = 0; i < count; i++)
     {
-        bool updated = false;
         const auto& data = datas[i];
         if (data.name)
         {
-            const auto name_hash = cgpu_name_hash(data.name, strlen((const char*)data.name));
-            for (uint32_t j = 0; j < names_count; j++)
-            {
-                if (name_hash == name_hashes[j])
-                {
-                    const auto& location = name_locations[j];
-                    if (!cgpux::equal_to<CGPUDescriptorData>()(data, location.value.data))
-                    {
-                        auto& loc = name_locations[j];
-                        loc.value.Initialize(loc, data);
-                    }
-                    updated = true;
-                    break;
-                }
-            }
+            const auto slot = FindSlot(data.name);
+            if (slot != CGPUX_INVALID_BIND_TABLE_SLOT)
+                updateSlot(slot, data);
         }
         else
         {
             SKR_UNREACHABLE_CODE();
         }
-        (void)updated;
     }
     updateDescSetsIfDirty();
 }
 
-#include <EASTL/fixed_set.h>
+void CGPUXBindTable::UpdateSlots(const CGPUXBindTableSlot* slots, const struct CGPUDescriptorData* datas, uint32_t count) SKR_NOEXCEPT
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (slots[i] == CGPUX_INVALID_BIND_TABLE_SLOT)
+            continue;
+        SKR_ASSERT(slots[i] < names_count);
+        // names the root signature does not use can not be written
+        if (name_locations[slots[i]].tbl_idx != kInvalidBindTableSet)
+            updateSlot(slots[i], datas[i]);
+    }
+    updateDescSetsIfDirty();
+}
 
-void CGPUXBindTable::updateDescSetsIfDirty() const SKR_NOEXCEPT
+void CGPUXBindTable::updateSlot(CGPUXBindTableSlot slot, const CGPUDescriptorData& data) SKR_NOEXCEPT
 {
-    eastl::fixed_set<uint32_t, 4> needsUpdateIndices;
-    for (uint32_t i = 0; i < names_count; i++)
+    auto& loc = name_locations[slot];
+    // callers address by name, compare against the binding the value is stored with
+    auto incoming = data;
+    incoming.binding = loc.binding;
+    if (loc.value.data.count && cgpux::equal_to<CGPUDescriptorData>()(incoming, loc.value.data))
+        return;
+    loc.value.Initialize(loc, data);
+    dirty_sets |= 1u << loc.tbl_idx;
+}
+
+void CGPUXBindTable::updateDescSetsIfDirty() SKR_NOEXCEPT
+{
+    for (uint32_t setIdx = 0; dirty_sets; setIdx++)
     {
-        const auto& location = name_locations[i];
-        if (!location.value.binded)
+        const uint32_t bit = 1u << setIdx;
+        if (!(dirty_sets & bit))
+            continue;
+        dirty_sets &= ~bit;
+        // the bound version may still be in use by the gpu, move on to the next one.
+        // it holds values from an older update, so it is rewritten as a whole
+        const bool rotate = versions_count > 1;
+        if (rotate)
         {
-            needsUpdateIndices.insert(location.tbl_idx);
+            auto& version = current_versions[setIdx];
+            version = (version + 1) % versions_count;
+            auto& set = set_versions[setIdx * versions_count + version];
+            if (!set)
+            {
+                CGPUDescriptorSetDescriptor setDesc = {};
+                setDesc.root_signature = root_signature;
+                setDesc.set_index = setIdx;
+                set = cgpu_create_descriptor_set(root_signature->device, &setDesc);
+            }
+            sets[setIdx] = set;
         }
-    }
-    for (auto setIdx : needsUpdateIndices)
-    {
-        eastl::fixed_vector<CGPUDescriptorData, 4> datas;
+        eastl::fixed_vector<CGPUDescriptorData, 8> datas;
         for (uint32_t i = 0; i < names_count; i++)
         {
-            const auto& location = name_locations[i];
-            if (!location.value.binded && location.tbl_idx == setIdx)
+            auto& location = name_locations[i];
+            if (location.tbl_idx != setIdx || !location.value.data.count)
+                continue;
+            if (rotate || !location.value.binded)
             {
-                // const auto& set = sets[location.tbl_idx];
-                // TODO: batch update for better performance
-                // this update is kinda dangerous during draw-call because update-after-bind may happen
-                // TODO: fix this
                 datas.emplace_back(location.value.data);
-                const_cast<bool&>(location.value.binded) = true;
+                location.value.binded = true;
             }
         }
         const auto updateDataCount = static_cast<uint32_t>(datas.size());
@@ -185,9 +230,9 @@ void CGPUXBindTable::Bind(CGPUComputePassEncoderId encoder) const SKR_NOEXCEPT
 
 void CGPUXBindTable::Free(CGPUXBindTableId table) SKR_NOEXCEPT
 {
-    for (uint32_t i = 0; i < table->sets_count; i++)
+    for (uint32_t i = 0; i < table->sets_count * table->versions_count; i++)
     {
-        if (table->sets[i]) cgpu_free_descriptor_set(table->sets[i]);
+        if (table->set_versions[i]) cgpu_free_descriptor_set(table->set_versions[i]);
     }
     for (uint32_t i = 0; i < table->names_count; i++)
     {
@@ -207,6 +252,16 @@ void cgpux_bind_table_update(CGPUXBindTableId table, const struct CGPUDescriptor
     return ((CGPUXBindTable*)table)->Update(datas, count);
 }
 
+CGPUXBindTableSlot cgpux_bind_table_find_slot(CGPUXBindTableId table, CGPUXName name)
+{
+    return table->FindSlot(name);
+}
+
+void cgpux_bind_table_update_slots(CGPUXBindTableId table, const CGPUXBindTableSlot* slots, const struct CGPUDescriptorData* datas, uint32_t count)
+{
+    return ((CGPUXBindTable*)table)->UpdateSlots(slots, datas, count);
+}
+
 void cgpux_render_encoder_bind_bind_table(CGPURenderPassEncoderId encoder, CGPUXBindTableId table)
 {
     table->Bind(encoder);
@@ -438,7 +493,7 @@ size_t equal_to<CGPUDescriptorData>::operator()(const CGPUDescriptorData& a, con
     }
     if (a.buffers_params.sizes)
     {
-        if (a.buffers_params.sizes) 
+        if (!b.buffers_params.sizes) 
             return false;
         for (uint32_t i = 0; i < a.count; i++)
         {
@@ -930,6 +930,14 @@ CGPUTextureId cgpu_create_texture_vulkan(CGPUDeviceId device, const struct CGPUT
     info->is_imported = is_imported;
     info->is_tiled = (desc->flags & CGPU_TCF_TILED_RESOURCE) ? 1 : 0;
     info->unique_id = (unique_id == UINT64_MAX) ? D->super.next_texture_id++ : unique_id;
+    // Memory footprint, wrapped images (swapchain backbuffers) are not backed by our allocations
+    const bool is_wrapped = desc->native_handle && !(desc->flags & CGPU_INNER_TCF_IMPORT_SHARED_HANDLE);
+    if (T->pVkImage != VK_NULL_HANDLE && !is_wrapped)
+    {
+        VkMemoryRequirements memReqs = { 0 };
+        D->mVkDeviceTable.vkGetImageMemoryRequirements(D->pVkDevice, T->pVkImage, &memReqs);
+        info->size_in_bytes = memReqs.size;
+    }
     // Set Texture Name
     VkUtil_OptionalSetObjectName(D, (uint64_t)T->pVkImage, VK_OBJECT_TYPE_IMAGE, desc->name);
     // Start state
@@ -5,6 +5,7 @@
 #include "OpenString/format.cpp"
 
 #include "shared_rc.cpp"
+#include "name.cpp"
 
 namespace skr
 {
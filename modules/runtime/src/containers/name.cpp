@@ -0,0 +1,203 @@
+#include "SkrRT/containers/name.hpp"
+#include "SkrRT/platform/thread.h"
+#include "SkrRT/platform/memory.h"
+#include "SkrRT/platform/debug.h"
+#include <atomic>
+#include <new>
+#include <string.h>
+
+namespace skr
+{
+namespace name_detail
+{
+static constexpr const char* kNameTableMemoryName = "NameTable";
+static constexpr uint32_t kShardBits = 6;
+static constexpr uint32_t kShardCount = 1u << kShardBits;
+static constexpr uint32_t kInitialSlots = 64;
+static constexpr size_t kArenaBlockSize = 16 * 1024;
+
+// open addressing table, slots are only ever filled so readers can probe without locking
+struct Table
+{
+    uint32_t mask;
+    // grown tables are never freed, a reader may still be probing them
+    Table* retired;
+    std::atomic<const NameEntry*>* slots;
+};
+
+struct Shard
+{
+    std::atomic<Table*> table = nullptr;
+    uint32_t count = 0;
+    uint8_t* arena = nullptr;
+    size_t arena_left = 0;
+    SMutex mutex;
+
+    static inline uint32_t slot_of(uint32_t hash, uint32_t mask)
+    {
+        // low bits pick the shard, spread the rest over the slots
+        return (hash >> kShardBits) * 0x9E3779B1u >> 7 & mask;
+    }
+
+    static Table* create_table(uint32_t capacity)
+    {
+        auto table = (Table*)sakura_callocN(1, sizeof(Table) + sizeof(std::atomic<const NameEntry*>) * capacity, kNameTableMemoryName);
+        table->mask = capacity - 1;
+        table->slots = reinterpret_cast<std::atomic<const NameEntry*>*>(table + 1);
+        return table;
+    }
+
+    static const NameEntry* find(const Table* table, const char8_t* str, uint32_t size, uint32_t hash)
+    {
+        if (!table)
+            return nullptr;
+        for (uint32_t i = slot_of(hash, table->mask);; i = (i + 1) & table->mask)
+        {
+            const NameEntry* entry = table->slots[i].load(std::memory_order_acquire);
+            if (!entry)
+                return nullptr;
+            if (entry->hash == hash && entry->size == size && ::memcmp(entry->data(), str, size) == 0)
+                return entry;
+        }
+    }
+
+    static void insert(Table* table, const NameEntry* entry)
+    {
+        uint32_t i = slot_of(entry->hash, table->mask);
+        while (table->slots[i].load(std::memory_order_relaxed))
+            i = (i + 1) & table->mask;
+        table->slots[i].store(entry, std::memory_order_release);
+    }
+
+    NameEntry* allocate(const char8_t* str, uint32_t size, uint32_t hash)
+    {
+        const size_t bytes = (sizeof(NameEntry) + size + 1 + alignof(NameEntry) - 1) & ~(alignof(NameEntry) - 1);
+        uint8_t* memory = nullptr;
+        if (bytes > kArenaBlockSize / 4)
+        {
+            memory = (uint8_t*)sakura_mallocN(bytes, kNameTableMemoryName);
+        }
+        else
+        {
+            if (arena_left < bytes)
+            {
+                arena = (uint8_t*)sakura_mallocN(kArenaBlockSize, kNameTableMemoryName);
+                arena_left = kArenaBlockSize;
+            }
+            memory = arena;
+            arena += bytes;
+            arena_left -= bytes;
+        }
+        auto entry = new (memory) NameEntry();
+        entry->hash = hash;
+        entry->size = size;
+        char8_t* data = (char8_t*)(entry + 1);
+        ::memcpy(data, str, size);
+        data[size] = 0;
+        return entry;
+    }
+
+    const NameEntry* intern(const char8_t* str, uint32_t size, uint32_t hash)
+    {
+        if (auto found = find(table.load(std::memory_order_acquire), str, size, hash))
+            return found;
+
+        SMutexLock guard(mutex);
+        Table* current = table.load(std::memory_order_relaxed);
+        if (auto found = find(current, str, size, hash))
+            return found;
+        // keep the load factor under 1/2 so probes stay short
+        if (!current || (count + 1) * 2 > current->mask + 1)
+        {
+            Table* grown = create_table(current ? (current->mask + 1) * 2 : kInitialSlots);
+            if (current)
+            {
+                for (uint32_t i = 0; i <= current->mask; i++)
+                {
+                    if (auto entry = current->slots[i].load(std::memory_order_relaxed))
+                        insert(grown, entry);
+                }
+                // old tables add up to less than the live one, keeping them is cheaper than reclaiming
+                grown->retired = current;
+            }
+            table.store(grown, std::memory_order_release);
+            current = grown;
+        }
+        auto entry = allocate(str, size, hash);
+        insert(current, entry);
+        count++;
+        return entry;
+    }
+};
+
+struct NameTable
+{
+    NameTable()
+    {
+        for (auto& shard : shards)
+            skr_init_mutex(&shard.mutex);
+    }
+    Shard shards[kShardCount];
+
+    static NameTable& Get()
+    {
+        // immortal, names may be used by static destructors
+        static NameTable* table = new (sakura_mallocN(sizeof(NameTable), kNameTableMemoryName)) NameTable();
+        return *table;
+    }
+};
+} // namespace name_detail
+
+uint32_t Name::Hash(const char8_t* str, uint32_t size) SKR_NOEXCEPT
+{
+    return skr::hash_crc32(std::basic_string_view<char8_t>(str, size));
+}
+
+Name::Name(const char8_t* str, uint32_t size) SKR_NOEXCEPT
+{
+    if (str && size)
+    {
+        const auto hash = Hash(str, size);
+        auto& shard = name_detail::NameTable::Get().shards[hash & (name_detail::kShardCount - 1)];
+        entry = shard.intern(str, size, hash);
+    }
+}
+
+Name::Name(const char8_t* str) SKR_NOEXCEPT
+    : Name(str, str ? (uint32_t)::strlen(reinterpret_cast<const char*>(str)) : 0)
+{
+}
+
+Name::Name(skr::string_view str) SKR_NOEXCEPT
+    : Name(str.raw().data(), (uint32_t)str.raw().size())
+{
+}
+
+Name::Name(const skr::string& str) SKR_NOEXCEPT
+    : Name(str.view())
+{
+}
+
+Name::Name(const NameLiteral& literal) SKR_NOEXCEPT
+{
+    if (literal.size)
+    {
+        auto& shard = name_detail::NameTable::Get().shards[literal.hash & (name_detail::kShardCount - 1)];
+        entry = shard.intern(literal.str, literal.size, literal.hash);
+    }
+}
+
+Name Name::Find(const char8_t* str, uint32_t size) SKR_NOEXCEPT
+{
+    if (!str || !size)
+        return Name();
+    const auto hash = Hash(str, size);
+    auto& shard = name_detail::NameTable::Get().shards[hash & (name_detail::kShardCount - 1)];
+    return Name(name_detail::Shard::find(shard.table.load(std::memory_order_acquire), str, size, hash));
+}
+
+Name Name::Find(const char8_t* str) SKR_NOEXCEPT
+{
+    return Find(str, str ? (uint32_t)::strlen(reinterpret_cast<const char*>(str)) : 0);
+}
+} // namespace skr
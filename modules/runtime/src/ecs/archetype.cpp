@@ -45,6 +45,7 @@ dual::archetype_t* dual_storage_t::construct_archetype(const dual_type_set_t& in
     proto.type = dual::clone(inType, buffer);
     proto.withMask = false;
     proto.withDirty = false;
+    proto.simdLayout = simdLayout;
     proto.sizeToPatch = 0;
     proto.firstChunkComponent = proto.type.length;
     forloop (i, 0, proto.type.length)
@@ -98,14 +99,25 @@ dual::archetype_t* dual_storage_t::construct_archetype(const dual_type_set_t& in
         proto.aligns[i] = desc.alignment;
         proto.stableOrder[i] = i;
         proto.entitySize += desc.size;
-        if(!ti.is_chunk())
-            padding += desc.alignment;
+        if (desc.flags & DTF_SIMD)
+            proto.simdLayout = true;
         if (!ti.is_chunk() && desc.entityFieldsCount != 0)
             proto.sizeToPatch += desc.size;
     }
     eastl::sort(proto.stableOrder, proto.stableOrder + proto.type.length, [&](SIndex lhs, SIndex rhs) {
         return guid_compare_t{}(guids[lhs], guids[rhs]);
     });
+    // chunk blocks are kSimdColumnAlignment aligned, simd layout aligns columns by address rather than by offset from data()
+    auto columnAligns = localStack.allocate<uint32_t>(proto.type.length);
+    const uint32_t header = proto.simdLayout ? (uint32_t)sizeof(dual_chunk_t) : 0;
+    forloop (i, 0, proto.type.length)
+    {
+        columnAligns[i] = proto.aligns[i];
+        if (proto.simdLayout && proto.sizes[i] != 0)
+            columnAligns[i] = std::max(columnAligns[i], kSimdColumnAlignment);
+        if (!type_index_t(proto.type.data[i]).is_chunk())
+            padding += columnAligns[i];
+    }
     size_t caps[] = { kSmallBinSize - sizeof(dual_chunk_t), kFastBinSize - sizeof(dual_chunk_t), kLargeBinSize - sizeof(dual_chunk_t) };
     const uint32_t versionSize = sizeof(uint32_t) * proto.type.length;
     forloop (i, 0, 3)
@@ -127,6 +139,8 @@ dual::archetype_t* dual_storage_t::construct_archetype(const dual_type_set_t& in
             }
         }
         capacity = (uint32_t)(ccOffset - padding) / proto.entitySize;
+        if (proto.simdLayout && capacity >= kSimdLaneCount)
+            capacity -= capacity % kSimdLaneCount;
         if (capacity == 0)
             continue;
         uint32_t offset = sizeof(dual_entity_t) * capacity;
@@ -137,7 +151,7 @@ dual::archetype_t* dual_storage_t::construct_archetype(const dual_type_set_t& in
             auto ti = type_index_t(t);
             if(!ti.is_chunk())
             {
-                offset = (uint32_t)(proto.aligns[id] * ((offset + proto.aligns[id] - 1) / proto.aligns[id]));
+                offset = (uint32_t)(columnAligns[id] * ((offset + header + columnAligns[id] - 1) / columnAligns[id])) - header;
                 offsets[id] = offset;
                 offset += proto.sizes[id] * capacity;
             }
@@ -158,6 +172,7 @@ dual::archetype_t* dual_storage_t::clone_archetype(archetype_t *src)
     proto.type = dual::clone(src->type, buffer);
     proto.withMask = src->withMask;
     proto.withDirty = src->withMask;
+    proto.simdLayout = src->simdLayout;
     proto.sizeToPatch = src->sizeToPatch;
     proto.firstChunkComponent = src->withMask;
     forloop (i, 0, 3)
@@ -262,6 +277,8 @@ dual_group_t* dual_storage_t::clone_group(dual_group_t* srcG)
     char* buffer = (char*)(&proto + 1);
     proto.type = dual::clone(srcG->type, buffer);
     proto.archetype = clone_archetype(srcG->archetype);
+    new (&proto.transitions) eastl::vector<dual::group_transition_t>();
+    proto.transitionCursor = 0;
     if (srcG->dead)
     {
         proto.dead = clone_group(srcG->dead);
@@ -320,6 +337,9 @@ dual_group_t* dual_storage_t::get_group(const dual_entity_type_t& type)
 void dual_storage_t::destruct_group(dual_group_t* group)
 {
     update_query_cache(group, false);
+    // other groups may have cached this one as a transition target
+    ++groupEpoch;
+    group->clear_transitions();
     groups.erase(group->type);
     groupPool.free(group);
 }
@@ -343,6 +363,9 @@ dual_chunk_t* dual_group_t::new_chunk(uint32_t hint)
         pt = PT_default;
     dual_chunk_t* chunk = dual_chunk_t::create(pt);
     add_chunk(chunk);
+    auto timestamps = chunk->timestamps();
+    forloop (i, 0, archetype->type.length)
+        timestamps[i] = archetype->storage->timestamp;
     construct_chunk(chunk);
     return chunk;
 }
@@ -448,6 +471,60 @@ void dual_group_t::clear()
     size = 0;
 }
 
+bool dual_group_t::find_transition(const dual_delta_type_t& delta, size_t hash, uint32_t epoch, dual_group_t*& target) noexcept
+{
+    using namespace dual;
+    if (transitionEpoch != epoch)
+    {
+        clear_transitions();
+        transitionEpoch = epoch;
+        return false;
+    }
+    for (auto& transition : transitions)
+    {
+        if (transition.hash == hash && equal(transition.delta.added, delta.added) && equal(transition.delta.removed, delta.removed))
+        {
+            target = transition.target;
+            return true;
+        }
+    }
+    return false;
+}
+
+void dual_group_t::add_transition(const dual_delta_type_t& delta, size_t hash, uint32_t epoch, dual_group_t* target)
+{
+    using namespace dual;
+    if (transitionEpoch != epoch)
+    {
+        clear_transitions();
+        transitionEpoch = epoch;
+    }
+    group_transition_t* transition;
+    if (transitions.size() < kGroupTransitionCount)
+        transition = &transitions.push_back();
+    else
+    {
+        // replace round robin, the working set of deltas per group is small
+        transition = &transitions[transitionCursor];
+        transitionCursor = (transitionCursor + 1) % kGroupTransitionCount;
+        sakura_free(transition->buffer);
+    }
+    transition->buffer = (char*)sakura_malloc(data_size(delta.added) + data_size(delta.removed));
+    char* buffer = transition->buffer;
+    transition->delta.added = clone(delta.added, buffer);
+    transition->delta.removed = clone(delta.removed, buffer);
+    transition->hash = hash;
+    transition->target = target;
+}
+
+void dual_group_t::clear_transitions()
+{
+    for (auto& transition : transitions)
+        sakura_free(transition.buffer);
+    transitions.set_capacity(0);
+    transitionCursor = 0;
+}
+
 TIndex dual_group_t::index(dual_type_index_t inType) const noexcept
 {
     using namespace dual;
@@ -30,6 +30,8 @@ struct archetype_t {
     uint32_t firstChunkComponent; //chunk component count
     bool withMask;
     bool withDirty;
+    // columns aligned to kSimdColumnAlignment, capacity is a multiple of kSimdLaneCount
+    bool simdLayout;
     /*
         uint32_t offsets[3][firstTag];
         uint32_t sizes[firstTag];
@@ -38,6 +40,14 @@ struct archetype_t {
     bool with_chunk_component() const noexcept;
     SIndex index(dual_type_index_t type) const noexcept;
 };
+
+// cached result of applying a delta to a group, delta arrays live in buffer
+struct group_transition_t {
+    size_t hash;
+    dual_delta_type_t delta;
+    dual_group_t* target;
+    char* buffer;
+};
 } // namespace dual
 
 // group chunks by archetype and meta
@@ -50,6 +60,10 @@ struct dual_group_t {
     dual::archetype_t* archetype;
     dual_group_t* dead;
     dual_group_t* cloned;
+    // recently resolved cast(group, delta), flushed when storage->groupEpoch changes
+    eastl::vector<dual::group_transition_t> transitions;
+    uint32_t transitionCursor;
+    uint32_t transitionEpoch;
 
     bool isDead;
     bool disabled;
@@ -71,6 +85,10 @@ struct dual_group_t {
 
     void clear();
 
+    bool find_transition(const dual_delta_type_t& delta, size_t hash, uint32_t epoch, dual_group_t*& target) noexcept;
+    void add_transition(const dual_delta_type_t& delta, size_t hash, uint32_t epoch, dual_group_t* target);
+    void clear_transitions();
+
     dual_chunk_t* get_first_free_chunk() const noexcept;
     dual_chunk_t* new_chunk(uint32_t hint);
     void add_chunk(dual_chunk_t* chunk);
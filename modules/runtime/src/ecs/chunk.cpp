@@ -63,4 +63,17 @@ uint32_t dualC_get_count(const dual_chunk_t* chunk)
 {
     return chunk->count;
 }
+
+uint32_t dualC_get_capacity(const dual_chunk_t* chunk)
+{
+    return chunk->type->chunkCapacity[chunk->pt];
+}
+
+uint32_t dualC_get_timestamp(const dual_chunk_t* chunk, dual_type_index_t type)
+{
+    auto id = chunk->type->index(type);
+    if (id == dual::kInvalidSIndex)
+        return 0;
+    return const_cast<dual_chunk_t*>(chunk)->timestamps()[id];
+}
 }
\ No newline at end of file
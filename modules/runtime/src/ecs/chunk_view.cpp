@@ -346,8 +346,18 @@ static void duplicate_impl(dual_chunk_view_t dstV, const dual_chunk_t* srcC, uin
     }
 }
 
+// entities constructed or moved into a chunk count as writes to every component, change detection sees them like new chunks
+static void stamp_chunk(dual_chunk_t* chunk) noexcept
+{
+    auto structure = chunk->type;
+    auto timestamps = chunk->timestamps();
+    for (SIndex i = 0; i < structure->type.length; ++i)
+        timestamps[i] = structure->storage->timestamp;
+}
+
 void construct_view(const dual_chunk_view_t& view) noexcept
 {
+    stamp_chunk(view.chunk);
     archetype_t* type = view.chunk->type;
     EIndex* offsets = type->offsets[(int)view.chunk->pt];
     uint32_t* sizes = type->sizes;
@@ -422,6 +432,7 @@ void move_view(const dual_chunk_view_t& view, EIndex srcStart) noexcept
 
 void move_view(const dual_chunk_view_t& dstV, const dual_chunk_t* srcC, uint32_t srcStart) noexcept
 {
+    stamp_chunk(dstV.chunk);
     archetype_t* type = dstV.chunk->type;
     EIndex* offsets = type->offsets[(int)dstV.chunk->pt];
     uint32_t* sizes = type->sizes;
@@ -439,6 +450,7 @@ void move_view(const dual_chunk_view_t& dstV, const dual_chunk_t* srcC, uint32_t
 
 void cast_view(const dual_chunk_view_t& dstV, dual_chunk_t* srcC, EIndex srcStart) noexcept
 {
+    stamp_chunk(dstV.chunk);
     archetype_t* srcType = srcC->type;
     archetype_t* dstType = dstV.chunk->type;
     EIndex* srcOffsets = srcType->offsets[srcC->pt];
@@ -571,6 +583,7 @@ void cast_view(const dual_chunk_view_t& dstV, dual_chunk_t* srcC, EIndex srcStar
 
 void duplicate_view(const dual_chunk_view_t& dstV, const dual_chunk_t* srcC, EIndex srcStart) noexcept
 {
+    stamp_chunk(dstV.chunk);
     archetype_t* srcType = srcC->type;
     archetype_t* dstType = dstV.chunk->type;
     EIndex* srcOffsets = srcType->offsets[srcC->pt];
@@ -663,6 +676,7 @@ void duplicate_view(const dual_chunk_view_t& dstV, const dual_chunk_t* srcC, EIn
 
 void clone_view(const dual_chunk_view_t& dstV, const dual_chunk_t* srcC, EIndex srcStart) noexcept
 {
+    stamp_chunk(dstV.chunk);
     archetype_t* srcType = srcC->type;
     archetype_t* dstType = dstV.chunk->type;
     EIndex* srcOffsets = srcType->offsets[srcC->pt];
@@ -1,4 +1,5 @@
 #include "SkrRT/ecs/dual_config.h"
+#include "SkrRT/ecs/dual_types.h"
 #include "pool.hpp"
 #include <EASTL/vector.h>
 #include <EASTL/numeric.h>
@@ -17,7 +18,7 @@ pool_t::~pool_t()
 {
     void* block;
     while (blocks.try_dequeue(block))
-        dual_free(block);
+        dual_free_aligned(block, kSimdColumnAlignment);
 }
 
 void* pool_t::allocate()
@@ -27,7 +28,8 @@ void* pool_t::allocate()
         return block;
     {
         ZoneScopedN("DualPoolAllocation");
-        return dual_calloc(1, blockSize);
+        // chunks are allocated from these blocks, keep them aligned for the simd chunk layout
+        return dual_calloc_aligned(1, blockSize, kSimdColumnAlignment);
     }
 }
 
@@ -35,7 +37,7 @@ void pool_t::free(void* block)
 {
     if (blocks.try_enqueue(block))
         return;
-    dual_free(block);
+    dual_free_aligned(block, kSimdColumnAlignment);
 }
 
 fixed_pool_t::fixed_pool_t(size_t blockSize, size_t blockCount)
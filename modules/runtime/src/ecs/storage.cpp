@@ -14,10 +14,13 @@
 #include "type_registry.hpp"
 
 dual_storage_t::dual_storage_t()
-    : archetypeArena(dual::get_default_pool())
+    : groupEpoch(0)
+    , archetypeArena(dual::get_default_pool())
     , queryBuildArena(dual::get_default_pool())
     , groupPool(dual::kGroupBlockSize, dual::kGroupBlockCount)
+    , timestamp(0)
     , scheduler(nullptr)
+    , simdLayout(false)
 {
 }
 
@@ -29,6 +32,8 @@ dual_storage_t::~dual_storage_t()
     for(auto q : queries)
         sakura_free((void*)q);
     reset();
+    for (auto iter : groups)
+        iter.second->clear_transitions();
 }
 
 void dual_storage_t::reset()
@@ -334,6 +339,8 @@ void dual_storage_t::validate_meta()
         validate(type.meta);
         groups.insert({ type, g });
     }
+    if (!groupsToFix.empty())
+        ++groupEpoch;
 }
 
 void dual_storage_t::validate(dual_entity_set_t& meta)
@@ -493,6 +500,8 @@ void dual_storage_t::pack_entities()
         std::sort((dual_entity_t*)meta.data, (dual_entity_t*)meta.data + meta.length);
         groups.insert({ g->type, g });
     }
+    // cached transitions are keyed by meta entities which were just remapped
+    ++groupEpoch;
 }
 
 void dual_storage_t::cast_impl(const dual_chunk_view_t& view, dual_group_t* group, dual_cast_callback_t callback, void* u)
@@ -582,6 +591,12 @@ void dual_storage_t::cast(dual_group_t* srcGroup, dual_group_t* group, dual_cast
 dual_group_t* dual_storage_t::cast(dual_group_t* srcGroup, const dual_delta_type_t& diff)
 {
     using namespace dual;
+    size_t deltaHash = hash(diff.added);
+    deltaHash = hash_append(deltaHash, (size_t)diff.added.type.length);
+    deltaHash = hash(diff.removed, deltaHash);
+    dual_group_t* target = nullptr;
+    if (srcGroup->find_transition(diff, deltaHash, groupEpoch, target))
+        return target;
     fixed_stack_scope_t _(localStack);
     dual_entity_type_t type = srcGroup->type;
     dual_entity_type_t final;
@@ -607,7 +622,9 @@ dual_group_t* dual_storage_t::cast(dual_group_t* srcGroup, const dual_delta_type
         auto finalMeta = localStack.allocate<dual_entity_t>(type.meta.length + diff.added.meta.length);
         final.meta = set_utils<dual_entity_t>::substract(final.meta, diff.removed.meta, finalMeta);
     }
-    return get_group(final);
+    target = get_group(final);
+    srcGroup->add_transition(diff, deltaHash, groupEpoch, target);
+    return target;
 }
 
 void dual_storage_t::batch(const dual_entity_t* ents, EIndex count, dual_view_callback_t callback, void* u)
@@ -640,6 +657,130 @@ void dual_storage_t::batch(const dual_entity_t* ents, EIndex count, dual_view_ca
     callback(u, &view);
 }
 
+namespace dual
+{
+// lsd radix sort on 8 bit digits, digits above the largest key are skipped
+// returns the buffer holding the sorted keys
+static uint64_t* radix_sort(uint64_t* keys, uint64_t* temp, EIndex count)
+{
+    uint64_t maxKey = 0;
+    forloop (i, 0, count)
+        maxKey |= keys[i];
+    for (uint32_t shift = 0; shift < 64 && (maxKey >> shift) != 0; shift += 8)
+    {
+        EIndex offsets[256] = {};
+        forloop (i, 0, count)
+            offsets[(keys[i] >> shift) & 0xFF]++;
+        EIndex sum = 0;
+        forloop (b, 0, 256)
+        {
+            EIndex n = offsets[b];
+            offsets[b] = sum;
+            sum += n;
+        }
+        forloop (i, 0, count)
+            temp[offsets[(keys[i] >> shift) & 0xFF]++] = keys[i];
+        std::swap(keys, temp);
+    }
+    return keys;
+}
+} // namespace dual
+
+void dual_storage_t::gather_views(const dual_entity_t* ents, EIndex count, eastl::vector<dual_chunk_view_t>& views)
+{
+    using namespace dual;
+    views.clear();
+    if (count == 0)
+        return;
+    // key = chunk slot << 24 | index in chunk, slots are ranked by (group, chunk) afterwards
+    constexpr uint32_t kIndexBits = 24;
+    skr::flat_hash_map<dual_chunk_t*, uint32_t> slots;
+    eastl::vector<dual_chunk_t*> chunks;
+    eastl::vector<uint64_t> keys;
+    keys.reserve(count);
+    forloop (i, 0, count)
+    {
+        auto view = entity_view(ents[i]);
+        if (!view.chunk)
+            continue;
+        auto result = slots.emplace(view.chunk, (uint32_t)chunks.size());
+        if (result.second)
+            chunks.push_back(view.chunk);
+        keys.push_back(((uint64_t)result.first->second << kIndexBits) | view.start);
+    }
+    if (keys.empty())
+        return;
+
+    eastl::vector<uint32_t> order(chunks.size());
+    forloop (i, 0, (uint32_t)order.size())
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        auto ga = chunks[a]->group, gb = chunks[b]->group;
+        return ga != gb ? ga < gb : chunks[a] < chunks[b];
+    });
+    eastl::vector<uint32_t> rank(chunks.size());
+    forloop (i, 0, (uint32_t)order.size())
+        rank[order[i]] = i;
+    constexpr uint64_t kIndexMask = (1ull << kIndexBits) - 1;
+    for (auto& key : keys)
+        key = ((uint64_t)rank[key >> kIndexBits] << kIndexBits) | (key & kIndexMask);
+
+    eastl::vector<uint64_t> temp(keys.size());
+    auto sorted = radix_sort(keys.data(), temp.data(), (EIndex)keys.size());
+    dual_chunk_view_t run = { nullptr, 0, 0 };
+    forloop (i, 0, (EIndex)keys.size())
+    {
+        auto chunk = chunks[order[sorted[i] >> kIndexBits]];
+        auto index = (EIndex)(sorted[i] & kIndexMask);
+        if (chunk == run.chunk && index < run.start + run.count)
+            continue; // duplicated entity
+        if (chunk == run.chunk && index == run.start + run.count)
+        {
+            run.count++;
+            continue;
+        }
+        if (run.chunk)
+            views.push_back(run);
+        run = { chunk, index, 1 };
+    }
+    views.push_back(run);
+}
+
+void dual_storage_t::batch_scattered(const dual_entity_t* ents, EIndex count, dual_view_callback_t callback, void* u)
+{
+    eastl::vector<dual_chunk_view_t> views;
+    gather_views(ents, count, views);
+    // back to front, so structural changes in the callback never move entities of pending views
+    for (auto it = views.rbegin(); it != views.rend(); ++it)
+        callback(u, &*it);
+}
+
+void dual_storage_t::destroy(const dual_entity_t* ents, EIndex count)
+{
+    eastl::vector<dual_chunk_view_t> views;
+    gather_views(ents, count, views);
+    for (auto it = views.rbegin(); it != views.rend(); ++it)
+        destroy(*it);
+}
+
+void dual_storage_t::cast(const dual_entity_t* ents, EIndex count, const dual_delta_type_t& diff, dual_cast_callback_t callback, void* u)
+{
+    eastl::vector<dual_chunk_view_t> views;
+    gather_views(ents, count, views);
+    // views of a group are adjacent, so the target is resolved once per group
+    dual_group_t* srcGroup = nullptr;
+    dual_group_t* dstGroup = nullptr;
+    for (auto it = views.rbegin(); it != views.rend(); ++it)
+    {
+        if (it->chunk->group != srcGroup)
+        {
+            srcGroup = it->chunk->group;
+            dstGroup = cast(srcGroup, diff);
+        }
+        cast(*it, dstGroup, callback, u);
+    }
+}
+
 void dual_storage_t::merge(dual_storage_t& src)
 {
     using namespace dual;
@@ -797,6 +938,11 @@ void dualS_set_userdata(dual_storage_t* storage, void* u)
     storage->userdata = u;
 }
 
+void dualS_set_simd_layout(dual_storage_t* storage, bool enable)
+{
+    storage->simdLayout = enable;
+}
+
 void* dualS_get_userdata(dual_storage_t* storage)
 {
     return storage->userdata;
@@ -866,6 +1012,22 @@ void dualS_batch(dual_storage_t* storage, const dual_entity_t* ents, EIndex coun
     storage->batch(ents, count, callback, u);
 }
 
+void dualS_batch_scattered(dual_storage_t* storage, const dual_entity_t* ents, EIndex count, dual_view_callback_t callback, void* u)
+{
+    storage->batch_scattered(ents, count, callback, u);
+}
+
+void dualS_destroy_entities(dual_storage_t* storage, const dual_entity_t* ents, EIndex count)
+{
+    storage->destroy(ents, count);
+}
+
+void dualS_cast_entities_delta(dual_storage_t* storage, const dual_entity_t* ents, EIndex count, const dual_delta_type_t* delta, dual_cast_callback_t callback, void* u)
+{
+    SKR_ASSERT(dual::ordered(*delta));
+    storage->cast(ents, count, *delta, callback, u);
+}
+
 void dualS_query(dual_storage_t* storage, const dual_filter_t* filter, const dual_meta_filter_t* meta, dual_view_callback_t callback, void* u)
 {
     SKR_ASSERT(dual::ordered(*filter));
@@ -939,6 +1101,16 @@ void dualS_reset(dual_storage_t* storage)
     storage->reset();
 }
 
+void dualS_set_version(dual_storage_t* storage, uint64_t number)
+{
+    storage->timestamp = (uint32_t)number;
+}
+
+uint64_t dualS_get_version(dual_storage_t* storage)
+{
+    return storage->timestamp;
+}
+
 void dualS_validate_meta(dual_storage_t* storage)
 {
     storage->validate_meta();
@@ -82,6 +82,7 @@ struct dual_storage_t {
     uint32_t phaseCount = 0;
     bool queriesBuilt = false;
     groups_t groups;
+    uint32_t groupEpoch;
     dual::block_arena_t archetypeArena;
     dual::block_arena_t queryBuildArena;
     dual::fixed_pool_t groupPool;
@@ -92,6 +93,7 @@ struct dual_storage_t {
     mutable void* currentFiber;
     skr::task::counter_t counter;
     void* userdata;
+    bool simdLayout;
 
     dual_storage_t();
     ~dual_storage_t();
@@ -119,15 +121,20 @@ struct dual_storage_t {
     using batchmap_t = skr::flat_hash_map<dual_chunk_t*, dual_chunk_view_t>;
     void destroy(const dual_chunk_view_t& view);
     void destroy(const dual_meta_filter_t& meta);
+    void destroy(const dual_entity_t* ents, EIndex count);
     void free(const dual_chunk_view_t& view);
 
     void cast_impl(const dual_chunk_view_t& view, dual_group_t* group, dual_cast_callback_t callback, void* u);
     void cast(const dual_chunk_view_t& view, dual_group_t* group, dual_cast_callback_t callback, void* u);
     void cast(dual_group_t* srcGroup, dual_group_t* group, dual_cast_callback_t callback, void* u);
     dual_group_t* cast(dual_group_t* group, const dual_delta_type_t& diff);
+    void cast(const dual_entity_t* ents, EIndex count, const dual_delta_type_t& diff, dual_cast_callback_t callback, void* u);
 
     dual_chunk_view_t entity_view(dual_entity_t e) const;
     void batch(const dual_entity_t* ents, EIndex count, dual_view_callback_t callback, void* u);
+    // sort scattered entities by (group, chunk, index) and merge them into contiguous runs
+    void gather_views(const dual_entity_t* ents, EIndex count, eastl::vector<dual_chunk_view_t>& views);
+    void batch_scattered(const dual_entity_t* ents, EIndex count, dual_view_callback_t callback, void* u);
     void query(const dual_filter_t& filter, const dual_meta_filter_t& meta, dual_view_callback_t callback, void* u);
     void query_groups(const dual_filter_t& filter, const dual_meta_filter_t& meta, dual_group_callback_t callback, void* u);
     bool match_group(const dual_filter_t& filter, const dual_meta_filter_t& meta, const dual_group_t* group);
@@ -2,6 +2,8 @@
 #include "io.cpp"
 #include "common/io_runner.cpp"
 #include "common/io_resolver.cpp"
+#include "common/io_qos.cpp"
+#include "common/io_trace.cpp"
 
 #include "components/components.cpp"
 
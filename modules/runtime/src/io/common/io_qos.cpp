@@ -0,0 +1,67 @@
+#include "SkrRT/platform/time.h"
+#include "io_qos.hpp"
+
+#include <algorithm>
+
+namespace skr {
+namespace io {
+
+IOQoSLimiter::IOQoSLimiter() SKR_NOEXCEPT
+{
+    skr_init_mutex(&mutex);
+}
+
+IOQoSLimiter::~IOQoSLimiter() SKR_NOEXCEPT
+{
+    skr_destroy_mutex(&mutex);
+}
+
+void IOQoSLimiter::set_budget(ESkrIOQoSClass qos, const skr_io_qos_budget_t& budget) SKR_NOEXCEPT
+{
+    SKR_ASSERT(qos < SKR_IO_QOS_CLASS_COUNT);
+    SMutexLock lock(mutex);
+    auto& bucket = buckets[qos];
+    bucket.rate = budget.bytes_per_second;
+    bucket.capacity = budget.burst_bytes ? budget.burst_bytes : budget.bytes_per_second;
+    bucket.tokens = (double)bucket.capacity;
+    bucket.last_usec = skr_sys_get_usec(false);
+}
+
+bool IOQoSLimiter::try_acquire(ESkrIOQoSClass qos, uint64_t bytes) SKR_NOEXCEPT
+{
+    SKR_ASSERT(qos < SKR_IO_QOS_CLASS_COUNT);
+    auto& bucket = buckets[qos];
+    {
+        SMutexLock lock(mutex);
+        if (bucket.rate && !skr_atomicu32_load_relaxed(&draining))
+        {
+            const auto now = skr_sys_get_usec(false);
+            const double refill = (double)(now - bucket.last_usec) * 1e-6 * (double)bucket.rate;
+            bucket.tokens = std::min(bucket.tokens + refill, (double)bucket.capacity);
+            bucket.last_usec = now;
+            if (bucket.tokens < 0.0)
+            {
+                skr_atomicu64_add_relaxed(&bucket.throttled, 1);
+                return false;
+            }
+            bucket.tokens -= (double)bytes;
+        }
+    }
+    skr_atomicu64_add_relaxed(&bucket.requests, 1);
+    skr_atomicu64_add_relaxed(&bucket.bytes, bytes);
+    return true;
+}
+
+skr_io_qos_stats_t IOQoSLimiter::get_stats(ESkrIOQoSClass qos) const SKR_NOEXCEPT
+{
+    SKR_ASSERT(qos < SKR_IO_QOS_CLASS_COUNT);
+    const auto& bucket = buckets[qos];
+    skr_io_qos_stats_t stats = {};
+    stats.dispatched_requests = skr_atomicu64_load_relaxed(&bucket.requests);
+    stats.dispatched_bytes = skr_atomicu64_load_relaxed(&bucket.bytes);
+    stats.throttled_count = skr_atomicu64_load_relaxed(&bucket.throttled);
+    return stats;
+}
+
+} // namespace io
+} // namespace skr
@@ -0,0 +1,41 @@
+#pragma once
+#include "SkrRT/io/io.h"
+#include "SkrRT/platform/thread.h"
+
+namespace skr {
+namespace io {
+
+// token bucket per qos class, tokens are bytes and refill at the budget rate.
+// a class may go into debt for one dispatch, so requests larger than the burst still get through
+struct IOQoSLimiter
+{
+    IOQoSLimiter() SKR_NOEXCEPT;
+    ~IOQoSLimiter() SKR_NOEXCEPT;
+
+    void set_budget(ESkrIOQoSClass qos, const skr_io_qos_budget_t& budget) SKR_NOEXCEPT;
+    // takes bytes from the bucket of the class, returns false and counts a throttle if it is in debt
+    bool try_acquire(ESkrIOQoSClass qos, uint64_t bytes) SKR_NOEXCEPT;
+    skr_io_qos_stats_t get_stats(ESkrIOQoSClass qos) const SKR_NOEXCEPT;
+
+    // budgets are ignored while a drain waits for the queues to empty
+    void begin_drain() SKR_NOEXCEPT { skr_atomicu32_add_relaxed(&draining, 1); }
+    void end_drain() SKR_NOEXCEPT { skr_atomicu32_add_relaxed(&draining, (uint32_t)-1); }
+
+private:
+    struct Bucket
+    {
+        uint64_t rate = 0;
+        uint64_t capacity = 0;
+        double tokens = 0.0;
+        int64_t last_usec = 0;
+        SAtomicU64 requests = 0;
+        SAtomicU64 bytes = 0;
+        SAtomicU64 throttled = 0;
+    };
+    Bucket buckets[SKR_IO_QOS_CLASS_COUNT];
+    SMutex mutex;
+    SAtomicU32 draining = 0;
+};
+
+} // namespace io
+} // namespace skr
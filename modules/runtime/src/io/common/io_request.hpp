@@ -134,6 +134,16 @@ public:
         safe_comp<IOStatusComponent>()->add_finish_callback(point, callback, data);
     }
 
+    void set_qos_class(ESkrIOQoSClass qos) SKR_NOEXCEPT
+    {
+        safe_comp<IOStatusComponent>()->set_qos_class(qos);
+    }
+
+    ESkrIOQoSClass get_qos_class() const SKR_NOEXCEPT
+    {
+        return safe_comp<IOStatusComponent>()->get_qos_class();
+    }
+
     skr::span<skr_io_block_t> get_blocks() SKR_NOEXCEPT 
     { 
         return safe_comp<BlocksComponent>()->get_blocks(); 
@@ -144,6 +154,11 @@ public:
         safe_comp<BlocksComponent>()->add_block(block); 
     }
 
+    void add_block(const skr_io_block_t& block, uint8_t* destination) SKR_NOEXCEPT 
+    { 
+        safe_comp<BlocksComponent>()->add_block(block, destination); 
+    }
+
     void reset_blocks() SKR_NOEXCEPT 
     { 
         safe_comp<BlocksComponent>()->reset_blocks(); 
@@ -1,4 +1,5 @@
 #include "SkrRT/platform/vfs.h"
+#include "SkrRT/misc/log.hpp"
 #include "io_runnner.hpp"
 #include "io_resolver.hpp"
 #include "processors.hpp"
@@ -16,7 +17,10 @@ void IORequestResolverChain::dispatch(SkrAsyncServicePriority priority) SKR_NOEX
     IOBatchId batch;
     while (fetched_batches[priority].try_dequeue(batch))
     {
-        for (auto request : batch->get_requests())
+        // cancelled requests are erased from the batch while resolving, walk a copy
+        const auto requests = batch->get_requests();
+        const eastl::fixed_vector<IORequestId, 4> resolving(requests.begin(), requests.end());
+        for (auto request : resolving)
         {
             if (auto pComp = io_component<IOStatusComponent>(request.get()))
             {
@@ -44,6 +48,13 @@ void VFSFileResolver::resolve(SkrAsyncServicePriority priority, IOBatchId batch,
         {
             SKR_ASSERT(pPath->vfs);
             pFile->file = skr_vfs_fopen(pPath->vfs, pPath->path.u8_str(), SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+            if (!pFile->file)
+            {
+                // a load error, not a cancel: the request completes as failed with nothing read
+                SKR_LOG_FMT_ERROR(u8"[VFSFileResolver] failed to open {}!", pPath->path);
+                if (auto pStatus = io_component<IOStatusComponent>(request.get()))
+                    pStatus->setFailed();
+            }
         }
     }
 }
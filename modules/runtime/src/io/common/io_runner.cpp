@@ -6,6 +6,9 @@
 namespace skr {
 namespace io {
 
+// pauses to spin before blocking, covers the gap between back-to-back requests under load
+static constexpr uint32_t kRunnerSpinCount = 4096;
+
 RunnerBase::RunnerBase(const ServiceThreadDesc& desc, skr::JobQueue* job_queue) SKR_NOEXCEPT
     : AsyncService(desc), job_queue(job_queue)
 {
@@ -95,8 +98,9 @@ void RunnerBase::phaseRecycle() SKR_NOEXCEPT
 
 }
 
-void RunnerBase::phaseProcessBatches() SKR_NOEXCEPT
+bool RunnerBase::phaseProcessBatches() SKR_NOEXCEPT
 {
+    bool progressed = false;
     for (uint32_t k = 0; k < SKR_ASYNC_SERVICE_PRIORITY_COUNT; ++k)
     {
         const auto priority = (SkrAsyncServicePriority)k;
@@ -113,6 +117,7 @@ void RunnerBase::phaseProcessBatches() SKR_NOEXCEPT
                 BatchPtr batch = nullptr;
                 while ((bytes <= NBytes) && prev_processor->poll_processed_batch(priority, batch))
                 {
+                    progressed = true;
                     uint64_t batch_size = 0;
                     if (bool sucess = processor->fetch(priority, batch))
                     {
@@ -135,7 +140,7 @@ void RunnerBase::phaseProcessBatches() SKR_NOEXCEPT
         if (!request_processors.size())
         {
             ZoneScopedN("phaseCompleteBatches");
-            phaseCompleteBatches(priority);
+            progressed |= phaseCompleteBatches(priority);
             continue;
         }
 
@@ -146,6 +151,7 @@ void RunnerBase::phaseProcessBatches() SKR_NOEXCEPT
             auto& back_processor = batch_processors.back();
             while (back_processor->poll_processed_batch(priority, batch))
             {
+                progressed = true;
                 auto bq = skr::static_pointer_cast<IOBatchBase>(batch);
                 for (auto&& request : bq->get_requests())
                 {
@@ -166,6 +172,7 @@ void RunnerBase::phaseProcessBatches() SKR_NOEXCEPT
                 IORequestId request = nullptr;
                 while (prev_processor->poll_processed_request(priority, request))
                 {
+                    progressed = true;
                     processor->fetch(priority, request);
                 }
                 processor->dispatch(priority);
@@ -174,32 +181,39 @@ void RunnerBase::phaseProcessBatches() SKR_NOEXCEPT
 
         {
             ZoneScopedN("phaseCompleteRequests");
-            phaseCompleteRequests(priority);
+            progressed |= phaseCompleteRequests(priority);
         }
     }
+    return progressed;
 }
 
-void RunnerBase::phaseCompleteBatches(SkrAsyncServicePriority priority) SKR_NOEXCEPT
+bool RunnerBase::phaseCompleteBatches(SkrAsyncServicePriority priority) SKR_NOEXCEPT
 {
+    bool progressed = false;
     BatchPtr batch;
     auto& back_processor = batch_processors.back();
     while (back_processor->poll_processed_batch(priority, batch))
     {
+        progressed = true;
         for (auto&& request : batch->get_requests())
         {
             dispatch_complete_(priority, request);
         }
     }
+    return progressed;
 };
 
-void RunnerBase::phaseCompleteRequests(SkrAsyncServicePriority priority) SKR_NOEXCEPT
+bool RunnerBase::phaseCompleteRequests(SkrAsyncServicePriority priority) SKR_NOEXCEPT
 {
+    bool progressed = false;
     IORequestId request;
     auto& back_processor = request_processors.back();
     while (back_processor->poll_processed_request(priority, request))
     {
+        progressed = true;
         dispatch_complete_(priority, request);
     }
+    return progressed;
 }
 
 bool RunnerBase::try_cancel(SkrAsyncServicePriority priority, IORequestId rq) SKR_NOEXCEPT
@@ -253,22 +267,56 @@ void RunnerBase::dispatch_complete_(SkrAsyncServicePriority priority, IORequestI
 
 skr::AsyncResult RunnerBase::serve() SKR_NOEXCEPT
 {
-    if (!predicate())
+    // async completion callbacks are recycled by polling, keep serving until they are done
+    if (!predicate() && finish_futures.empty())
     {
+        // new requests and async readers call awake(), right after a busy period they usually
+        // arrive within microseconds so spin shortly before blocking on the condition
+        if (recently_busy)
+        {
+            recently_busy = false;
+            if (spin(kRunnerSpinCount))
+                return ASYNC_RESULT_OK;
+        }
+        // nothing is queued, block until a request, an async reader or a stop request wakes us
         setServiceStatus(SKR_ASYNC_SERVICE_STATUS_SLEEPING);
         sleep();
+        if (batch_requests)
+        {
+            // lazy services trade latency for larger batches: let more requests arrive before dispatching
+            const auto delay = get_sleep_time();
+            if (delay && delay != UINT32_MAX)
+                skr_thread_sleep(delay);
+        }
         return ASYNC_RESULT_OK;
     }
     
+    bool progressed = false;
     {
         setServiceStatus(SKR_ASYNC_SERVICE_STATUS_RUNNING);
         ZoneScopedNC("IORunner::Dispatch", tracy::Color::Orchid1);
-        phaseProcessBatches();
+        progressed = phaseProcessBatches();
     }
     {
         ZoneScopedNC("IORunner::Recycle", tracy::Color::Tan1);
         phaseRecycle();
     }
+    if (progressed)
+    {
+        recently_busy = true;
+        stalled_rounds = 0;
+    }
+    else if (stalled_rounds++)
+    {
+        // pending work only waits on polled completions (dstorage events, gpu fences) or qos tokens,
+        // back off instead of burning a core, awake() still cuts the wait short
+        sleep_for(1);
+    }
+    else
+    {
+        // completions usually land right after the last progress, spin once before backing off
+        spin(kRunnerSpinCount);
+    }
     return ASYNC_RESULT_OK;
 }
 
@@ -278,6 +326,8 @@ void RunnerBase::drain(SkrAsyncServicePriority priority) SKR_NOEXCEPT
         return drain();
 
     ZoneScopedN("IORunner::Drain");
+    qos.begin_drain();
+    SKR_DEFER({ qos.end_drain(); });
     auto predicate = [this, priority]() {
         uint64_t cnt = 0;
         for (auto processor : batch_processors)
@@ -346,15 +396,7 @@ bool RunnerBase::cancel_(IIORequest* rq, SkrAsyncServicePriority priority) SKR_N
     if (auto pComp = io_component<IOStatusComponent>(rq))
     {
         pComp->setStatus(SKR_IO_STAGE_CANCELLED);
-        if (pComp->needPollFinish())
-        {
-            finish_queues[priority].enqueue(rq);
-            pComp->setFinishStep(SKR_ASYNC_IO_FINISH_STEP_WAIT_CALLBACK_POLLING);
-        }
-        else
-        {
-            pComp->setFinishStep(SKR_ASYNC_IO_FINISH_STEP_DONE);
-        }
+        finish_(rq, priority);
         skr_atomic64_add_relaxed(&processing_request_counts[priority], -1);
     }
     return true;
@@ -366,6 +408,18 @@ bool RunnerBase::complete_(IIORequest* rq, SkrAsyncServicePriority priority) SKR
     {
         SKR_ASSERT(pStatus->getStatus() == SKR_IO_STAGE_LOADED);
         pStatus->setStatus(SKR_IO_STAGE_COMPLETED);
+        finish_(rq, priority);
+        skr_atomic64_add_relaxed(&processing_request_counts[priority], -1);
+    }
+    return true;
+}
+
+void RunnerBase::finish_(IIORequest* rq, SkrAsyncServicePriority priority) SKR_NOEXCEPT
+{
+    if (auto pStatus = io_component<IOStatusComponent>(rq))
+    {
+        if (pStatus->is_stage_traced())
+            tracer.record(rq, priority, trace_bytes_(rq));
         if (pStatus->needPollFinish())
         {
             finish_queues[priority].enqueue(rq);
@@ -375,9 +429,18 @@ bool RunnerBase::complete_(IIORequest* rq, SkrAsyncServicePriority priority) SKR
         {
             pStatus->setFinishStep(SKR_ASYNC_IO_FINISH_STEP_DONE);
         }
-        skr_atomic64_add_relaxed(&processing_request_counts[priority], -1);
     }
-    return true;
+}
+
+uint64_t RunnerBase::trace_bytes_(IIORequest* rq) const SKR_NOEXCEPT
+{
+    uint64_t bytes = 0;
+    if (auto pBlocks = io_component<BlocksComponent>(rq))
+    {
+        for (const auto& block : pBlocks->blocks)
+            bytes += block.size;
+    }
+    return bytes;
 }
 
 } // namespace io
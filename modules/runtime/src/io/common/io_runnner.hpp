@@ -1,6 +1,8 @@
 #pragma once
 #include "SkrRT/async/async_service.h"
 #include "io_request.hpp"
+#include "io_qos.hpp"
+#include "io_trace.hpp"
 #include <EASTL/utility.h>
 
 namespace skr { template <typename Artifact> struct IFuture; struct JobQueue; }
@@ -23,10 +25,21 @@ struct RunnerBase : public AsyncService
     virtual void destroy() SKR_NOEXCEPT;
     virtual skr::AsyncResult serve() SKR_NOEXCEPT;
 
+    // bandwidth budgets, readers and uploaders take tokens before they dispatch a request
+    IOQoSLimiter qos;
+    // records requests enqueued while tracing when they finish
+    IOTracer tracer;
+    // set for services created without awake_at_request, they wait sleep_time after a wakeup to batch requests
+    bool batch_requests = false;
+
 protected:
     void dispatch_complete_(SkrAsyncServicePriority priority, IORequestId rq) SKR_NOEXCEPT;
     virtual bool complete_(IIORequest* rq, SkrAsyncServicePriority priority) SKR_NOEXCEPT;
     virtual bool cancel_(IIORequest* rq, SkrAsyncServicePriority priority) SKR_NOEXCEPT;
+    // queue finish callbacks of a request which reached its final stage
+    void finish_(IIORequest* rq, SkrAsyncServicePriority priority) SKR_NOEXCEPT;
+    // payload size written to the trace for a finished request
+    virtual uint64_t trace_bytes_(IIORequest* rq) const SKR_NOEXCEPT;
 
     skr::vector<IOBatchProcessorId> batch_processors; 
     skr::vector<IORequestProcessorId> request_processors; 
@@ -34,13 +47,17 @@ protected:
 
 private:
     void phaseRecycle() SKR_NOEXCEPT;
-    void phaseProcessBatches() SKR_NOEXCEPT;
-    void phaseCompleteBatches(SkrAsyncServicePriority priority) SKR_NOEXCEPT;
-    void phaseCompleteRequests(SkrAsyncServicePriority priority) SKR_NOEXCEPT;
+    // phases return true if any batch or request moved forward
+    bool phaseProcessBatches() SKR_NOEXCEPT;
+    bool phaseCompleteBatches(SkrAsyncServicePriority priority) SKR_NOEXCEPT;
+    bool phaseCompleteRequests(SkrAsyncServicePriority priority) SKR_NOEXCEPT;
 
     IORequestQueue finish_queues[SKR_ASYNC_SERVICE_PRIORITY_COUNT];
     skr::vector<eastl::pair<skr::IFuture<bool>*, IORequestId>> finish_futures;
     skr::JobQueue* job_queue = nullptr;
+    // adaptive wait state, see serve()
+    bool recently_busy = false;
+    uint32_t stalled_rounds = 0;
 };
 
 } // namespace io
@@ -0,0 +1,228 @@
+#include "SkrRT/platform/time.h"
+#include "SkrRT/platform/vfs.h"
+#include "SkrRT/misc/log.h"
+#include "SkrRT/misc/defer.hpp"
+#include "../components/status_component.hpp"
+#include "../components/src_components.hpp"
+#include "../components/blocks_component.hpp"
+#include "io_trace.hpp"
+
+#include <EASTL/sort.h>
+#include <EASTL/algorithm.h>
+#include <string.h> // ::memcpy
+
+namespace skr {
+namespace io {
+
+namespace TraceFormat
+{
+// "SIOT", all fields are stored in host byte order
+static constexpr uint32_t kMagic = 0x544F4953;
+static constexpr uint32_t kVersion = 1;
+static constexpr uint32_t kStageSkipped = UINT32_MAX;
+static constexpr uint64_t kFlushBytes = 64 * 1024;
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+};
+
+// followed by path_length bytes of path and block_count skr_io_block_t
+struct RecordHeader
+{
+    uint64_t enqueue_usec;
+    uint64_t bytes;
+    // microseconds after enqueue_usec
+    uint32_t stage_deltas[SKR_IO_STAGE_COUNT];
+    uint8_t endpoint;
+    uint8_t priority;
+    uint8_t qos_class;
+    uint8_t final_stage;
+    uint16_t path_length;
+    uint16_t block_count;
+};
+
+inline static void Append(skr::vector<uint8_t>& buffer, const void* data, uint64_t size) SKR_NOEXCEPT
+{
+    const auto offset = buffer.size();
+    buffer.resize(offset + size);
+    ::memcpy(buffer.data() + offset, data, size);
+}
+
+inline static bool Consume(const skr::vector<uint8_t>& buffer, uint64_t& offset, void* data, uint64_t size) SKR_NOEXCEPT
+{
+    if (offset + size > buffer.size())
+        return false;
+    ::memcpy(data, buffer.data() + offset, size);
+    offset += size;
+    return true;
+}
+} // namespace TraceFormat
+
+IOTracer::IOTracer() SKR_NOEXCEPT
+{
+    skr_init_mutex(&mutex);
+}
+
+IOTracer::~IOTracer() SKR_NOEXCEPT
+{
+    end();
+    skr_destroy_mutex(&mutex);
+}
+
+bool IOTracer::begin(skr_vfs_t* vfs, const char8_t* path, ESkrIOEndpoint _endpoint) SKR_NOEXCEPT
+{
+    end();
+
+    SMutexLock lock(mutex);
+    file = skr_vfs_fopen(vfs, path, SKR_FM_WRITE_BINARY, SKR_FILE_CREATION_ALWAYS_NEW);
+    if (!file)
+    {
+        SKR_LOG_ERROR(u8"IOTracer: failed to create trace file %s", path);
+        return false;
+    }
+    const TraceFormat::FileHeader header = { TraceFormat::kMagic, TraceFormat::kVersion };
+    buffer.clear();
+    TraceFormat::Append(buffer, &header, sizeof(header));
+    file_offset = 0;
+    endpoint = _endpoint;
+    start_usec = skr_sys_get_usec(false);
+    skr_atomicu32_store_relaxed(&tracing, 1);
+    return true;
+}
+
+void IOTracer::end() SKR_NOEXCEPT
+{
+    SMutexLock lock(mutex);
+    skr_atomicu32_store_relaxed(&tracing, 0);
+    if (file)
+    {
+        flush_();
+        skr_vfs_fclose(file);
+        file = nullptr;
+    }
+}
+
+void IOTracer::record(IIORequest* rq, SkrAsyncServicePriority priority, uint64_t bytes) SKR_NOEXCEPT
+{
+    auto pStatus = io_component<IOStatusComponent>(rq);
+    if (!pStatus || !pStatus->is_stage_traced())
+        return;
+
+    const auto enqueued = pStatus->get_stage_usec(SKR_IO_STAGE_ENQUEUED);
+    TraceFormat::RecordHeader header = {};
+    header.bytes = bytes;
+    for (uint32_t i = 0; i < SKR_IO_STAGE_COUNT; ++i)
+    {
+        const auto usec = pStatus->get_stage_usec((ESkrIOStage)i);
+        header.stage_deltas[i] = usec ? (uint32_t)eastl::min<int64_t>(usec - enqueued, TraceFormat::kStageSkipped - 1) : TraceFormat::kStageSkipped;
+    }
+    header.priority = (uint8_t)priority;
+    header.qos_class = (uint8_t)pStatus->get_qos_class();
+    header.final_stage = (uint8_t)pStatus->getStatus();
+
+    const char8_t* path = u8"";
+    if (auto pPath = io_component<PathSrcComponent>(rq))
+    {
+        path = pPath->get_path();
+        header.path_length = (uint16_t)eastl::min<uint64_t>(pPath->path.raw().size(), UINT16_MAX);
+    }
+    skr::span<skr_io_block_t> blocks;
+    if (auto pBlocks = io_component<BlocksComponent>(rq))
+    {
+        blocks = pBlocks->get_blocks();
+        header.block_count = (uint16_t)eastl::min<uint64_t>(blocks.size(), UINT16_MAX);
+    }
+
+    SMutexLock lock(mutex);
+    if (!file)
+        return;
+    header.endpoint = (uint8_t)endpoint;
+    header.enqueue_usec = (enqueued > start_usec) ? (uint64_t)(enqueued - start_usec) : 0;
+    TraceFormat::Append(buffer, &header, sizeof(header));
+    TraceFormat::Append(buffer, path, header.path_length);
+    TraceFormat::Append(buffer, blocks.data(), header.block_count * sizeof(skr_io_block_t));
+    if (buffer.size() >= TraceFormat::kFlushBytes)
+        flush_();
+}
+
+void IOTracer::flush_() SKR_NOEXCEPT
+{
+    if (buffer.empty())
+        return;
+    const auto written = skr_vfs_fwrite(file, buffer.data(), file_offset, buffer.size());
+    if (written != buffer.size())
+        SKR_LOG_ERROR(u8"IOTracer: failed to write %llu bytes of trace", buffer.size());
+    file_offset += written;
+    buffer.clear();
+}
+
+bool IOTrace::Load(skr_vfs_t* vfs, const char8_t* path, skr::vector<IOTraceRecord>& records) SKR_NOEXCEPT
+{
+    auto file = skr_vfs_fopen(vfs, path, SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+    if (!file)
+    {
+        SKR_LOG_ERROR(u8"IOTrace: failed to open trace file %s", path);
+        return false;
+    }
+    skr::vector<uint8_t> content;
+    {
+        SKR_DEFER({ skr_vfs_fclose(file); });
+        content.resize(skr_vfs_fsize(file));
+        if (skr_vfs_fread(file, content.data(), 0, content.size()) != content.size())
+        {
+            SKR_LOG_ERROR(u8"IOTrace: failed to read trace file %s", path);
+            return false;
+        }
+    }
+
+    uint64_t offset = 0;
+    TraceFormat::FileHeader header = {};
+    if (!TraceFormat::Consume(content, offset, &header, sizeof(header)) ||
+        header.magic != TraceFormat::kMagic || header.version != TraceFormat::kVersion)
+    {
+        SKR_LOG_ERROR(u8"IOTrace: %s is not a trace file of version %u", path, TraceFormat::kVersion);
+        return false;
+    }
+
+    records.clear();
+    while (offset < content.size())
+    {
+        TraceFormat::RecordHeader rh = {};
+        auto& record = records.emplace_back();
+        bool valid = TraceFormat::Consume(content, offset, &rh, sizeof(rh)) && (offset + rh.path_length <= content.size());
+        if (valid)
+        {
+            record.path = skr::string(skr::codeunit_sequence_view((const char8_t*)content.data() + offset, rh.path_length));
+            offset += rh.path_length;
+            record.blocks.resize(rh.block_count);
+            valid = TraceFormat::Consume(content, offset, record.blocks.data(), rh.block_count * sizeof(skr_io_block_t));
+        }
+        if (!valid || rh.final_stage >= SKR_IO_STAGE_COUNT || rh.stage_deltas[rh.final_stage] == TraceFormat::kStageSkipped)
+        {
+            // a session that was not ended cleanly leaves a partial last record
+            SKR_LOG_WARN(u8"IOTrace: %s is truncated, loaded %llu records", path, records.size() - 1);
+            records.pop_back();
+            break;
+        }
+        record.endpoint = (ESkrIOEndpoint)rh.endpoint;
+        record.priority = (SkrAsyncServicePriority)rh.priority;
+        record.qos_class = (ESkrIOQoSClass)rh.qos_class;
+        record.final_stage = (ESkrIOStage)rh.final_stage;
+        record.bytes = rh.bytes;
+        for (uint32_t i = 0; i < SKR_IO_STAGE_COUNT; ++i)
+        {
+            const auto delta = rh.stage_deltas[i];
+            record.stage_usecs[i] = (delta == TraceFormat::kStageSkipped) ? IOTraceRecord::kStageSkipped : rh.enqueue_usec + delta;
+        }
+    }
+    // records are written in finish order
+    eastl::stable_sort(records.begin(), records.end(), [](const IOTraceRecord& a, const IOTraceRecord& b) {
+        return a.get_enqueue_usec() < b.get_enqueue_usec();
+    });
+    return true;
+}
+
+} // namespace io
+} // namespace skr
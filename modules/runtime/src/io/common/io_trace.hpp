@@ -0,0 +1,35 @@
+#pragma once
+#include "SkrRT/io/io_trace.hpp"
+#include "SkrRT/platform/thread.h"
+
+namespace skr {
+namespace io {
+
+// writes finished requests into a trace file, records are buffered and flushed in chunks.
+// record() may be called from the runner thread and from async completion jobs
+struct IOTracer
+{
+    IOTracer() SKR_NOEXCEPT;
+    ~IOTracer() SKR_NOEXCEPT;
+
+    bool begin(skr_vfs_t* vfs, const char8_t* path, ESkrIOEndpoint endpoint) SKR_NOEXCEPT;
+    void end() SKR_NOEXCEPT;
+    bool is_tracing() const SKR_NOEXCEPT { return skr_atomicu32_load_relaxed(&tracing); }
+
+    // requests enqueued before begin() have no stage timestamps and are skipped
+    void record(IIORequest* rq, SkrAsyncServicePriority priority, uint64_t bytes) SKR_NOEXCEPT;
+
+private:
+    void flush_() SKR_NOEXCEPT;
+
+    SMutex mutex;
+    SAtomicU32 tracing = 0;
+    ESkrIOEndpoint endpoint = SKR_IO_ENDPOINT_RAM;
+    skr_io_file_handle file = nullptr;
+    uint64_t file_offset = 0;
+    int64_t start_usec = 0;
+    skr::vector<uint8_t> buffer;
+};
+
+} // namespace io
+} // namespace skr
@@ -24,11 +24,35 @@ struct BlocksComponent : public IORequestComponent
     void add_block(const skr_io_block_t& block) SKR_NOEXCEPT 
     {
         blocks.emplace_back(block);
+        if (!destinations.empty())
+            destinations.emplace_back(nullptr);
+    }
+
+    void add_block(const skr_io_block_t& block, uint8_t* destination) SKR_NOEXCEPT 
+    {
+        SKR_ASSERT(block.size && "caller destinations need a known block size!");
+        destinations.resize(blocks.size(), nullptr);
+        blocks.emplace_back(block);
+        destinations.emplace_back(destination);
     }
     
-    void reset_blocks() SKR_NOEXCEPT { blocks.clear(); }
+    void reset_blocks() SKR_NOEXCEPT 
+    { 
+        blocks.clear(); 
+        destinations.clear();
+    }
+
+    bool has_destinations() const SKR_NOEXCEPT { return !destinations.empty(); }
+
+    // caller memory of the block, nullptr if it lands in the service owned buffer
+    uint8_t* get_destination(uint64_t i) const SKR_NOEXCEPT 
+    { 
+        return (i < destinations.size()) ? destinations[i] : nullptr; 
+    }
     
     eastl::fixed_vector<skr_io_block_t, 1> blocks;
+    // empty unless a block was added with caller memory, then parallel to blocks
+    eastl::fixed_vector<uint8_t*, 1> destinations;
 };
 
 template <>
@@ -1,6 +1,7 @@
 #pragma once
 #include "SkrRT/io/io.h"
 #include "SkrRT/platform/guid.hpp"
+#include "SkrRT/platform/time.h"
 #include "../components/component.hpp"
 
 #include "tracy/Tracy.hpp"
@@ -58,11 +59,22 @@ public:
         return static_cast<ESkrIOStage>(skr_atomicu32_load_relaxed(&future->status));
     }
 
-    bool getCancelRequested() const SKR_NOEXCEPT
+    virtual bool getCancelRequested() const SKR_NOEXCEPT
     {
         return skr_atomicu32_load_relaxed(&future->request_cancel);
     }
 
+    // resolvers and readers report a source that can not be read, unlike a cancel the request still completes
+    void setFailed() SKR_NOEXCEPT
+    {
+        skr_atomicu32_store_release(&future->failed, 1);
+    }
+
+    bool getFailed() const SKR_NOEXCEPT
+    {
+        return skr_atomicu32_load_acquire(&future->failed);
+    }
+
     SkrAsyncIOFinishStep getFinishStep() const SKR_NOEXCEPT
     { 
         return (SkrAsyncIOFinishStep)skr_atomic32_load_acquire(&finish_step); 
@@ -98,6 +110,8 @@ public:
     virtual void setStatus(ESkrIOStage status) SKR_NOEXCEPT
     {
         skr_atomicu32_store_release(&future->status, status);
+        if (trace_stages)
+            stage_usecs[status] = skr_sys_get_usec(false);
         if (const auto callback = callbacks[status])
         {
             ZoneScoped;
@@ -106,6 +120,15 @@ public:
         }
     }
 
+    void set_qos_class(ESkrIOQoSClass qos) SKR_NOEXCEPT { qos_class = qos; }
+    ESkrIOQoSClass get_qos_class() const SKR_NOEXCEPT { return qos_class; }
+
+    // stage timestamps are only taken for requests enqueued while their service traces
+    void enable_stage_trace() SKR_NOEXCEPT { trace_stages = true; }
+    bool is_stage_traced() const SKR_NOEXCEPT { return trace_stages; }
+    // 0 if the request never entered the stage
+    int64_t get_stage_usec(ESkrIOStage stage) const SKR_NOEXCEPT { return stage_usecs[stage]; }
+
     IIOBatch* getOwnerBatch() const SKR_NOEXCEPT { return owner_batch; }
     void use_async_complete() SKR_NOEXCEPT { async_complete = true; }
     void use_async_cancel() SKR_NOEXCEPT { async_cancel = true; }
@@ -115,8 +138,12 @@ public:
 protected:
     friend struct RAMIOBatch;
     friend struct VRAMIOBatch;
+    friend struct RAMService;
     bool async_complete = false;
     bool async_cancel = false;
+    ESkrIOQoSClass qos_class = SKR_IO_QOS_CLASS_DEFAULT;
+    bool trace_stages = false;
+    int64_t stage_usecs[SKR_IO_STAGE_COUNT] = { 0 };
     IIOBatch* owner_batch = nullptr; // avoid circular reference
 
     skr_io_future_t* future = nullptr;
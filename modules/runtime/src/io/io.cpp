@@ -5,6 +5,10 @@ bool skr_io_future_t::is_ready() const SKR_NOEXCEPT
 {
     return get_status() == SKR_IO_STAGE_COMPLETED;
 }
+bool skr_io_future_t::is_failed() const SKR_NOEXCEPT
+{
+    return skr_atomicu32_load_acquire(&failed);
+}
 bool skr_io_future_t::is_enqueued() const SKR_NOEXCEPT
 {
     return get_status() == SKR_IO_STAGE_ENQUEUED;
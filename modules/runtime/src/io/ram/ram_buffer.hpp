@@ -5,6 +5,32 @@
 namespace skr {
 namespace io {
 
+// process wide size-class pool backing RAMIOBuffer, streamed assets come and go at a high rate
+// and mostly fall into a handful of sizes, so their memory is recycled instead of freed.
+// classes step by a quarter of each power of two from 4 KiB to 64 MiB, larger buffers are not pooled
+struct RAMBufferPool
+{
+    static constexpr uint32_t kMinShift = 12;
+    static constexpr uint32_t kMaxShift = 26;
+    static constexpr uint32_t kClassCount = (kMaxShift - kMinShift) * 4 + 1;
+    // classes up to 1 MiB keep a few free buffers per allocating thread, buffers freed by
+    // threads that never allocate (consumers of the runner's buffers) go to the shared lists
+    static constexpr uint32_t kLocalClassCount = (20 - kMinShift) * 4 + 1;
+    static constexpr uint32_t kLocalDepth = 4;
+    static constexpr uint64_t kLocalBytes = 4ull * 1024 * 1024;
+    // free memory kept in the shared lists, the rest goes back to the allocator
+    static constexpr uint64_t kRetainedBytes = 128ull * 1024 * 1024;
+
+    // capacity is the class size actually allocated, hand it back to free()
+    static uint8_t* allocate(uint64_t n, uint64_t& capacity) SKR_NOEXCEPT;
+    static void free(uint8_t* bytes, uint64_t capacity) SKR_NOEXCEPT;
+    // releases the free memory held by the shared lists and the caches of every thread
+    static void trim() SKR_NOEXCEPT;
+
+    static uint32_t class_index(uint64_t n) SKR_NOEXCEPT;
+    static uint64_t class_size(uint32_t index) SKR_NOEXCEPT;
+};
+
 struct SKR_RUNTIME_API RAMIOBuffer : public IRAMIOBuffer
 {
     IO_RC_OBJECT_BODY
@@ -31,6 +57,7 @@ public:
 protected:
     uint8_t* bytes = nullptr;
     uint64_t size = 0;
+    uint64_t capacity = 0;
     RAMIOBuffer(ISmartPoolPtr<IRAMIOBuffer> pool) 
         : pool(pool)
     {
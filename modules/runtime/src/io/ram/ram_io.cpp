@@ -1,4 +1,5 @@
 
+#include "SkrRT/platform/thread.h"
 #include "ram_service.hpp"
 #include "ram_batch.hpp"
 #include "ram_buffer.hpp"
@@ -18,11 +19,220 @@ RAMIOBuffer::~RAMIOBuffer() SKR_NOEXCEPT
     free_buffer();
 }
 
+namespace RAMBufferPoolImpl
+{
+struct LocalCache;
+
+struct SharedLists
+{
+    SharedLists() SKR_NOEXCEPT
+    {
+        skr_init_mutex(&mutex);
+        skr_init_mutex(&caches_mutex);
+    }
+    ~SharedLists() SKR_NOEXCEPT
+    {
+        release(0);
+        skr_destroy_mutex(&caches_mutex);
+        skr_destroy_mutex(&mutex);
+    }
+
+    // keeps the buffer while the retained budget allows it
+    void push(uint8_t* bytes, uint32_t index) SKR_NOEXCEPT
+    {
+        const auto capacity = RAMBufferPool::class_size(index);
+        {
+            SMutexLock lock(mutex);
+            if (retained + capacity <= RAMBufferPool::kRetainedBytes)
+            {
+                lists[index].emplace_back(bytes);
+                retained += capacity;
+                return;
+            }
+        }
+        sakura_freeN(bytes, kIOBufferMemoryName);
+    }
+
+    // frees buffers from the largest class down until at most keep bytes are retained
+    void release(uint64_t keep) SKR_NOEXCEPT
+    {
+        SMutexLock lock(mutex);
+        for (uint32_t i = RAMBufferPool::kClassCount; i > 0 && retained > keep; --i)
+        {
+            auto& list = lists[i - 1];
+            while (!list.empty() && retained > keep)
+            {
+                sakura_freeN(list.back(), kIOBufferMemoryName);
+                list.pop_back();
+                retained -= RAMBufferPool::class_size(i - 1);
+            }
+        }
+    }
+
+    SMutex mutex;
+    uint64_t retained = 0;
+    skr::vector<uint8_t*> lists[RAMBufferPool::kClassCount];
+
+    // live thread caches, trim() empties all of them
+    SMutex caches_mutex;
+    skr::vector<LocalCache*> caches;
+};
+
+inline static SharedLists& Shared() SKR_NOEXCEPT
+{
+    static SharedLists shared;
+    return shared;
+}
+
+// per-thread free buffers, the lock is only contended by trim()
+struct LocalCache
+{
+    LocalCache() SKR_NOEXCEPT
+    {
+        skr_init_mutex(&mutex);
+        auto& shared = Shared();
+        SMutexLock lock(shared.caches_mutex);
+        shared.caches.emplace_back(this);
+    }
+
+    ~LocalCache() SKR_NOEXCEPT
+    {
+        {
+            auto& shared = Shared();
+            SMutexLock lock(shared.caches_mutex);
+            shared.caches.erase_first_unsorted(this);
+        }
+        for (uint32_t i = 0; i < RAMBufferPool::kLocalClassCount; ++i)
+        {
+            for (uint32_t j = 0; j < counts[i]; ++j)
+                Shared().push(slots[i][j], i);
+        }
+        skr_destroy_mutex(&mutex);
+    }
+
+    uint8_t* pop(uint32_t index) SKR_NOEXCEPT
+    {
+        SMutexLock lock(mutex);
+        allocating = true;
+        if (!counts[index])
+            return nullptr;
+        bytes -= RAMBufferPool::class_size(index);
+        return slots[index][--counts[index]];
+    }
+
+    bool push(uint8_t* buffer, uint32_t index) SKR_NOEXCEPT
+    {
+        const auto capacity = RAMBufferPool::class_size(index);
+        SMutexLock lock(mutex);
+        if (!allocating || counts[index] >= RAMBufferPool::kLocalDepth || bytes + capacity > RAMBufferPool::kLocalBytes)
+            return false;
+        slots[index][counts[index]++] = buffer;
+        bytes += capacity;
+        return true;
+    }
+
+    void release() SKR_NOEXCEPT
+    {
+        SMutexLock lock(mutex);
+        for (uint32_t i = 0; i < RAMBufferPool::kLocalClassCount; ++i)
+        {
+            for (uint32_t j = 0; j < counts[i]; ++j)
+                sakura_freeN(slots[i][j], kIOBufferMemoryName);
+            counts[i] = 0;
+        }
+        bytes = 0;
+    }
+
+    SMutex mutex;
+    // only threads that allocate from the pool get their frees back
+    bool allocating = false;
+    uint64_t bytes = 0;
+    uint32_t counts[RAMBufferPool::kLocalClassCount] = {};
+    uint8_t* slots[RAMBufferPool::kLocalClassCount][RAMBufferPool::kLocalDepth] = {};
+};
+static thread_local LocalCache local_cache;
+} // namespace RAMBufferPoolImpl
+
+uint32_t RAMBufferPool::class_index(uint64_t n) SKR_NOEXCEPT
+{
+    if (n <= (1ull << kMinShift))
+        return 0;
+    // n falls in (2^k, 2^(k+1)], split in 4 steps of 2^(k-2)
+    uint32_t k = kMinShift;
+    while ((1ull << (k + 1)) < n)
+        ++k;
+    const uint64_t step = 1ull << (k - 2);
+    const uint64_t j = (n - (1ull << k) + step - 1) / step;
+    return (k - kMinShift) * 4 + (uint32_t)j;
+}
+
+uint64_t RAMBufferPool::class_size(uint32_t index) SKR_NOEXCEPT
+{
+    const uint32_t k = kMinShift + index / 4;
+    return (1ull << k) + (index % 4) * (1ull << (k - 2));
+}
+
+uint8_t* RAMBufferPool::allocate(uint64_t n, uint64_t& capacity) SKR_NOEXCEPT
+{
+    SKR_ASSERT(n && "empty buffers are not allocated!");
+    if (n > (1ull << kMaxShift))
+    {
+        capacity = n;
+        return (uint8_t*)sakura_mallocN(n, kIOBufferMemoryName);
+    }
+    const auto index = class_index(n);
+    capacity = class_size(index);
+    if (index < kLocalClassCount)
+    {
+        if (auto bytes = RAMBufferPoolImpl::local_cache.pop(index))
+            return bytes;
+    }
+    {
+        auto& shared = RAMBufferPoolImpl::Shared();
+        SMutexLock lock(shared.mutex);
+        auto& list = shared.lists[index];
+        if (!list.empty())
+        {
+            auto bytes = list.back();
+            list.pop_back();
+            shared.retained -= capacity;
+            return bytes;
+        }
+    }
+    return (uint8_t*)sakura_mallocN(capacity, kIOBufferMemoryName);
+}
+
+void RAMBufferPool::free(uint8_t* bytes, uint64_t capacity) SKR_NOEXCEPT
+{
+    if (capacity > (1ull << kMaxShift))
+    {
+        sakura_freeN(bytes, kIOBufferMemoryName);
+        return;
+    }
+    const auto index = class_index(capacity);
+    SKR_ASSERT(class_size(index) == capacity && "capacity does not come from RAMBufferPool::allocate!");
+    if (index < kLocalClassCount && RAMBufferPoolImpl::local_cache.push(bytes, index))
+        return;
+    RAMBufferPoolImpl::Shared().push(bytes, index);
+}
+
+void RAMBufferPool::trim() SKR_NOEXCEPT
+{
+    auto& shared = RAMBufferPoolImpl::Shared();
+    {
+        SMutexLock lock(shared.caches_mutex);
+        for (auto cache : shared.caches)
+            cache->release();
+    }
+    shared.release(0);
+}
+
 void RAMIOBuffer::allocate_buffer(uint64_t n) SKR_NOEXCEPT
 {
+    SKR_ASSERT(!bytes && "buffer already allocated!");
     if (n)
     {
-        bytes = (uint8_t*)sakura_mallocN(n, kIOBufferMemoryName);
+        bytes = RAMBufferPool::allocate(n, capacity);
     }
     size = n;
 }
@@ -31,8 +241,9 @@ void RAMIOBuffer::free_buffer() SKR_NOEXCEPT
 {
     if (bytes)
     {
-        sakura_freeN(bytes, kIOBufferMemoryName);
+        RAMBufferPool::free(bytes, capacity);
         bytes = nullptr;
+        capacity = 0;
     }
     size = 0;
 }
@@ -9,6 +9,17 @@ namespace io {
 
 using VFSReaderFutureLauncher = skr::FutureLauncher<bool>;
 
+static uint64_t RAMRequestBytes(IIORequest* request) SKR_NOEXCEPT
+{
+    uint64_t bytes = 0;
+    if (auto pBlocks = io_component<BlocksComponent>(request))
+    {
+        for (const auto& block : pBlocks->blocks)
+            bytes += block.size;
+    }
+    return bytes;
+}
+
 bool VFSRAMReader::fetch(SkrAsyncServicePriority priority, IORequestId request) SKR_NOEXCEPT
 {
     auto pStatus = io_component<IOStatusComponent>(request.get());
@@ -22,7 +33,7 @@ bool VFSRAMReader::fetch(SkrAsyncServicePriority priority, IORequestId request)
     else if (auto pComp = io_component<IOStatusComponent>(request.get()))
     {
         SKR_ASSERT(pComp->getStatus() == SKR_IO_STAGE_RESOLVING);
-        fetched_requests[priority].enqueue(request);
+        fetched_requests[priority][pComp->get_qos_class()].enqueue(request);
         inc_processing(priority);
     }
     return true;
@@ -42,7 +53,8 @@ void VFSRAMReader::dispatchFunction(SkrAsyncServicePriority priority, const IORe
     {
         {
             ZoneScopedN("dispatch_read");
-            if (service->runner.try_cancel(priority, rq))
+            const bool cancelled = service->runner.try_cancel(priority, rq);
+            if (cancelled)
             {
                 // cancel...
                 if (pFile->file) 
@@ -64,11 +76,17 @@ void VFSRAMReader::dispatchFunction(SkrAsyncServicePriority priority, const IORe
                     pStatus->setStatus(SKR_IO_STAGE_LOADING);
                     // SKR_LOG_DEBUG(u8"dispatch read request: %s", rq->path.c_str());
                     uint64_t dst_offset = 0u;
-                    for (const auto& block : pBlocks->blocks)
+                    // a file that failed to open is reported by the resolver, nothing is read
+                    for (uint64_t i = 0; pFile->file && i < pBlocks->blocks.size(); ++i)
                     {
-                        const auto address = buf->get_data() + dst_offset;
+                        const auto& block = pBlocks->blocks[i];
+                        auto address = pBlocks->get_destination(i);
+                        if (!address)
+                        {
+                            address = buf->get_data() + dst_offset;
+                            dst_offset += block.size;
+                        }
                         skr_vfs_fread(pFile->file, address, block.offset, block.size);
-                        dst_offset += block.size;
                     }
                     pStatus->setStatus(SKR_IO_STAGE_LOADED);
                 }
@@ -85,6 +103,9 @@ void VFSRAMReader::dispatchFunction(SkrAsyncServicePriority priority, const IORe
                 // SKR_LOG_DEBUG(u8"dispatch close request: %s", rq->path.c_str());
                 skr_vfs_fclose(pFile->file);
                 pFile->file = nullptr;
+            }
+            if (!cancelled)
+            {
                 loaded_requests[priority].enqueue(rq);
                 inc_processed(priority);
             }
@@ -97,8 +118,34 @@ void VFSRAMReader::dispatchFunction(SkrAsyncServicePriority priority, const IORe
 
 void VFSRAMReader::dispatch(SkrAsyncServicePriority priority) SKR_NOEXCEPT
 {
+    // one read per call, taken from the most critical class that has budget left
     IORequestId rq;
-    if (fetched_requests[priority].try_dequeue(rq))
+    for (uint32_t i = 0; i < SKR_IO_QOS_CLASS_COUNT && !rq; ++i)
+    {
+        auto& throttled = throttled_requests[priority][i];
+        IORequestId candidate = throttled;
+        if (!candidate && !fetched_requests[priority][i].try_dequeue(candidate))
+            continue;
+        // cancelled requests don't read anything, let them through.
+        // the class may have been raised by a shared waiter after the request was queued
+        auto pStatus = io_component<IOStatusComponent>(candidate.get());
+        if (!pStatus->getCancelRequested() && !service->runner.qos.try_acquire(pStatus->get_qos_class(), RAMRequestBytes(candidate.get())))
+        {
+            if (!throttled)
+            {
+                throttled = candidate;
+                throttled_count++;
+            }
+            continue;
+        }
+        if (throttled)
+        {
+            throttled.reset();
+            throttled_count--;
+        }
+        rq = candidate;
+    }
+    if (rq)
     {
         auto launcher = VFSReaderFutureLauncher(job_queue);
         loaded_futures[priority].emplace_back(
@@ -223,8 +270,37 @@ void DStorageRAMReader::enqueueAndSubmit(SkrAsyncServicePriority priority) SKR_N
     TracyCZoneCtx Zone;
     bool bZoneSet = false;
 #endif
-    while (fetched_batches[priority].try_dequeue(batch))
+    // batches held back by their qos class are retried before new ones
+    skr::vector<IOBatchId> candidates;
+    candidates.swap(throttled_batches[priority]);
+    size_t candidate_index = 0;
+    const auto nextBatch = [&]() {
+        if (candidate_index < candidates.size())
+        {
+            batch = candidates[candidate_index++];
+            return true;
+        }
+        return fetched_batches[priority].try_dequeue(batch);
+    };
+    while (nextBatch())
     {
+        // a batch is charged to the most critical class among its requests
+        auto qos = SKR_IO_QOS_CLASS_COUNT;
+        uint64_t bytes = 0;
+        bool cancelling = false;
+        for (auto&& request : batch->get_requests())
+        {
+            auto pStatus = io_component<IOStatusComponent>(request.get());
+            qos = std::min(qos, pStatus->get_qos_class());
+            cancelling |= pStatus->getCancelRequested();
+            bytes += RAMRequestBytes(request.get());
+        }
+        if (qos != SKR_IO_QOS_CLASS_COUNT && !cancelling && !service->runner.qos.try_acquire(qos, bytes))
+        {
+            throttled_batches[priority].emplace_back(batch);
+            continue;
+        }
+
         auto& eref = event;
         if (!eref)
         {
@@ -255,9 +331,15 @@ void DStorageRAMReader::enqueueAndSubmit(SkrAsyncServicePriority priority) SKR_N
                         SKR_ASSERT(pFile->dfile);
                         pStatus->setStatus(SKR_IO_STAGE_LOADING);
                         uint64_t dst_offset = 0u;
-                        for (const auto& block : pBlocks->blocks)
+                        for (uint64_t i = 0; i < pBlocks->blocks.size(); ++i)
                         {
-                            const auto address = buf->get_data() + dst_offset;
+                            const auto& block = pBlocks->blocks[i];
+                            auto address = pBlocks->get_destination(i);
+                            if (!address)
+                            {
+                                address = buf->get_data() + dst_offset;
+                                dst_offset += block.size;
+                            }
                             SkrDStorageIODescriptor io = {};
                             io.name = rq->get_path();
                             io.event = nullptr;
@@ -271,8 +353,6 @@ void DStorageRAMReader::enqueueAndSubmit(SkrAsyncServicePriority priority) SKR_N
                             io.destination = address;
                             io.uncompressed_size = block.size;
                             skr_dstorage_enqueue_request(queue, &io);
-
-                            dst_offset += block.size;
                         }
                     }
                     else
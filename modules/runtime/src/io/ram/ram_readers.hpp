@@ -42,11 +42,15 @@ struct VFSRAMReader final : public RAMReaderBase<IIORequestProcessor>
     void dispatch(SkrAsyncServicePriority priority) SKR_NOEXCEPT;
     void recycle(SkrAsyncServicePriority priority) SKR_NOEXCEPT;
     bool poll_processed_request(SkrAsyncServicePriority priority, IORequestId& request) SKR_NOEXCEPT;
-    bool is_async(SkrAsyncServicePriority priority) const SKR_NOEXCEPT { return job_queue; }
+    // throttled requests are polled by the runner until their class has tokens again
+    bool is_async(SkrAsyncServicePriority priority) const SKR_NOEXCEPT { return job_queue && !throttled_count; }
     void dispatchFunction(SkrAsyncServicePriority priority, const IORequestId& request) SKR_NOEXCEPT;
 
     skr::JobQueue* job_queue = nullptr;
-    IORequestQueue fetched_requests[SKR_ASYNC_SERVICE_PRIORITY_COUNT];
+    IORequestQueue fetched_requests[SKR_ASYNC_SERVICE_PRIORITY_COUNT][SKR_IO_QOS_CLASS_COUNT];
+    // dequeued but over the budget of its class, retried before the queue of the class
+    IORequestId throttled_requests[SKR_ASYNC_SERVICE_PRIORITY_COUNT][SKR_IO_QOS_CLASS_COUNT];
+    uint32_t throttled_count = 0;
     IORequestQueue loaded_requests[SKR_ASYNC_SERVICE_PRIORITY_COUNT];
     skr::vector<skr::IFuture<bool>*> loaded_futures[SKR_ASYNC_SERVICE_PRIORITY_COUNT];
 };
@@ -79,6 +83,8 @@ struct SKR_RUNTIME_API DStorageRAMReader final
     
     IOBatchQueue fetched_batches[SKR_ASYNC_SERVICE_PRIORITY_COUNT];
     IOBatchQueue processed_batches[SKR_ASYNC_SERVICE_PRIORITY_COUNT];
+    // over the budget of their qos class, submitted once the class has tokens again
+    skr::vector<IOBatchId> throttled_batches[SKR_ASYNC_SERVICE_PRIORITY_COUNT];
     eastl::vector<skr::SObjectPtr<DStorageEvent>> submitted[SKR_ASYNC_SERVICE_PRIORITY_COUNT];
 
     SmartPoolPtr<DStorageEvent> events[SKR_ASYNC_SERVICE_PRIORITY_COUNT] = { nullptr, nullptr, nullptr };
@@ -1,4 +1,5 @@
 #include "ram_request.hpp"
+#include "ram_service.hpp"
 
 namespace skr::io {
 
@@ -16,6 +17,8 @@ RAMRequestMixin::RAMRequestMixin(ISmartPoolPtr<IBlocksRAMRequest> pool, const ui
 
 RAMRequestMixin::~RAMRequestMixin() SKR_NOEXCEPT
 {
+    SKR_ASSERT(!inflight_service && "request destroyed while still accepting waiters!");
+    waiters.clear();
     destination.reset();
 }
 
@@ -32,4 +35,21 @@ void RAMIOStatusComponent::setStatus(ESkrIOStage status) SKR_NOEXCEPT
     return IOStatusComponent::setStatus(status);
 }
 
+bool RAMIOStatusComponent::getCancelRequested() const SKR_NOEXCEPT
+{
+    if (!IOStatusComponent::getCancelRequested())
+        return false;
+    // a shared read is only aborted when every waiter gave up on it
+    auto rq = static_cast<RAMRequestMixin*>(request);
+    if (auto service = rq->inflight_service)
+        return service->waitersCancelled(rq);
+    for (auto&& waiter : rq->waiters)
+    {
+        auto pStatus = io_component<IOStatusComponent>(waiter.get());
+        if (!pStatus->getCancelRequested())
+            return false;
+    }
+    return true;
+}
+
 } // namespace skr::io
\ No newline at end of file
@@ -18,6 +18,7 @@ struct RAMIOStatusComponent final : public IOStatusComponent
 {
     RAMIOStatusComponent(IIORequest* const request) SKR_NOEXCEPT;
     void setStatus(ESkrIOStage status) SKR_NOEXCEPT override;
+    bool getCancelRequested() const SKR_NOEXCEPT override;
 };
 
 struct RAMRequestMixin final : public IORequestMixin<IBlocksRAMRequest, 
@@ -30,6 +31,12 @@ struct RAMRequestMixin final : public IORequestMixin<IBlocksRAMRequest,
     ~RAMRequestMixin() SKR_NOEXCEPT;
 
     RAMIOBufferId destination = nullptr;
+
+    // identical requests submitted while this one is queued or in flight,
+    // they share the destination buffer and are settled together with this request
+    eastl::fixed_vector<IORequestId, 1> waiters;
+    struct RAMService* inflight_service = nullptr;
+    uint64_t inflight_hash = 0;
 protected:
     RAMRequestMixin(ISmartPoolPtr<IBlocksRAMRequest> pool, const uint64_t sequence) SKR_NOEXCEPT;
     const uint64_t sequence = UINT64_MAX;
@@ -11,29 +11,37 @@ void AllocateIOBufferResolver::resolve(SkrAsyncServicePriority priority, IOBatch
     auto rq = skr::static_pointer_cast<RAMRequestMixin>(request);
     auto buf = skr::static_pointer_cast<RAMIOBuffer>(rq->destination);
     auto pFiles = io_component<FileComponent>(rq.get());
+    // the file failed to open, the request completes with an empty buffer
+    if (pFiles && !pFiles->file && !pFiles->dfile)
+        return;
     // deal with 0 block size
+    uint64_t size = 0;
+    bool all_external = true;
     if (auto pBlocks = io_component<BlocksComponent>(rq.get()))
     {
-        for (auto& block : pBlocks->blocks)
+        for (uint64_t i = 0; i < pBlocks->blocks.size(); ++i)
         {
+            auto& block = pBlocks->blocks[i];
             if (block.size == 0)
             {
                 block.size = pFiles->get_fsize() - block.offset;
             }
-            if (buf->get_size() == 0)
+            // blocks with caller memory are read in place and take no room in the buffer
+            if (!pBlocks->get_destination(i))
             {
-                buf->size += block.size;
+                size += block.size;
+                all_external = false;
             }
         }
     }
     // allocate
-    if (buf->get_data() == nullptr)
+    if (buf->get_data() == nullptr && !all_external)
     {
-        if (buf->get_size() == 0)
+        if (size == 0)
         {
             SKR_ASSERT(0 && "invalid destination size");
         }
-        buf->allocate_buffer(buf->size);
+        buf->allocate_buffer(size);
     }
 }
 
@@ -58,19 +66,29 @@ void ChunkingVFSReadResolver::resolve(SkrAsyncServicePriority priority, IOBatchI
         if (auto pComp = io_component<BlocksComponent>(request.get()))
         {
             auto bks = pComp->blocks;
+            auto dsts = pComp->destinations;
             pComp->reset_blocks();
             pComp->blocks.reserve(chunk_count);
-            for (auto& block : bks)
+            for (uint64_t i = 0; i < bks.size(); ++i)
             {
+                const auto& block = bks[i];
+                uint8_t* dst = (i < dsts.size()) ? dsts[i] : nullptr;
+                const auto add_chunk = [&](uint64_t offset, uint64_t size) {
+                    if (dst)
+                        pComp->add_block({offset, size}, dst + (offset - block.offset));
+                    else
+                        pComp->add_block({offset, size});
+                };
                 uint64_t acc_size = block.size;
                 uint64_t acc_offset = block.offset;
-                while (acc_size > chunk_size)
+                while (acc_size >= 2 * chunk_size)
                 {
-                    pComp->add_block({acc_offset, chunk_size});
+                    add_chunk(acc_offset, chunk_size);
                     acc_offset += chunk_size;
                     acc_size -= chunk_size;
                 }
-                pComp->get_blocks().back().size += acc_size;
+                // the tail is merged into the last chunk, small blocks are kept whole
+                add_chunk(acc_offset, acc_size);
             }
         }
     }
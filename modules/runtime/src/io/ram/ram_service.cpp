@@ -1,4 +1,5 @@
 #include "SkrRT/async/wait_timeout.hpp"
+#include "SkrRT/misc/hash.h"
 #include "../dstorage/dstorage_resolvers.hpp"
 
 #include "ram_service.hpp"
@@ -28,12 +29,30 @@ inline static IOReaderId<IIOBatchProcessor> CreateBatchReader(RAMService* servic
 #endif
     return nullptr;
 }
+
+inline static uint64_t HashSource(skr_vfs_t* vfs, const skr::string& path, skr::span<const skr_io_block_t> blocks) SKR_NOEXCEPT
+{
+    auto hash = skr_hash64(&vfs, sizeof(vfs), SKR_DEFAULT_HASH_SEED_64);
+    hash = skr_hash64(path.u8_str(), path.size(), hash);
+    return skr_hash64(blocks.data(), blocks.size() * sizeof(skr_io_block_t), hash);
+}
+
+inline static bool SameBlocks(skr::span<const skr_io_block_t> a, skr::span<const skr_io_block_t> b) SKR_NOEXCEPT
+{
+    if (a.size() != b.size()) 
+        return false;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        if (a[i].offset != b[i].offset || a[i].size != b[i].size)
+            return false;
+    }
+    return true;
+}
 } // namespace RAMUtils
 
 uint32_t RAMService::global_idx = 0;
 RAMService::RAMService(const skr_ram_io_service_desc_t* desc) SKR_NOEXCEPT
     : name(desc->name ? skr::string(desc->name) : skr::format(u8"RAMService-{}", global_idx++)), 
-      awake_at_request(desc->awake_at_request),
       runner(this, desc->callback_job_queue)
 {
     request_pool = SmartPoolPtr<RAMRequestMixin, IBlocksRAMRequest>::Create(kIOPoolObjectsMemoryName);
@@ -46,15 +65,18 @@ RAMService::RAMService(const skr_ram_io_service_desc_t* desc) SKR_NOEXCEPT
 
     runner.set_resolvers();
 
-    if (!desc->awake_at_request)
-    {
-        if (desc->sleep_time > 2000)
-        {
-            SKR_ASSERT(desc->sleep_time <= 2000);
-            SKR_LOG_FATAL(u8"RAMService: too long sleep_time causes 'deadlock' when awake_at_request is false");
-        }
-    }
+    // an idle runner blocks until a request wakes it, requests always do
+    runner.batch_requests = !desc->awake_at_request;
     runner.set_sleep_time(desc->sleep_time);
+    for (uint32_t i = 0; i < SKR_IO_QOS_CLASS_COUNT; ++i)
+        runner.qos.set_budget((ESkrIOQoSClass)i, desc->qos_budgets[i]);
+    skr_init_mutex_recursive(&inflight_mutex);
+}
+
+RAMService::~RAMService() SKR_NOEXCEPT
+{
+    SKR_ASSERT(inflight_requests.empty() && "RAMService destroyed with requests in flight!");
+    skr_destroy_mutex(&inflight_mutex);
 }
 
 skr_io_ram_service_t* IRAMService::create(const skr_ram_io_service_desc_t* desc) SKR_NOEXCEPT
@@ -69,6 +91,8 @@ void IRAMService::destroy(skr_io_ram_service_t* service) SKR_NOEXCEPT
     auto S = static_cast<RAMService*>(service);
     S->runner.destroy();
     SkrDelete(S);
+    // buffers still referenced by users go back to the pool when they are released
+    RAMBufferPool::trim();
 }
 
 IOBatchId RAMService::open_batch(uint64_t n) SKR_NOEXCEPT
@@ -86,22 +110,112 @@ BlocksRAMRequestId RAMService::open_request() SKR_NOEXCEPT
 void RAMService::request(IOBatchId batch) SKR_NOEXCEPT
 {
     runner.enqueueBatch(batch);
-    if (awake_at_request)
-    {
-        runner.awake();
-    }
+    runner.awake();
 }
 
 RAMIOBufferId RAMService::request(IORequestId request, skr_io_future_t* future, SkrAsyncServicePriority priority) SKR_NOEXCEPT
 {
-    auto batch = open_batch(1);
-    auto result = batch->add_request(request, future);
-    auto buffer = skr::static_pointer_cast<RAMIOBuffer>(result);
-    batch->set_priority(priority);
+    auto rq = skr::static_pointer_cast<RAMRequestMixin>(request);
+    auto pPath = io_component<PathSrcComponent>(rq.get());
+    auto pBlocks = io_component<BlocksComponent>(rq.get());
+    // every reader into caller memory needs its own copy of the bytes, so they are never shared
+    if (pBlocks->has_destinations())
+    {
+        auto batch = open_batch(1);
+        auto result = batch->add_request(request, future);
+        batch->set_priority(priority);
+        this->request(batch);
+        return skr::static_pointer_cast<RAMIOBuffer>(result);
+    }
+    const auto hash = RAMUtils::HashSource(pPath->vfs, pPath->path, pBlocks->blocks);
+
+    IOBatchId batch = nullptr;
+    RAMIOBufferId buffer = nullptr;
+    {
+        SMutexLock inflight_lock(inflight_mutex);
+        auto found = inflight_requests.find(hash);
+        if (found != inflight_requests.end())
+        {
+            // same file range is already queued or in flight, share its buffer
+            if (auto shared = attachWaiter(found->second, rq.get(), future))
+                return shared;
+        }
+        batch = open_batch(1);
+        auto result = batch->add_request(request, future);
+        buffer = skr::static_pointer_cast<RAMIOBuffer>(result);
+        batch->set_priority(priority);
+        if (found == inflight_requests.end())
+        {
+            auto& entry = inflight_requests[hash];
+            entry.request = rq.get();
+            entry.vfs = pPath->vfs;
+            entry.path = pPath->path;
+            entry.blocks = pBlocks->blocks;
+            rq->inflight_service = this;
+            rq->inflight_hash = hash;
+        }
+    }
     this->request(batch);
     return buffer;
 }
 
+RAMIOBufferId RAMService::attachWaiter(InflightEntry& entry, RAMRequestMixin* rq, skr_io_future_t* future) SKR_NOEXCEPT
+{
+    auto pPath = io_component<PathSrcComponent>(rq);
+    auto pBlocks = io_component<BlocksComponent>(rq);
+    if (entry.vfs != pPath->vfs || entry.path != pPath->path)
+        return nullptr;
+    if (!RAMUtils::SameBlocks(entry.blocks, pBlocks->blocks))
+        return nullptr;
+    
+    auto primary = entry.request;
+    auto pStatus = io_component<IOStatusComponent>(rq);
+    auto pPrimaryStatus = io_component<IOStatusComponent>(primary);
+    // every reader gave up on it and the runner may cancel it any time, read on our own
+    if (pPrimaryStatus->getCancelRequested())
+        return nullptr;
+    // the shared read runs with the budget of its most critical reader
+    if (pStatus->get_qos_class() < pPrimaryStatus->get_qos_class())
+        pPrimaryStatus->set_qos_class(pStatus->get_qos_class());
+    pStatus->future = future;
+    pStatus->owner_batch = nullptr; // never enters the runner, settled by the primary
+    if (runner.tracer.is_tracing())
+        pStatus->enable_stage_trace();
+    rq->destination = primary->destination;
+    primary->waiters.emplace_back(rq);
+    pStatus->setStatus(SKR_IO_STAGE_ENQUEUED);
+    return rq->destination;
+}
+
+bool RAMService::waitersCancelled(RAMRequestMixin* rq) SKR_NOEXCEPT
+{
+    SMutexLock inflight_lock(inflight_mutex);
+    for (auto&& waiter : rq->waiters)
+    {
+        auto pStatus = io_component<IOStatusComponent>(waiter.get());
+        if (!pStatus->getCancelRequested())
+            return false;
+    }
+    return true;
+}
+
+void RAMService::retire(RAMRequestMixin* rq) SKR_NOEXCEPT
+{
+    SMutexLock inflight_lock(inflight_mutex);
+    retire_(rq);
+}
+
+void RAMService::retire_(RAMRequestMixin* rq) SKR_NOEXCEPT
+{
+    if (rq->inflight_service)
+    {
+        auto found = inflight_requests.find(rq->inflight_hash);
+        if (found != inflight_requests.end() && found->second.request == rq)
+            inflight_requests.erase(found);
+        rq->inflight_service = nullptr;
+    }
+}
+
 void RAMService::stop(bool wait_drain) SKR_NOEXCEPT
 {
     if (wait_drain)
@@ -143,6 +257,27 @@ SkrAsyncServiceStatus RAMService::get_service_status() const SKR_NOEXCEPT
     return runner.getServiceStatus();
 }
 
+void RAMService::set_qos_budget(ESkrIOQoSClass qos, const skr_io_qos_budget_t& budget) SKR_NOEXCEPT
+{
+    runner.qos.set_budget(qos, budget);
+    runner.awake();
+}
+
+skr_io_qos_stats_t RAMService::get_qos_stats(ESkrIOQoSClass qos) const SKR_NOEXCEPT
+{
+    return runner.qos.get_stats(qos);
+}
+
+bool RAMService::begin_trace(skr_vfs_t* vfs, const char8_t* path) SKR_NOEXCEPT
+{
+    return runner.tracer.begin(vfs, path, SKR_IO_ENDPOINT_RAM);
+}
+
+void RAMService::end_trace() SKR_NOEXCEPT
+{
+    runner.tracer.end();
+}
+
 void RAMService::poll_finish_callbacks() SKR_NOEXCEPT
 {
     runner.poll_finish_callbacks();
@@ -164,6 +299,8 @@ void RAMService::Runner::enqueueBatch(const IOBatchId& batch) SKR_NOEXCEPT
         {
             auto status = pStatus->getStatus();
             SKR_ASSERT(status == SKR_IO_STAGE_NONE);
+            if (tracer.is_tracing())
+                pStatus->enable_stage_trace();
             pStatus->setStatus(SKR_IO_STAGE_ENQUEUED);
         }
     }
@@ -171,6 +308,54 @@ void RAMService::Runner::enqueueBatch(const IOBatchId& batch) SKR_NOEXCEPT
     skr_atomic64_add_relaxed(&processing_request_counts[priority], 1);
 }
 
+bool RAMService::Runner::complete_(IIORequest* rq, SkrAsyncServicePriority priority) SKR_NOEXCEPT
+{
+    service->retire(static_cast<RAMRequestMixin*>(rq));
+    RunnerBase::complete_(rq, priority);
+    settleWaiters(rq, priority, SKR_IO_STAGE_COMPLETED);
+    return true;
+}
+
+bool RAMService::Runner::cancel_(IIORequest* rq, SkrAsyncServicePriority priority) SKR_NOEXCEPT
+{
+    service->retire(static_cast<RAMRequestMixin*>(rq));
+    RunnerBase::cancel_(rq, priority);
+    settleWaiters(rq, priority, SKR_IO_STAGE_CANCELLED);
+    return true;
+}
+
+void RAMService::Runner::settleWaiters(IIORequest* request, SkrAsyncServicePriority priority, ESkrIOStage stage) SKR_NOEXCEPT
+{
+    // retired above, no new waiter can be attached from here
+    auto rq = static_cast<RAMRequestMixin*>(request);
+    auto pPrimaryStatus = io_component<IOStatusComponent>(request);
+    const bool failed = pPrimaryStatus && pPrimaryStatus->getFailed();
+    for (auto&& waiter : rq->waiters)
+    {
+        if (auto pStatus = io_component<IOStatusComponent>(waiter.get()))
+        {
+            if (failed)
+                pStatus->setFailed();
+            if (stage == SKR_IO_STAGE_COMPLETED)
+                pStatus->setStatus(SKR_IO_STAGE_LOADED);
+            pStatus->setStatus(stage);
+            finish_(waiter.get(), priority);
+        }
+    }
+    rq->waiters.clear();
+}
+
+uint64_t RAMService::Runner::trace_bytes_(IIORequest* rq) const SKR_NOEXCEPT
+{
+    // waiters carry unresolved blocks, the shared destination has the real size
+    // requests reading into caller memory are never shared and resolve their own blocks
+    auto ram_rq = static_cast<RAMRequestMixin*>(rq);
+    auto pBlocks = io_component<BlocksComponent>(rq);
+    if (!ram_rq->destination || (pBlocks && pBlocks->has_destinations()))
+        return RunnerBase::trace_bytes_(rq);
+    return ram_rq->destination->get_size();
+}
+
 void RAMService::Runner::set_resolvers() SKR_NOEXCEPT
 {
     auto alloc_buffer = SObjectPtr<AllocateIOBufferResolver>::Create();
@@ -1,4 +1,5 @@
 #pragma once
+#include "SkrRT/platform/thread.h"
 #include "../common/io_runnner.hpp"
 #include "../common/processors.hpp"
 #include "ram_batch.hpp"
@@ -11,6 +12,7 @@ namespace io {
 struct RAMService final : public IRAMService
 {
     RAMService(const skr_ram_io_service_desc_t* desc) SKR_NOEXCEPT;
+    ~RAMService() SKR_NOEXCEPT;
     
     [[nodiscard]] IOBatchId open_batch(uint64_t n) SKR_NOEXCEPT;
     [[nodiscard]] BlocksRAMRequestId open_request() SKR_NOEXCEPT;
@@ -26,6 +28,10 @@ struct RAMService final : public IRAMService
     void drain(SkrAsyncServicePriority priority = SKR_ASYNC_SERVICE_PRIORITY_COUNT) SKR_NOEXCEPT;
     void set_sleep_time(uint32_t time) SKR_NOEXCEPT;
     SkrAsyncServiceStatus get_service_status() const SKR_NOEXCEPT;
+    void set_qos_budget(ESkrIOQoSClass qos, const skr_io_qos_budget_t& budget) SKR_NOEXCEPT;
+    skr_io_qos_stats_t get_qos_stats(ESkrIOQoSClass qos) const SKR_NOEXCEPT;
+    bool begin_trace(skr_vfs_t* vfs, const char8_t* path) SKR_NOEXCEPT;
+    void end_trace() SKR_NOEXCEPT;
     void poll_finish_callbacks() SKR_NOEXCEPT;
 
     struct Runner final : public RunnerBase
@@ -35,26 +41,52 @@ struct RAMService final : public IRAMService
         void enqueueBatch(const IOBatchId& batch) SKR_NOEXCEPT;
         void set_resolvers() SKR_NOEXCEPT;
 
+    protected:
+        bool complete_(IIORequest* rq, SkrAsyncServicePriority priority) SKR_NOEXCEPT override;
+        bool cancel_(IIORequest* rq, SkrAsyncServicePriority priority) SKR_NOEXCEPT override;
+        void settleWaiters(IIORequest* rq, SkrAsyncServicePriority priority, ESkrIOStage stage) SKR_NOEXCEPT;
+        uint64_t trace_bytes_(IIORequest* rq) const SKR_NOEXCEPT override;
+
+    public:
+
         IOBatchBufferId batch_buffer = nullptr;
         IOReaderId<IIORequestProcessor> vfs_reader = nullptr;
         IOReaderId<IIOBatchProcessor> ds_reader = nullptr;
         RAMService* service = nullptr;
     };
     const skr::string name;
-    const bool awake_at_request = false;
     Runner runner;
     
     SmartPoolPtr<RAMRequestMixin, IBlocksRAMRequest> request_pool = nullptr;
     SmartPoolPtr<RAMIOBuffer, IRAMIOBuffer> ram_buffer_pool = nullptr;
     SmartPoolPtr<RAMIOBatch, IIOBatch> ram_batch_pool = nullptr;
+
+    // true when every waiter of a shared read asked to cancel, the cancel path retires it
+    bool waitersCancelled(RAMRequestMixin* rq) SKR_NOEXCEPT;
+    void retire(RAMRequestMixin* rq) SKR_NOEXCEPT;
     
 private:
+    struct InflightEntry
+    {
+        RAMRequestMixin* request = nullptr;
+        skr_vfs_t* vfs = nullptr;
+        skr::string path;
+        eastl::fixed_vector<skr_io_block_t, 1> blocks;
+    };
+    RAMIOBufferId attachWaiter(InflightEntry& entry, RAMRequestMixin* rq, skr_io_future_t* future) SKR_NOEXCEPT;
+    void retire_(RAMRequestMixin* rq) SKR_NOEXCEPT;
+
     RAMIOBuffer allocateBuffer(uint64_t n) SKR_NOEXCEPT;
     void freeBuffer(RAMIOBuffer* buffer) SKR_NOEXCEPT;
 
     static uint32_t global_idx;
     SAtomicU64 request_sequence = 0;
     SAtomicU64 batch_sequence = 0;
+
+    // (vfs, path, blocks) hash -> request queued or in flight, recursive because
+    // status callbacks fired under the lock may submit new requests
+    SMutex inflight_mutex;
+    skr::flat_hash_map<uint64_t, InflightEntry> inflight_requests;
 };
 
 } // namespace io
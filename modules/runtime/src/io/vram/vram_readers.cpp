@@ -170,6 +170,7 @@ void CommonVRAMReader::addRAMRequests(SkrAsyncServicePriority priority) SKR_NOEX
                     if (pPath->vfs)
                         ram_request->set_vfs(pPath->vfs);
                     ram_request->set_path(pPath->path.u8_str());
+                    ram_request->set_qos_class(pStatus->get_qos_class());
                     // TODO: READ PARTIAL DATA ONLY NEEDED FROM FILE
                     ram_request->add_block({});
                     auto result = ram_batch->add_request(ram_request, &pUpload->ram_future);
@@ -240,8 +241,22 @@ void CommonVRAMReader::addUploadRequests(SkrAsyncServicePriority priority) SKR_N
     auto&& batches = to_upload_batches[priority];
     for (auto&& batch : batches)
     {
-        eastl::fixed_map<CGPUQueueId, GPUUploadCmd, 1> cmds;
         auto requests = batch->get_requests();
+        {
+            // a batch is charged to the most critical class among its requests,
+            // batches over budget stay queued until the class has tokens again
+            auto qos = SKR_IO_QOS_CLASS_COUNT;
+            uint64_t bytes = 0;
+            for (auto&& request : requests)
+            {
+                qos = std::min(qos, io_component<IOStatusComponent>(request.get())->get_qos_class());
+                bytes += io_component<VRAMUploadComponent>(request.get())->size;
+            }
+            if (qos != SKR_IO_QOS_CLASS_COUNT && !service->runner.qos.try_acquire(qos, bytes))
+                continue;
+        }
+
+        eastl::fixed_map<CGPUQueueId, GPUUploadCmd, 1> cmds;
         for (auto&& request : requests)
         {
             auto pUpload = io_component<VRAMUploadComponent>(request.get());
@@ -381,10 +396,14 @@ void CommonVRAMReader::addUploadRequests(SkrAsyncServicePriority priority) SKR_N
                 cgpu_submit_queue(queue, &submit);
             }
         }
+        batch.reset();
     }
 
-    // clear batches & swap all pools
-    batches.clear();
+    // remove submitted batches & swap all pools
+    batches.erase(
+    eastl::remove_if(batches.begin(), batches.end(), [](auto& batch) {
+        return (batch == nullptr);
+    }), batches.end());
     for (auto&& [queue, pool] : cmdpools)
     {
         pool.swap();
@@ -33,7 +33,6 @@ inline static IOReaderId<IIOBatchProcessor> CreateDSReader(VRAMService* service,
 uint32_t VRAMService::global_idx = 0;
 VRAMService::VRAMService(const VRAMServiceDescriptor* desc) SKR_NOEXCEPT
     : name(desc->name ? skr::string(desc->name) : skr::format(u8"VRAMService-{}", global_idx++)), 
-      awake_at_request(desc->awake_at_request),
       runner(this, desc->callback_job_queue)
 {
     slices_pool = VRAMRequestPool<ISlicesVRAMRequest>::Create(kIOPoolObjectsMemoryName);
@@ -52,12 +51,11 @@ VRAMService::VRAMService(const VRAMServiceDescriptor* desc) SKR_NOEXCEPT
     runner.common_reader = VRAMUtils::CreateCommonReader(this, desc);
     runner.set_resolvers();
 
-    if ((!desc->awake_at_request) && (desc->sleep_time > 2000))
-    {
-        SKR_ASSERT(desc->sleep_time <= 2000);
-        SKR_LOG_FATAL(u8"RAMService: too long sleep_time causes 'deadlock' when awake_at_request is false");
-    }
+    // an idle runner blocks until a request wakes it, requests always do
+    runner.batch_requests = !desc->awake_at_request;
     runner.set_sleep_time(desc->sleep_time);
+    for (uint32_t i = 0; i < SKR_IO_QOS_CLASS_COUNT; ++i)
+        runner.qos.set_budget((ESkrIOQoSClass)i, desc->qos_budgets[i]);
 }
 
 IVRAMService* IVRAMService::create(const VRAMServiceDescriptor* desc) SKR_NOEXCEPT
@@ -95,10 +93,7 @@ BlocksVRAMRequestId VRAMService::open_buffer_request() SKR_NOEXCEPT
 void VRAMService::request(IOBatchId batch) SKR_NOEXCEPT
 {
     runner.enqueueBatch(batch);
-    if (awake_at_request)
-    {
-        runner.awake();
-    }
+    runner.awake();
 }
 
 VRAMIOBufferId VRAMService::request(BlocksVRAMRequestId request, IOFuture* future, SkrAsyncServicePriority priority) SKR_NOEXCEPT
@@ -162,6 +157,27 @@ SkrAsyncServiceStatus VRAMService::get_service_status() const SKR_NOEXCEPT
     return runner.getServiceStatus();
 }
 
+void VRAMService::set_qos_budget(ESkrIOQoSClass qos, const skr_io_qos_budget_t& budget) SKR_NOEXCEPT
+{
+    runner.qos.set_budget(qos, budget);
+    runner.awake();
+}
+
+skr_io_qos_stats_t VRAMService::get_qos_stats(ESkrIOQoSClass qos) const SKR_NOEXCEPT
+{
+    return runner.qos.get_stats(qos);
+}
+
+bool VRAMService::begin_trace(skr_vfs_t* vfs, const char8_t* path) SKR_NOEXCEPT
+{
+    return runner.tracer.begin(vfs, path, SKR_IO_ENDPOINT_VRAM);
+}
+
+void VRAMService::end_trace() SKR_NOEXCEPT
+{
+    runner.tracer.end();
+}
+
 void VRAMService::poll_finish_callbacks() SKR_NOEXCEPT
 {
     runner.poll_finish_callbacks();
@@ -183,6 +199,8 @@ void VRAMService::Runner::enqueueBatch(const IOBatchId& batch) SKR_NOEXCEPT
         {
             auto status = pStatus->getStatus();
             SKR_ASSERT(status == SKR_IO_STAGE_NONE);
+            if (tracer.is_tracing())
+                pStatus->enable_stage_trace();
             pStatus->setStatus(SKR_IO_STAGE_ENQUEUED);
         }
     }
@@ -190,6 +208,16 @@ void VRAMService::Runner::enqueueBatch(const IOBatchId& batch) SKR_NOEXCEPT
     skr_atomic64_add_relaxed(&processing_request_counts[priority], 1);
 }
 
+uint64_t VRAMService::Runner::trace_bytes_(IIORequest* rq) const SKR_NOEXCEPT
+{
+    // uploaded bytes, read from the file or copied from memory
+    if (auto pUpload = io_component<VRAMUploadComponent>(rq); pUpload && pUpload->size)
+        return pUpload->size;
+    if (auto pMemory = io_component<MemorySrcComponent>(rq))
+        return pMemory->size;
+    return 0;
+}
+
 void VRAMService::Runner::set_resolvers() SKR_NOEXCEPT
 {
     auto chain = skr::static_pointer_cast<IORequestResolverChain>(IIORequestResolverChain::Create());
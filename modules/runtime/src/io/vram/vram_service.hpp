@@ -29,6 +29,10 @@ struct VRAMService final : public IVRAMService
     void drain(SkrAsyncServicePriority priority = SKR_ASYNC_SERVICE_PRIORITY_COUNT) SKR_NOEXCEPT;
     void set_sleep_time(uint32_t time) SKR_NOEXCEPT;
     SkrAsyncServiceStatus get_service_status() const SKR_NOEXCEPT;
+    void set_qos_budget(ESkrIOQoSClass qos, const skr_io_qos_budget_t& budget) SKR_NOEXCEPT;
+    skr_io_qos_stats_t get_qos_stats(ESkrIOQoSClass qos) const SKR_NOEXCEPT;
+    bool begin_trace(skr_vfs_t* vfs, const char8_t* path) SKR_NOEXCEPT;
+    void end_trace() SKR_NOEXCEPT;
     void poll_finish_callbacks() SKR_NOEXCEPT;
 
     struct Runner final : public RunnerBase
@@ -37,6 +41,10 @@ struct VRAMService final : public IVRAMService
         void enqueueBatch(const IOBatchId& batch) SKR_NOEXCEPT;
         void set_resolvers() SKR_NOEXCEPT;
 
+    protected:
+        uint64_t trace_bytes_(IIORequest* rq) const SKR_NOEXCEPT override;
+
+    public:
         IOBatchBufferId batch_buffer = nullptr;
         IOReaderId<IIOBatchProcessor> ds_reader = nullptr;
         IOReaderId<IIOBatchProcessor> common_reader = nullptr;
@@ -45,7 +53,6 @@ struct VRAMService final : public IVRAMService
     };
 
     const skr::string name;    
-    const bool awake_at_request = false;
     Runner runner;
     
     template <typename Interface>
@@ -106,8 +106,9 @@ size_t skr_stdio_fwrite(skr_vfile_t* file, const void* out_buffer, size_t offset
     {
         auto vfile = (skr_vfile_stdio_t*)file;
         fseek(vfile->fh, (long)offset, SEEK_SET); // seek to offset of file
-        auto result = fwrite(out_buffer, byte_count, 1, vfile->fh);
+        auto result = fwrite(out_buffer, 1, byte_count, vfile->fh); // bytes written, same as the posix backend
         fseek(vfile->fh, 0, SEEK_SET); // seek back to beginning of file
+        vfile->offset = 0;
         return result;
     }
     return -1;
@@ -139,6 +140,7 @@ bool skr_stdio_fclose(skr_vfile_t* file) SKR_NOEXCEPT
     return false;
 }
 
+#if !defined(SKR_OS_UNIX) // unix/unix_vfs.cpp provides the native posix procs
 void skr_vfs_get_native_procs(struct skr_vfs_proctable_t* procs) SKR_NOEXCEPT
 {
     procs->fopen = &skr_stdio_fopen;
@@ -146,4 +148,5 @@ void skr_vfs_get_native_procs(struct skr_vfs_proctable_t* procs) SKR_NOEXCEPT
     procs->fread = &skr_stdio_fread;
     procs->fwrite = &skr_stdio_fwrite;
     procs->fsize = &skr_stdio_fsize;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
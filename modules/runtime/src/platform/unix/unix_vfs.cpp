@@ -2,39 +2,511 @@
 #include "SkrRT/misc/log.h"
 #include <SkrRT/platform/filesystem.hpp>
 #include "SkrRT/platform/memory.h"
+#include "SkrRT/platform/thread.h"
+#include "SkrRT/containers/string.hpp"
+#include "SkrRT/containers/hashmap.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/stat.h>
 
-struct skr_vfile_cfile_t : public skr_vfile_t {
-    FILE* cfile;
+#include "tracy/Tracy.hpp"
+
+// native posix backend: every read is a pread on a descriptor, so one handle can serve
+// concurrent positional reads and there is no stdio buffer or seek in between.
+// read-only descriptors are shared through a small lru cache keyed by path.
+namespace skr::vfs_posix
+{
+static constexpr uint32_t kMaxIdleDescriptors = 64;
+
+// what a path resolved to when its descriptor was opened, a mismatch means the file was replaced or rewritten
+struct FileIdentity {
+    dev_t dev = 0;
+    ino_t ino = 0;
+    off_t size = 0;
+    int64_t mtime_ns = 0;
+
+    static FileIdentity FromStat(const struct stat& st)
+    {
+        FileIdentity id;
+        id.dev = st.st_dev;
+        id.ino = st.st_ino;
+        id.size = st.st_size;
+#if defined(__APPLE__)
+        id.mtime_ns = (int64_t)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+        id.mtime_ns = (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+        return id;
+    }
+    bool operator==(const FileIdentity& other) const
+    {
+        return dev == other.dev && ino == other.ino && size == other.size && mtime_ns == other.mtime_ns;
+    }
+};
+
+struct Descriptor {
+    skr::string path;
+    int fd = -1;
+    FileIdentity identity;
+    uint32_t refs = 0;
+    // the file was replaced or opened for writing since, no longer in the cache and closed on last release
+    bool stale = false;
+    Descriptor* lru_prev = nullptr;
+    Descriptor* lru_next = nullptr;
+};
+
+struct DescriptorCache {
+    DescriptorCache() { skr_init_mutex(&mutex); }
+
+    // `identity` is what the path resolves to now, a descriptor of a replaced or rewritten file is dropped
+    Descriptor* acquire(const skr::string& path, const FileIdentity& identity)
+    {
+        Descriptor* evicted = nullptr;
+        {
+            SMutexLock lock(mutex);
+            auto iter = descriptors.find(path);
+            if (iter == descriptors.end())
+                return nullptr;
+            auto desc = iter->second;
+            if (desc->identity == identity)
+            {
+                if (desc->refs++ == 0)
+                    unlink_idle(desc);
+                return desc;
+            }
+            descriptors.erase(iter);
+            evicted = detach(desc);
+        }
+        if (evicted)
+        {
+            ::close(evicted->fd);
+            SkrDelete(evicted);
+        }
+        return nullptr;
+    }
+
+    // returns the descriptor that ends up cached, `desc` is closed if another thread raced us
+    Descriptor* insert(Descriptor* desc)
+    {
+        Descriptor* evicted = nullptr;
+        Descriptor* result = desc;
+        {
+            SMutexLock lock(mutex);
+            auto iter = descriptors.find(desc->path);
+            if (iter != descriptors.end() && iter->second->identity == desc->identity)
+            {
+                result = iter->second;
+                if (result->refs++ == 0)
+                    unlink_idle(result);
+                evicted = desc;
+            }
+            else
+            {
+                if (iter != descriptors.end())
+                {
+                    evicted = detach(iter->second);
+                    descriptors.erase(iter);
+                }
+                desc->refs = 1;
+                descriptors.emplace(desc->path, desc);
+            }
+        }
+        if (evicted)
+        {
+            ::close(evicted->fd);
+            SkrDelete(evicted);
+        }
+        return result;
+    }
+
+    void release(Descriptor* desc)
+    {
+        Descriptor* evicted = nullptr;
+        {
+            SMutexLock lock(mutex);
+            if (--desc->refs)
+                return;
+            if (desc->stale)
+            {
+                evicted = desc;
+            }
+            else
+            {
+                link_idle(desc);
+                if (idle_count > kMaxIdleDescriptors)
+                {
+                    evicted = idle_head;
+                    unlink_idle(evicted);
+                    descriptors.erase(evicted->path);
+                }
+            }
+        }
+        if (evicted)
+        {
+            ::close(evicted->fd);
+            SkrDelete(evicted);
+        }
+    }
+
+    // called before a path is opened for writing, cached readers must not see a half written file
+    void invalidate(const skr::string& path)
+    {
+        Descriptor* evicted = nullptr;
+        {
+            SMutexLock lock(mutex);
+            auto iter = descriptors.find(path);
+            if (iter == descriptors.end())
+                return;
+            evicted = detach(iter->second);
+            descriptors.erase(iter);
+        }
+        if (evicted)
+        {
+            ::close(evicted->fd);
+            SkrDelete(evicted);
+        }
+    }
+
+    static DescriptorCache& Get()
+    {
+        // immortal, vfiles may be closed from static destructors
+        static DescriptorCache* cache = SkrNew<DescriptorCache>();
+        return *cache;
+    }
+
+private:
+    // the caller erases desc from the map, returns it when idle so it can be closed outside the lock
+    Descriptor* detach(Descriptor* desc)
+    {
+        if (desc->refs)
+        {
+            desc->stale = true;
+            return nullptr;
+        }
+        unlink_idle(desc);
+        return desc;
+    }
+
+    void link_idle(Descriptor* desc)
+    {
+        desc->lru_prev = idle_tail;
+        desc->lru_next = nullptr;
+        if (idle_tail)
+            idle_tail->lru_next = desc;
+        else
+            idle_head = desc;
+        idle_tail = desc;
+        idle_count++;
+    }
+
+    void unlink_idle(Descriptor* desc)
+    {
+        if (desc->lru_prev)
+            desc->lru_prev->lru_next = desc->lru_next;
+        else
+            idle_head = desc->lru_next;
+        if (desc->lru_next)
+            desc->lru_next->lru_prev = desc->lru_prev;
+        else
+            idle_tail = desc->lru_prev;
+        desc->lru_prev = desc->lru_next = nullptr;
+        idle_count--;
+    }
+
+    SMutex mutex;
+    skr::flat_hash_map<skr::string, Descriptor*, skr::hash<skr::string>> descriptors;
+    Descriptor* idle_head = nullptr;
+    Descriptor* idle_tail = nullptr;
+    uint32_t idle_count = 0;
+};
+
+static int open_flags(ESkrFileMode mode, ESkrFileCreation creation)
+{
+    int flags = O_CLOEXEC;
+    const bool read = mode & SKR_FM_READ;
+    const bool write = mode & (SKR_FM_WRITE | SKR_FM_APPEND);
+    flags |= (read && write) ? O_RDWR : (write ? O_WRONLY : O_RDONLY);
+    if (write)
+    {
+        // same semantics as the stdio modes: "w" truncates, "a" appends, "r+" falls back to "w+"
+        flags |= O_CREAT;
+        if (mode & SKR_FM_APPEND)
+            flags |= O_APPEND;
+        else if (!read || creation == SKR_FILE_CREATION_ALWAYS_NEW)
+            flags |= O_TRUNC;
+        if (creation == SKR_FILE_CREATION_NOT_EXIST)
+            flags |= O_EXCL;
+    }
+    return flags;
+}
+
+static bool enable_direct_io(int fd)
+{
+#if defined(O_DIRECT)
+    const int flags = ::fcntl(fd, F_GETFL);
+    return flags != -1 && ::fcntl(fd, F_SETFL, flags | O_DIRECT) == 0;
+#elif defined(F_NOCACHE)
+    return ::fcntl(fd, F_NOCACHE, 1) != -1;
+#else
+    return false;
+#endif
+}
+
+static void disable_direct_io(int fd)
+{
+#if defined(O_DIRECT)
+    const int flags = ::fcntl(fd, F_GETFL);
+    if (flags != -1)
+        ::fcntl(fd, F_SETFL, flags & ~O_DIRECT);
+#elif defined(F_NOCACHE)
+    ::fcntl(fd, F_NOCACHE, 0);
+#endif
+}
+
+static void advise_sequential(int fd)
+{
+#if defined(POSIX_FADV_SEQUENTIAL)
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#elif defined(F_RDAHEAD)
+    ::fcntl(fd, F_RDAHEAD, 1);
+#endif
+}
+} // namespace skr::vfs_posix
+
+struct skr_vfile_posix_t : public skr_vfile_t {
+    int fd;
+    bool direct;
+    // set when the descriptor is shared through the cache
+    skr::vfs_posix::Descriptor* cached;
+    skr::string filePath;
 };
 
-skr_vfile_t* skr_unix_fopen(skr_vfs_t* fs, const char8_t* path,
-ESkrFileMode mode, const char8_t* password, skr_vfile_t* out_file)
+skr_vfile_t* skr_posix_fopen(skr_vfs_t* fs, const char8_t* path, ESkrFileMode mode, ESkrFileCreation creation) SKR_NOEXCEPT
 {
-    skr::filesystem::path filePath(fs->mount_dir ? fs->mount_dir : u8"");
-    auto filePathStr = filePath.string();
-    filePath /= path;
-    const char8_t* modeStr = skr_vfs_filemode_to_string(mode);
-    FILE* cfile = fopen(filePathStr.c_str(), (const char*)modeStr);
-    std::error_code ec = {};
-    SKR_LOG_TRACE(u8"CurrentPath: %s", skr::filesystem::current_path(ec).c_str());
-    // Might fail to open the file for read+write if file doesn't exist
-    if (!cfile)
+    using namespace skr::vfs_posix;
+    skr::string filePath;
     {
-        if ((mode & SKR_FM_READ_WRITE) == SKR_FM_READ_WRITE)
+        ZoneScopedN("CalculatePath");
+        if (path[0] == u8'/' || !fs->mount_dir)
+        {
+            filePath = path;
+        }
+        else
         {
-            modeStr = skr_vfs_overwirte_filemode_to_string(mode);
-            cfile = fopen(filePathStr.c_str(), (const char*)modeStr);
+            filePath = fs->mount_dir;
+            if (!filePath.is_empty() && !filePath.ends_with(u8"/"))
+                filePath.append(u8"/");
+            filePath.append(path);
         }
     }
-    if (!cfile)
+    auto& cache = DescriptorCache::Get();
+    const bool writable = mode & (SKR_FM_WRITE | SKR_FM_APPEND);
+    const bool direct = mode & SKR_FM_DIRECT;
+    // direct handles get their own descriptor, O_DIRECT is a property of the open file description
+    const bool shareable = !writable && !direct;
+    if (writable)
+        cache.invalidate(filePath);
+
+    // a stat is far cheaper than an open, and catches files replaced by a rename or rewritten through another handle
+    struct stat st;
+    const bool stated = shareable && ::stat(filePath.c_str(), &st) == 0;
+    Descriptor* cached = stated ? cache.acquire(filePath, FileIdentity::FromStat(st)) : nullptr;
+    int fd = cached ? cached->fd : -1;
+    if (!cached)
     {
-        SKR_LOG_ERROR(u8"Error opening file: %s -- %s (error: %s)",
-        filePath.c_str(), modeStr, strerror(errno));
-        return nullptr;
+        ZoneScopedN("posix::open");
+        TracyMessage(filePath.c_str(), filePath.raw().size());
+        do
+        {
+            fd = ::open(filePath.c_str(), open_flags(mode, creation), 0644);
+        } while (fd == -1 && errno == EINTR);
+        if (fd == -1)
+        {
+            SKR_LOG_ERROR(u8"Error opening file: %s -- %s (error: %s)", filePath.c_str(), skr_vfs_filemode_to_string(mode), strerror(errno));
+            return nullptr;
+        }
+        if (direct && !enable_direct_io(fd))
+            SKR_LOG_WARN(u8"Direct io is not supported for file: %s", filePath.c_str());
+        if (shareable)
+        {
+            auto desc = SkrNew<Descriptor>();
+            desc->path = filePath;
+            desc->fd = fd;
+            if (::fstat(fd, &st) == 0)
+            {
+                desc->identity = FileIdentity::FromStat(st);
+                cached = cache.insert(desc);
+                fd = cached->fd;
+            }
+            else
+            {
+                SkrDelete(desc);
+            }
+        }
     }
-    skr_vfile_cfile_t* vfile = SkrNew<skr_vfile_cfile_t>();
+    if (mode & SKR_FM_SEQUENTIAL)
+        advise_sequential(fd);
+
+    skr_vfile_posix_t* vfile = SkrNew<skr_vfile_posix_t>();
     vfile->mode = mode;
     vfile->fs = fs;
-    vfile->cfile = cfile;
+    vfile->fd = fd;
+    vfile->direct = direct;
+    vfile->cached = cached;
+    vfile->filePath = std::move(filePath);
     return vfile;
-}
\ No newline at end of file
+}
+
+size_t skr_posix_fread(skr_vfile_t* file, void* out_buffer, size_t offset, size_t byte_count) SKR_NOEXCEPT
+{
+    if (file)
+    {
+        ZoneScopedN("vfs::fread");
+
+        auto vfile = (skr_vfile_posix_t*)file;
+        size_t bytesRead = 0;
+        while (bytesRead < byte_count)
+        {
+            const ssize_t result = ::pread(vfile->fd, (uint8_t*)out_buffer + bytesRead, byte_count - bytesRead, (off_t)(offset + bytesRead));
+            if (result > 0)
+            {
+                bytesRead += (size_t)result;
+                continue;
+            }
+            if (result == 0)
+                break; // eof
+            if (errno == EINTR)
+                continue;
+            if (errno == EINVAL && vfile->direct)
+            {
+                // unaligned buffer or range, this handle keeps going through the page cache
+                disable_direct_io(vfile->fd);
+                vfile->direct = false;
+                continue;
+            }
+            SKR_LOG_WARN(u8"Error reading from file %s: %s", vfile->filePath.c_str(), strerror(errno));
+            break;
+        }
+        return bytesRead;
+    }
+    return -1;
+}
+
+size_t skr_posix_fwrite(skr_vfile_t* file, const void* in_buffer, size_t offset, size_t byte_count) SKR_NOEXCEPT
+{
+    if (file)
+    {
+        auto vfile = (skr_vfile_posix_t*)file;
+        const bool append = vfile->mode & SKR_FM_APPEND;
+        size_t bytesWritten = 0;
+        while (bytesWritten < byte_count)
+        {
+            const auto src = (const uint8_t*)in_buffer + bytesWritten;
+            const ssize_t result = append ? ::write(vfile->fd, src, byte_count - bytesWritten) :
+                                            ::pwrite(vfile->fd, src, byte_count - bytesWritten, (off_t)(offset + bytesWritten));
+            if (result >= 0)
+            {
+                bytesWritten += (size_t)result;
+                continue;
+            }
+            if (errno == EINTR)
+                continue;
+            SKR_LOG_WARN(u8"Error writing to file %s: %s", vfile->filePath.c_str(), strerror(errno));
+            break;
+        }
+        return bytesWritten;
+    }
+    return -1;
+}
+
+ssize_t skr_posix_fsize(const skr_vfile_t* file) SKR_NOEXCEPT
+{
+    if (file)
+    {
+        auto vfile = (const skr_vfile_posix_t*)file;
+        struct stat st;
+        if (::fstat(vfile->fd, &st) == 0)
+            return (ssize_t)st.st_size;
+    }
+    return -1;
+}
+
+bool skr_posix_fclose(skr_vfile_t* file) SKR_NOEXCEPT
+{
+    if (file)
+    {
+        SKR_ASSERT(file->fs->procs.fclose == &skr_posix_fclose);
+        auto vfile = (skr_vfile_posix_t*)file;
+        bool result = true;
+        if (vfile->cached)
+            skr::vfs_posix::DescriptorCache::Get().release(vfile->cached);
+        else
+            result = ::close(vfile->fd) == 0;
+        SkrDelete(vfile);
+        return result;
+    }
+    return false;
+}
+
+void skr_vfs_get_native_procs(struct skr_vfs_proctable_t* procs) SKR_NOEXCEPT
+{
+    procs->fopen = &skr_posix_fopen;
+    procs->fclose = &skr_posix_fclose;
+    procs->fread = &skr_posix_fread;
+    procs->fwrite = &skr_posix_fwrite;
+    procs->fsize = &skr_posix_fsize;
+}
+
+#if !defined(__APPLE__)
+inline static char8_t* duplicate_string(const char8_t* src_string) SKR_NOEXCEPT
+{
+    if (src_string != nullptr)
+    {
+        const size_t source_len = strlen((const char*)src_string);
+        char8_t* result = (char8_t*)sakura_malloc(sizeof(char8_t) * (1 + source_len));
+        strcpy((char*)result, (const char*)src_string);
+        return result;
+    }
+    return nullptr;
+}
+
+skr_vfs_t* skr_create_vfs(const skr_vfs_desc_t* desc) SKR_NOEXCEPT
+{
+    SKR_ASSERT(desc);
+    auto fs = (skr_vfs_t*)sakura_calloc(1, sizeof(skr_vfs_t));
+    fs->mount_type = desc->mount_type;
+    skr_vfs_get_native_procs(&fs->procs);
+    fs->mount_dir = nullptr;
+
+    // Override Resource mounts
+    if (desc->override_mount_dir)
+    {
+        fs->mount_dir = duplicate_string(desc->override_mount_dir);
+    }
+    else if (desc->mount_type == SKR_MOUNT_TYPE_DOCUMENTS && getenv("HOME"))
+    {
+        fs->mount_dir = duplicate_string((const char8_t*)getenv("HOME"));
+    }
+    else
+    {
+        // Get application directory
+        std::error_code ec = {};
+        auto exePath = skr::filesystem::read_symlink("/proc/self/exe", ec);
+        const auto parentPath = ec ? skr::filesystem::current_path(ec).u8string() : exePath.parent_path().u8string();
+        fs->mount_dir = duplicate_string(parentPath.c_str());
+    }
+    return fs;
+}
+
+void skr_free_vfs(skr_vfs_t* fs) SKR_NOEXCEPT
+{
+    if (fs)
+    {
+        if (fs->mount_dir) sakura_free(fs->mount_dir);
+        sakura_free(fs);
+    }
+}
+#endif
@@ -4,4 +4,5 @@
 #include "config_resource.cpp"
 #include "local_resource_registry.cpp"
 #include "resource_handle.cpp"
-#include "resource_header.cpp"
\ No newline at end of file
+#include "resource_header.cpp"
+#include "resource_bundle.cpp"
\ No newline at end of file
@@ -3,69 +3,304 @@
 #include "SkrRT/platform/vfs.h"
 #include "SkrRT/resource/local_resource_registry.hpp"
 #include "SkrRT/resource/resource_header.hpp"
+#include "SkrRT/resource/resource_bundle.hpp"
 #include "SkrRT/misc/log.hpp"
 #include "SkrRT/serde/binary/reader.h"
+#include "SkrRT/serde/binary/writer.h"
 #include "SkrRT/platform/guid.hpp"
+#include <EASTL/algorithm.h>
 
 namespace skr::resource
 {
-SLocalResourceRegistry::SLocalResourceRegistry(skr_vfs_t* vfs)
+static constexpr uint32_t kHeaderIndexMagic = 0x58444952; // "RIDX"
+
+static bool DeserializeHeader(skr::span<const uint8_t> data, skr_resource_header_t& header)
+{
+    skr::binary::SpanReader reader = { data, 0 };
+    skr_binary_reader_t archive{reader};
+    return skr::binary::Read(&archive, header) == 0;
+}
+
+static skr::string HeaderUri(const skr_guid_t& guid)
+{
+    return skr::format(u8"{}.rh", guid);
+}
+
+SLocalResourceRegistry::SLocalResourceRegistry(skr_vfs_t* vfs, skr_io_ram_service_t* ram_service)
     : vfs(vfs)
+    , ram_service(ram_service)
 {
 
 }
 
+SLocalResourceRegistry::~SLocalResourceRegistry()
+{
+    // the service still writes into the futures, let it finish every batch before freeing them
+    if (!inflightReads.empty())
+        ram_service->drain();
+    for (auto read : inflightReads)
+    {
+        SKR_ASSERT(read->future.is_ready() || read->future.is_cancelled());
+        SkrDelete(read);
+    }
+    for (auto read : queuedReads)
+        SkrDelete(read);
+}
+
 bool SLocalResourceRegistry::RequestResourceFile(SResourceRequest* request)
 {
     //简单实现，直接在 resource 路径下按 guid 找到文件读信息，没有单独的数据库
-    auto guid = request->GetGuid();
-    skr::filesystem::path headerPath = skr::format(u8"{}.rh", guid).c_str();
-    auto headerUri = headerPath.u8string();
-    // TODO: 检查文件存在？
-    SKR_LOG_BACKTRACE(u8"Failed to find resource file: %s!", headerUri.c_str());
-    auto file = skr_vfs_fopen(vfs, headerUri.c_str(), SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
-    if (!file) return false;
-    SKR_DEFER({ skr_vfs_fclose(file); });
-    uint32_t _fs_length = (uint32_t)skr_vfs_fsize(file);
+    const auto guid = request->GetGuid();
     skr_resource_header_t header;
-    if (_fs_length <= sizeof(skr_resource_header_t))
+    bool cached = false;
     {
-        uint8_t buffer[sizeof(skr_resource_header_t)];
-        if(skr_vfs_fread(file, buffer, 0, _fs_length) != _fs_length)
+        SMutexLock lock(headerMutex.mMutex);
+        auto iter = headerCache.find(guid);
+        if (iter != headerCache.end())
         {
-            SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::RequestResourceFile] failed to read resource header! guid: {}", guid);
-            return false;
+            header = iter->second;
+            cached = true;
         }
-        skr::binary::SpanReader reader = { buffer, 0 };
-        skr_binary_reader_t archive{reader};
-        if(skr::binary::Read(&archive, header) != 0)
-            return false;
     }
-    else
+    if (cached)
+    {
+        FinishRequest(request, header);
+        return true;
+    }
+    if (!ram_service && GetResourceSystem()->IsInitialized())
+        ram_service = GetResourceSystem()->GetRAMService();
+    if (ram_service)
+    {
+        // resolved from Update(), every header requested this frame shares one io batch
+        auto read = SkrNew<HeaderRead>();
+        read->request = request;
+        read->guid = guid;
+        queuedReads.emplace_back(read);
+        return true;
+    }
+    if (!ReadHeaderFile(guid, header))
+        return false;
+    FinishRequest(request, header);
+    return true;
+}
+
+void SLocalResourceRegistry::Update()
+{
+    // deliver finished reads first so their requests advance in the same update
+    for (auto& read : inflightReads)
+    {
+        if (!read->future.is_ready() && !read->future.is_cancelled())
+            continue;
+        if (read->request)
+        {
+            skr_resource_header_t header;
+            const bool valid = read->future.is_ready() && !read->future.is_failed() && read->buffer && read->buffer->get_size() &&
+                               DeserializeHeader({ read->buffer->get_data(), read->buffer->get_size() }, header);
+            if (valid)
+            {
+                SKR_ASSERT(header.guid == read->guid);
+                {
+                    SMutexLock lock(headerMutex.mMutex);
+                    headerCache.insert_or_assign(read->guid, header);
+                }
+                FinishRequest(read->request, header);
+            }
+            else
+            {
+                SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::Update] failed to read resource header! guid: {}", read->guid);
+                // no resource url was filled, the request moves to the error state
+                read->request->OnRequestFileFinished();
+            }
+        }
+        SkrDelete(read);
+        read = nullptr;
+    }
+    inflightReads.erase(eastl::remove(inflightReads.begin(), inflightReads.end(), nullptr), inflightReads.end());
+
+    if (queuedReads.empty())
+        return;
+    auto batch = ram_service->open_batch(queuedReads.size());
+    for (auto read : queuedReads)
+    {
+        const auto uri = HeaderUri(read->guid);
+        auto rq = ram_service->open_request();
+        rq->set_vfs(vfs);
+        rq->set_path(uri.u8_str());
+        rq->add_block({}); // read all
+        auto result = batch->add_request(rq, &read->future);
+        read->buffer = skr::static_pointer_cast<skr::io::IRAMIOBuffer>(result);
+        inflightReads.emplace_back(read);
+    }
+    ram_service->request(batch);
+    queuedReads.clear();
+}
+
+void SLocalResourceRegistry::CancelRequestFile(SResourceRequest* requst)
+{
+    for (auto iter = queuedReads.begin(); iter != queuedReads.end(); ++iter)
     {
-        uint8_t* buffer = (uint8_t*)sakura_malloc(_fs_length);
-        SKR_DEFER({ sakura_free(buffer); });
-        if(skr_vfs_fread(file, buffer, 0, _fs_length) != _fs_length)
+        if ((*iter)->request == requst)
         {
-            SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::RequestResourceFile] failed to read resource header! guid: {}", guid);
-            return false;
+            SkrDelete(*iter);
+            queuedReads.erase(iter);
+            return;
         }
-        skr::binary::SpanReader reader = { {buffer, _fs_length}, 0 };
-        skr_binary_reader_t archive{reader};
-        if(skr::binary::Read(&archive, header) != 0)
-            return false; 
     }
-    SKR_ASSERT(header.guid == guid);
-    auto resourcePath = headerPath;
+    // the io batch is already out, let it land and drop the result
+    for (auto read : inflightReads)
+    {
+        if (read->request == requst)
+            read->request = nullptr;
+    }
+}
+
+SLocalResourceRegistry::ResourceLocation SLocalResourceRegistry::ResolveLocation(const skr_guid_t& guid)
+{
+    ResourceLocation location;
+    {
+        SMutexLock lock(headerMutex.mMutex);
+        auto iter = bundleLocations.find(guid);
+        if (iter != bundleLocations.end())
+        {
+            location.uri = bundleUris[iter->second.bundle];
+            location.offset = iter->second.offset;
+            location.size = iter->second.size;
+            return location;
+        }
+    }
+    skr::filesystem::path resourcePath = HeaderUri(guid).c_str();
     resourcePath.replace_extension(".bin");
-    auto resourceUri = resourcePath.u8string();
-    FillRequest(request, header, vfs, resourceUri.c_str());
+    location.uri = resourcePath.u8string().c_str();
+    return location;
+}
+
+void SLocalResourceRegistry::FinishRequest(SResourceRequest* request, const skr_resource_header_t& header)
+{
+    const auto location = ResolveLocation(header.guid);
+    FillRequest(request, header, vfs, location.uri.u8_str(), location.offset, location.size);
     request->OnRequestFileFinished();
+}
+
+bool SLocalResourceRegistry::ReadHeaderFile(const skr_guid_t& guid, skr_resource_header_t& header)
+{
+    const auto headerUri = HeaderUri(guid);
+    auto file = skr_vfs_fopen(vfs, headerUri.u8_str(), SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+    if (!file)
+    {
+        SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::RequestResourceFile] failed to find resource header: {}!", headerUri);
+        return false;
+    }
+    SKR_DEFER({ skr_vfs_fclose(file); });
+    uint32_t _fs_length = (uint32_t)skr_vfs_fsize(file);
+    uint8_t stackBuffer[sizeof(skr_resource_header_t)];
+    uint8_t* buffer = _fs_length <= sizeof(skr_resource_header_t) ? stackBuffer : (uint8_t*)sakura_malloc(_fs_length);
+    SKR_DEFER({ if (buffer != stackBuffer) sakura_free(buffer); });
+    if (skr_vfs_fread(file, buffer, 0, _fs_length) != _fs_length)
+    {
+        SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::RequestResourceFile] failed to read resource header! guid: {}", guid);
+        return false;
+    }
+    if (!DeserializeHeader({ buffer, _fs_length }, header))
+        return false;
+    SKR_ASSERT(header.guid == guid);
+    SMutexLock lock(headerMutex.mMutex);
+    headerCache.insert_or_assign(guid, header);
     return true;
 }
 
-void SLocalResourceRegistry::CancelRequestFile(SResourceRequest* requst)
+bool SLocalResourceRegistry::LoadHeaderIndex(const char8_t* path)
+{
+    auto file = skr_vfs_fopen(vfs, path, SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+    if (!file)
+        return false;
+    SKR_DEFER({ skr_vfs_fclose(file); });
+    const size_t size = skr_vfs_fsize(file);
+    skr::vector<uint8_t> buffer(size);
+    if (skr_vfs_fread(file, buffer.data(), 0, size) != size)
+    {
+        SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::LoadHeaderIndex] failed to read header index {}!", path);
+        return false;
+    }
+    skr::binary::SpanReader reader = { { buffer.data(), buffer.size() }, 0 };
+    skr_binary_reader_t archive{reader};
+    uint32_t magic = 0, count = 0;
+    if (skr::binary::Read(&archive, magic) != 0 || magic != kHeaderIndexMagic || skr::binary::Read(&archive, count) != 0)
+    {
+        SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::LoadHeaderIndex] invalid header index {}!", path);
+        return false;
+    }
+    SMutexLock lock(headerMutex.mMutex);
+    headerCache.reserve(headerCache.size() + count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        skr_resource_header_t header;
+        if (skr::binary::Read(&archive, header) != 0)
+        {
+            SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::LoadHeaderIndex] header index {} is truncated at entry {}!", path, i);
+            return false;
+        }
+        headerCache.insert_or_assign(header.guid, header);
+    }
+    return true;
+}
+
+bool SLocalResourceRegistry::SaveHeaderIndex(const char8_t* path)
 {
+    eastl::vector<uint8_t> buffer;
+    {
+        skr::binary::VectorWriter writer{&buffer};
+        skr_binary_writer_t archive(writer);
+        SMutexLock lock(headerMutex.mMutex);
+        skr::binary::Write(&archive, kHeaderIndexMagic);
+        skr::binary::Write(&archive, (uint32_t)headerCache.size());
+        for (auto& pair : headerCache)
+            skr::binary::Write(&archive, pair.second);
+    }
+    auto file = skr_vfs_fopen(vfs, path, SKR_FM_WRITE_BINARY, SKR_FILE_CREATION_ALWAYS_NEW);
+    if (!file)
+    {
+        SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::SaveHeaderIndex] failed to open header index {}!", path);
+        return false;
+    }
+    SKR_DEFER({ skr_vfs_fclose(file); });
+    return skr_vfs_fwrite(file, buffer.data(), 0, buffer.size()) == buffer.size();
+}
 
+void SLocalResourceRegistry::ClearHeaderCache()
+{
+    SMutexLock lock(headerMutex.mMutex);
+    headerCache.clear();
+}
+
+bool SLocalResourceRegistry::LoadBundleIndex(const char8_t* path)
+{
+    auto file = skr_vfs_fopen(vfs, path, SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+    if (!file)
+        return false;
+    SKR_DEFER({ skr_vfs_fclose(file); });
+    const size_t size = skr_vfs_fsize(file);
+    skr::vector<uint8_t> buffer(size);
+    if (skr_vfs_fread(file, buffer.data(), 0, size) != size)
+    {
+        SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::LoadBundleIndex] failed to read bundle index {}!", path);
+        return false;
+    }
+    SResourceBundleIndex index;
+    if (!index.Read({ buffer.data(), buffer.size() }))
+    {
+        SKR_LOG_FMT_ERROR(u8"[SLocalResourceRegistry::LoadBundleIndex] invalid bundle index {}!", path);
+        return false;
+    }
+    SMutexLock lock(headerMutex.mMutex);
+    const auto bundle = (uint32_t)bundleUris.size();
+    bundleUris.emplace_back(index.bundle_uri);
+    headerCache.reserve(headerCache.size() + index.entries.size());
+    bundleLocations.reserve(bundleLocations.size() + index.entries.size());
+    for (auto& entry : index.entries)
+    {
+        headerCache.insert_or_assign(entry.header.guid, entry.header);
+        bundleLocations.insert_or_assign(entry.header.guid, BundleLocation{ bundle, entry.offset, entry.size });
+    }
+    return true;
 }
 } // namespace skr::resource
\ No newline at end of file
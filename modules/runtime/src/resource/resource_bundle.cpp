@@ -0,0 +1,54 @@
+#include "SkrRT/resource/resource_bundle.hpp"
+#include "SkrRT/serde/binary/reader.h"
+#include "SkrRT/serde/binary/writer.h"
+
+namespace skr::resource
+{
+bool SResourceBundleIndex::Read(skr::span<const uint8_t> data)
+{
+    namespace bin = skr::binary;
+    bin::SpanReader reader = { data, 0 };
+    skr_binary_reader_t archive{reader};
+    uint32_t magic = 0, version = 0, count = 0;
+    if (bin::Read(&archive, magic) != 0 || magic != kMagic)
+        return false;
+    if (bin::Read(&archive, version) != 0 || version != kVersion)
+        return false;
+    if (bin::Read(&archive, bundle_uri) != 0 || bin::Read(&archive, alignment) != 0 || bin::Read(&archive, count) != 0)
+        return false;
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+        return false;
+    // the count comes from disk, bound it by what the remaining bytes can hold before reserving
+    constexpr size_t kMinEntryBytes = sizeof(uint32_t) + 2 * sizeof(skr_guid_t) + 2 * sizeof(uint64_t);
+    if (count > (data.size() - reader.offset) / kMinEntryBytes)
+        return false;
+    entries.clear();
+    entries.resize(count);
+    for (auto& entry : entries)
+    {
+        if (bin::Read(&archive, entry.header) != 0 || bin::Read(&archive, entry.offset) != 0 || bin::Read(&archive, entry.size) != 0)
+            return false;
+        if (entry.offset % alignment != 0 || entry.offset + entry.size < entry.offset)
+            return false;
+    }
+    return true;
+}
+
+void SResourceBundleIndex::Write(eastl::vector<uint8_t>& buffer) const
+{
+    namespace bin = skr::binary;
+    bin::VectorWriter writer{&buffer};
+    skr_binary_writer_t archive(writer);
+    bin::Write(&archive, kMagic);
+    bin::Write(&archive, kVersion);
+    bin::Write(&archive, bundle_uri);
+    bin::Write(&archive, alignment);
+    bin::Write(&archive, (uint32_t)entries.size());
+    for (auto& entry : entries)
+    {
+        bin::Write(&archive, entry.header);
+        bin::Write(&archive, entry.offset);
+        bin::Write(&archive, entry.size);
+    }
+}
+} // namespace skr::resource
@@ -54,7 +54,10 @@ void SResourceRequestImpl::UpdateLoad(bool requestInstall)
             currentPhase = SKR_LOADING_PHASE_REQUEST_RESOURCE;
             break;
         case SKR_LOADING_PHASE_CANCEL_RESOURCE_REQUEST:
-            currentPhase = SKR_LOADING_PHASE_WAITFOR_RESOURCE_REQUEST;
+            // the pending lookup may already have landed and been dropped, drop it for sure and ask again,
+            // the header is usually cached by now
+            system->GetRegistry()->CancelRequestFile(this);
+            currentPhase = SKR_LOADING_PHASE_REQUEST_RESOURCE;
             break;
         case SKR_LOADING_PHASE_UNINSTALL_RESOURCE: {
             currentPhase = SKR_LOADING_PHASE_FINISHED;
@@ -109,7 +112,7 @@ void SResourceRequestImpl::UpdateUnload()
     switch (currentPhase)
     {
         case SKR_LOADING_PHASE_WAITFOR_RESOURCE_REQUEST: {
-            currentPhase = SKR_LOADING_PHASE_CANCEL_WAITFOR_LOAD_DEPENDENCIES;
+            currentPhase = SKR_LOADING_PHASE_CANCEL_RESOURCE_REQUEST;
         }
         break;
         case SKR_LOADING_PHASE_IO:
@@ -160,6 +163,9 @@ void SResourceRequestImpl::UpdateUnload()
 
 void SResourceRequestImpl::OnRequestFileFinished()
 {
+    // unloaded while the registry was still resolving, the cancel phase cleans up and a reload requests again
+    if (currentPhase == SKR_LOADING_PHASE_CANCEL_RESOURCE_REQUEST)
+        return;
     if (resourceUrl.is_empty() || vfs == nullptr)
     {
         SKR_LOG_FMT_ERROR(u8"Resource {} failed to load, file not found.", resourceRecord->header.guid);
@@ -260,10 +266,10 @@ void SResourceRequestImpl::Update()
     switch (currentPhase)
     {
         case SKR_LOADING_PHASE_REQUEST_RESOURCE: {
+            // OnRequestFileFinished moves us on, either inside this call or from a later registry update
+            currentPhase = SKR_LOADING_PHASE_WAITFOR_RESOURCE_REQUEST;
             auto fopened = resourceRegistry->RequestResourceFile(this);
-            if (fopened)
-                currentPhase = SKR_LOADING_PHASE_IO;
-            else
+            if (!fopened)
             {
                 currentPhase = SKR_LOADING_PHASE_FINISHED;
                 // TODO: Do something with this rude code
@@ -275,15 +281,32 @@ void SResourceRequestImpl::Update()
             break;
         case SKR_LOADING_PHASE_IO:
             resourceRecord->SetStatus(SKR_LOADING_STATUS_LOADING);
-            if (factory->AsyncIO())
+            if (resourceSize == 0)
+            {
+                // empty bundled payload, the factory deserializes from an empty span
+                dataBlob.reset();
+                currentPhase = SKR_LOADING_PHASE_DESER_RESOURCE;
+            }
+            else if (factory->AsyncIO())
             {
                 {
+                    const bool readToEnd = (resourceSize == SResourceRegistry::kReadToEnd);
                     auto rq = ioService->open_request();
                     rq->set_vfs(vfs);
                     rq->set_path(resourceUrl.u8_str());
-                    rq->add_block({}); // read all
                     SKR_ASSERT(dataFuture.status == 0);
-                    dataBlob = ioService->request(rq, &dataFuture);
+                    if (readToEnd)
+                    {
+                        rq->add_block({ resourceOffset, 0 }); // block size 0 reads all
+                        dataBlob = ioService->request(rq, &dataFuture);
+                    }
+                    else
+                    {
+                        // the size is known up front, read straight into the blob the factory deserializes from
+                        dataBlob = skr::IBlob::Create(nullptr, resourceSize, false);
+                        rq->add_block({ resourceOffset, resourceSize }, dataBlob->get_data());
+                        ioService->request(rq, &dataFuture);
+                    }
                 }
 #ifdef SKR_RESOURCE_DEV_MODE
                 if (!artifactsUrl.is_empty())
@@ -303,9 +326,9 @@ void SResourceRequestImpl::Update()
                 {
                     auto file = skr_vfs_fopen(vfs, (const char8_t*)resourceUrl.c_str(), SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
                     SKR_DEFER({ skr_vfs_fclose(file); });
-                    auto fsize = skr_vfs_fsize(file);
+                    auto fsize = (resourceSize == SResourceRegistry::kReadToEnd) ? skr_vfs_fsize(file) - resourceOffset : resourceSize;
                     dataBlob = skr::IBlob::Create(nullptr, fsize, false);
-                    skr_vfs_fread(file, dataBlob->get_data(), 0, fsize);
+                    skr_vfs_fread(file, dataBlob->get_data(), resourceOffset, fsize);
                 }
 #ifdef SKR_RESOURCE_DEV_MODE
                 if (!artifactsUrl.is_empty())
@@ -332,7 +355,16 @@ void SResourceRequestImpl::Update()
                 if (dataReady)
 #endif
                 {
-                    currentPhase = SKR_LOADING_PHASE_DESER_RESOURCE;
+                    if (dataFuture.is_failed())
+                    {
+                        SKR_LOG_FMT_ERROR(u8"Resource {} failed to load, io failed to read {}.",
+                        resourceRecord->header.guid, resourceUrl);
+                        dataBlob.reset();
+                        currentPhase = SKR_LOADING_PHASE_FINISHED;
+                        resourceRecord->SetStatus(SKR_LOADING_STATUS_ERROR);
+                    }
+                    else
+                        currentPhase = SKR_LOADING_PHASE_DESER_RESOURCE;
                 }
             }
             else
@@ -552,7 +584,7 @@ bool SResourceRequestImpl::Yielded()
     }
 }
 
-void SResourceRegistry::FillRequest(SResourceRequest* r, skr_resource_header_t header, skr_vfs_t* vfs, const char8_t* uri)
+void SResourceRegistry::FillRequest(SResourceRequest* r, skr_resource_header_t header, skr_vfs_t* vfs, const char8_t* uri, uint64_t offset, uint64_t size)
 {
     auto request = static_cast<SResourceRequestImpl*>(r);
     if (request)
@@ -562,6 +594,8 @@ void SResourceRegistry::FillRequest(SResourceRequest* r, skr_resource_header_t h
         request->resourceRecord->header.dependencies = header.dependencies;
         request->vfs = vfs;
         request->resourceUrl = uri;
+        request->resourceOffset = offset;
+        request->resourceSize = size;
     }
 }
 
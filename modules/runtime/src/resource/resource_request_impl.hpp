@@ -55,6 +55,9 @@ protected:
     skr_io_future_t dataFuture;
     skr::BlobId dataBlob;
     skr::string resourceUrl;
+    // range inside resourceUrl, bundled resources share one file
+    uint64_t resourceOffset = 0;
+    uint64_t resourceSize = SResourceRegistry::kReadToEnd;
 #ifdef SKR_RESOURCE_DEV_MODE
     skr_io_future_t artifactsFuture;
     skr::BlobId artifactsBlob;
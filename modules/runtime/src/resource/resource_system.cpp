@@ -351,6 +351,8 @@ void SResourceSystemImpl::Update()
         }
         _ClearFinishedRequests();
     }
+    // headers resolved since the last update let their requests move on right away
+    resourceRegistry->Update();
     // TODO: time limit
     {
         for (auto req : toUpdateRequests)
@@ -369,6 +371,8 @@ void SResourceSystemImpl::Update()
             };
         }
     }
+    // submit the lookups queued by this round of requests in one go
+    resourceRegistry->Update();
     _UpdateAsyncSerde();
 }
 
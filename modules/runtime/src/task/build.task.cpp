@@ -1,2 +1,3 @@
 #include "task.cpp"
-#include "task2.cpp"
\ No newline at end of file
+#include "task2.cpp"
+#include "worker_pool.cpp"
\ No newline at end of file
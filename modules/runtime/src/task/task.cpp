@@ -1,5 +1,6 @@
 #include "SkrRT/async/fib_task.hpp"
 #include "SkrRT/platform/debug.h"
+#include "SkrRT/async/worker_pool.hpp"
 
 namespace skr::task
 {
@@ -88,7 +89,7 @@ void scheduler_t::initialize(const scheudler_config_t& config)
 }
 scheudler_config_t::scheudler_config_t()
 {
-    numThreads = marl::Thread::numLogicalCPUs();
+    numThreads = skr::WorkerPool::Get()->get_worker_count();
 }
 scheduler_t::~scheduler_t()
 {
@@ -1,6 +1,7 @@
 #if __cpp_impl_coroutine
 
 #include "SkrRT/async/co_task.hpp"
+#include "SkrRT/async/worker_pool.hpp"
 #include "EASTL/deque.h"
 #include "SkrRT/misc/log.h"
 #include "SkrRT/misc/make_zeroed.hpp"
@@ -49,7 +50,7 @@ namespace task2
 
     scheudler_config_t::scheudler_config_t()
     {
-        numThreads = skr_cpu_cores_count();
+        numThreads = WorkerPool::Get()->get_worker_count();
     }
 
     skr_task_t skr_task_t::promise_type::get_return_object()
@@ -149,7 +150,7 @@ namespace task2
 #endif
     };
 
-    void enqueue(Task&& task, int workerIdx);
+    void enqueue(Task&& task, int workerIdx, scheduler_t* scheduler = nullptr);
     thread_local struct Worker* currentWorker = nullptr;
     struct Worker
     {
@@ -218,6 +219,8 @@ namespace task2
                 auto& worker = *(Worker*)scheduler->workers[rand];
                 if(worker.steal(stolen))
                 {
+                    // called while spinning, without a slot of our own
+                    WorkerPoolSlot slot(kWorkerSlotShared);
                     stolen();
                     return rand;
                 }
@@ -271,9 +274,20 @@ namespace task2
                 //report to scheduler that we are spinning
                 scheduler->spinningWorkers[scheduler->nextSpinningWorkerIdx++ % scheduler->spinningWorkers.size()] = id;
                 skr_mutex_release(&work.mutex);
+                // spinning is not engine work, give the slot back and only take one for stolen tasks
+                WorkerPool::Get()->release(kWorkerSlotShared);
                 spinForWork();
                 skr_mutex_acquire(&work.mutex);
+                work.wait([this]() {
+                    return work.num > 0 || shutdown;
+                });
+                skr_mutex_release(&work.mutex);
+                WorkerPool::Get()->acquire(kWorkerSlotShared);
+                skr_mutex_acquire(&work.mutex);
+                return;
             }
+            if(work.num > 0 || shutdown)
+                return;
             work.wait([this]() {
                 return work.num > 0 || shutdown;
             });
@@ -309,12 +323,17 @@ namespace task2
                 work.wait([this]() {
                     return work.num > 0 || shutdown;
                 });
+                skr_mutex_release(&work.mutex);
+                WorkerPool::Get()->acquire(kWorkerSlotShared);
+                skr_mutex_acquire(&work.mutex);
             }
             while(!shutdown || work.num > 0)
             {
                 waitForWork();
                 runUntilIdle();
             }
+            if (!isMainThread)
+                WorkerPool::Get()->release(kWorkerSlotShared);
         }
 
         void enqueue(Task&& task, bool pinned)
@@ -409,10 +428,11 @@ namespace task2
     };
     
 
-    void enqueue(Task&& task, int workerIdx)
+    void enqueue(Task&& task, int workerIdx, scheduler_t* scheduler)
     {
         //ZoneScopedN("EnqueueTask");
-        scheduler_t* scheduler = scheduler_t::instance();
+        if(scheduler == nullptr)
+            scheduler = scheduler_t::instance();
         SKR_ASSERT(scheduler != nullptr);
         size_t workerCount = scheduler->config.numThreads;
         while(true)
@@ -456,6 +476,46 @@ namespace task2
         enqueue(Task(std::move(coroutine)), -1);
     }
 
+    // a non-worker thread parked on a waiter list, only constructed on the blocking slow path
+    struct ThreadWaiter : waiter_t
+    {
+        SMutex mutex;
+        SConditionVariable cv;
+        bool woken = false;
+        ThreadWaiter()
+        {
+            skr_init_mutex(&mutex);
+            skr_init_condition_var(&cv);
+        }
+        ~ThreadWaiter()
+        {
+            skr_destroy_mutex(&mutex);
+            skr_destroy_condition_var(&cv);
+        }
+        void wait()
+        {
+            SMutexLock guard(mutex);
+            while(!woken)
+                skr_wait_condition_vars(&cv, &mutex, TIMEOUT_INFINITE);
+        }
+        void wake()
+        {
+            SMutexLock guard(mutex);
+            woken = true;
+            skr_wake_condition_var(&cv);
+        }
+    };
+
+    // push the waiter then re-check the state: the signaller publishes its state before draining the list
+    // (both seq_cst), so either it sees our node or we see its state and drain the list ourselves.
+    template<class State, class F>
+    void park(State& state, waiter_t* waiter, F&& done)
+    {
+        state.waiters.push(waiter);
+        if(done())
+            state.waiters.notify();
+    }
+
     scheduler_t::EventAwaitable::EventAwaitable(scheduler_t& scheduler, event_t event, int workerIdx)
         : scheduler(scheduler), event(std::move(event)), workerIdx(workerIdx)
     {
@@ -468,14 +528,18 @@ namespace task2
 
     bool scheduler_t::EventAwaitable::await_suspend(std::coroutine_handle<skr_task_t::promise_type> handle)
     {   
-        SMutexLock guard(event.state->mutex);
-        if(event.state->signalled)
+        if(event.done())
             return false;
 #ifdef TRACY_ENABLE
         if(handle.promise().name != nullptr)
             TracyFiberLeave;
 #endif
-        event.state->cv.add_waiter(handle, workerIdx);
+        // the coroutine (and this awaitable) may be resumed and destroyed as soon as the waiter is pushed
+        auto state = event.state;
+        waiter.handle = handle;
+        waiter.scheduler = &scheduler;
+        waiter.workerIdx = workerIdx;
+        park(*state, &waiter, [&]{ return state->signalled.load(); });
         return true;
     }
 
@@ -492,10 +556,12 @@ namespace task2
     {
         auto scheduler = scheduler_t::instance();
         SKR_ASSERT(scheduler == nullptr); //must use outside of scheduler
-        while(!event.done())
-        {
-            event.state->cv.wait(event.state->mutex);
-        }
+        if(event.done())
+            return;
+        auto state = event.state.get();
+        ThreadWaiter waiter;
+        park(*state, &waiter, [&]{ return state->signalled.load(); });
+        waiter.wait();
     }
 
     scheduler_t::CounterAwaitable::CounterAwaitable(scheduler_t& scheduler, counter_t counter, int workerIdx)
@@ -510,14 +576,18 @@ namespace task2
 
     bool scheduler_t::CounterAwaitable::await_suspend(std::coroutine_handle<skr_task_t::promise_type> handle)
     {   
-        SMutexLock guard(counter.state->mutex);
-        if(counter.state->count == 0)
+        if(counter.done())
             return false;
 #ifdef TRACY_ENABLE
         if(handle.promise().name != nullptr)
             TracyFiberLeave;
 #endif
-        counter.state->cv.add_waiter(handle, workerIdx);
+        // the coroutine (and this awaitable) may be resumed and destroyed as soon as the waiter is pushed
+        auto state = counter.state;
+        waiter.handle = handle;
+        waiter.scheduler = &scheduler;
+        waiter.workerIdx = workerIdx;
+        park(*state, &waiter, [&]{ return (state->count.load() == 0) == !state->inverse; });
         return true;
     }
 
@@ -534,10 +604,12 @@ namespace task2
     {
         auto scheduler = scheduler_t::instance();
         SKR_ASSERT(scheduler == nullptr); //must use outside of scheduler
-        while(!counter.done())
-        {
-            counter.state->cv.wait(counter.state->mutex);
-        }
+        if(counter.done())
+            return;
+        auto state = counter.state.get();
+        ThreadWaiter waiter;
+        park(*state, &waiter, [&]{ return (state->count.load() == 0) == !state->inverse; });
+        waiter.wait();
     }
 
     void scheduler_t::sync(event_t event)
@@ -574,59 +646,62 @@ namespace task2
         }
     }
 
-    void condvar_t::add_waiter(std::coroutine_handle<skr_task_t::promise_type> handle, int workerIdx)
-    {
-        ++numWaiting;
-        waiters.push_back(handle);
-        workerIndices.push_back(workerIdx);
-    }
-
-    void condvar_t::wait(SMutex& mutex)
+    void waiter_list_t::push(waiter_t* waiter)
     {
-        ++numWaitingOnCondition;
-        skr_wait_condition_vars(&cv, &mutex, TIMEOUT_INFINITE);
-        --numWaitingOnCondition;
+        auto first = head.load(std::memory_order_relaxed);
+        do
+        {
+            waiter->next = first;
+        } while(!head.compare_exchange_weak(first, waiter, std::memory_order_seq_cst, std::memory_order_relaxed));
     }
 
-    void condvar_t::notify()
+    void waiter_list_t::notify()
     {
-        skr_wake_all_condition_vars(&cv);
-        for(uint32_t i=0; i<waiters.size(); ++i)
+        if(head.load() == nullptr)
+            return;
+        auto waiter = head.exchange(nullptr);
+        while(waiter)
         {
-            enqueue(Task{std::move(waiters[i])}, workerIndices[i]);
+            // the node is owned by the waiter and may die as soon as it is woken
+            auto next = waiter->next;
+            if(waiter->handle)
+            {
+                auto handle = waiter->handle;
+                auto scheduler = waiter->scheduler;
+                auto workerIdx = waiter->workerIdx;
+                enqueue(Task{std::move(handle)}, workerIdx, scheduler);
+            }
+            else
+            {
+                static_cast<ThreadWaiter*>(waiter)->wake();
+            }
+            waiter = next;
         }
-        waiters.clear();
-        workerIndices.clear();
-        numWaiting = 0;
     }
 
     void event_t::notify()
     {
         if(!state)
             return;
-        SMutexLock guard(state->mutex);
-        state->signalled = true;
-        state->cv.notify();
+        state->signalled.store(true);
+        state->waiters.notify();
     }
 
     void event_t::reset()
     {
         if(!state)
             return;
-        SMutexLock guard(state->mutex);
-        state->signalled = false;
+        state->signalled.store(false);
     }
 
     void counter_t::add(uint32_t count)
     {
         if(!state)
             return;
-        state->count += count;
-        if(state->inverse)
-        {
-            SMutexLock guard(state->mutex);
-            state->cv.notify();
-        }
+        auto prev = state->count.fetch_add(count);
+        // an inverse counter becomes done when it leaves zero
+        if(state->inverse && prev == 0 && count != 0)
+            state->waiters.notify();
     }
 
     bool counter_t::decrease()
@@ -637,8 +712,7 @@ namespace task2
             return false;
         if(count == 0)
         {
-            SMutexLock guard(state->mutex);
-            state->cv.notify();
+            state->waiters.notify();
             return true;
         }
         return false;
@@ -0,0 +1,107 @@
+#include "SkrRT/async/worker_pool.hpp"
+#include "SkrRT/platform/debug.h"
+#include <EASTL/algorithm.h>
+
+namespace skr
+{
+WorkerPool* WorkerPool::Get()
+{
+    static WorkerPool pool;
+    return &pool;
+}
+
+WorkerPool::WorkerPool() SKR_NOEXCEPT
+{
+    skr_init_mutex(&mutex);
+    skr_init_condition_var(&cv);
+    configure({});
+}
+
+WorkerPool::~WorkerPool() SKR_NOEXCEPT
+{
+    skr_destroy_mutex(&mutex);
+    skr_destroy_condition_var(&cv);
+}
+
+void WorkerPool::configure(const WorkerPoolDesc& _desc) SKR_NOEXCEPT
+{
+    SKR_ASSERT(shared_active == 0 && reserved_active == 0 && "configure the worker pool before starting workers");
+    desc = _desc;
+    concurrency = desc.concurrency ? desc.concurrency : skr_cpu_cores_count();
+    if (concurrency == 0)
+        concurrency = 1;
+}
+
+uint32_t WorkerPool::get_shared_slots() const SKR_NOEXCEPT
+{
+    // services running beyond their reservation eat into the shared budget
+    const uint32_t reserved = eastl::max(desc.reserved_slots, reserved_active.load());
+    return concurrency > reserved ? concurrency - reserved : 1;
+}
+
+uint32_t WorkerPool::get_worker_count() const SKR_NOEXCEPT
+{
+    // task2 needs the main worker plus at least one thread
+    const uint32_t reserved = eastl::min(desc.reserved_slots, concurrency - 1);
+    return eastl::max(concurrency - reserved, 2u);
+}
+
+bool WorkerPool::try_acquire(EWorkerSlotKind kind) SKR_NOEXCEPT
+{
+    if (kind == kWorkerSlotReserved)
+    {
+        ++reserved_active;
+        return true;
+    }
+    const auto limit = get_shared_slots();
+    auto active = shared_active.load(std::memory_order_relaxed);
+    while (active < limit)
+    {
+        if (shared_active.compare_exchange_weak(active, active + 1))
+            return true;
+    }
+    return false;
+}
+
+void WorkerPool::acquire(EWorkerSlotKind kind) SKR_NOEXCEPT
+{
+    if (try_acquire(kind))
+        return;
+    SMutexLock guard(mutex);
+    ++waiting;
+    if (!try_acquire(kind))
+    {
+        skr_wait_condition_vars(&cv, &mutex, desc.overcommit_timeout_ms);
+        if (!try_acquire(kind))
+        {
+            ++shared_active;
+            ++overcommits;
+        }
+    }
+    --waiting;
+}
+
+void WorkerPool::release(EWorkerSlotKind kind) SKR_NOEXCEPT
+{
+    if (kind == kWorkerSlotReserved)
+    {
+        SKR_ASSERT(reserved_active > 0);
+        --reserved_active;
+    }
+    else
+    {
+        SKR_ASSERT(shared_active > 0);
+        --shared_active;
+    }
+    if (waiting.load())
+    {
+        SMutexLock guard(mutex);
+        skr_wake_condition_var(&cv);
+    }
+}
+
+uint32_t WorkerPool::get_active_count(EWorkerSlotKind kind) const SKR_NOEXCEPT
+{
+    return kind == kWorkerSlotReserved ? reserved_active.load() : shared_active.load();
+}
+} // namespace skr
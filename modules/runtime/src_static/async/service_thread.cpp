@@ -1,5 +1,6 @@
 #include "SkrRT/async/async_service.h"
 #include "SkrRT/async/wait_timeout.hpp"
+#include "SkrRT/async/worker_pool.hpp"
 #include "SkrRT/misc/log.hpp"
 
 #include "tracy/Tracy.hpp"
@@ -171,6 +172,8 @@ RUNNING:
     ZoneScopedN("RUNNING");
     _service->set_status(kStatusRunning);
     skr_atomic32_add_relaxed(&_service->rid, 1);
+    // services are latency sensitive, they run on reserved slots of the worker pool
+    WorkerPool::Get()->acquire(kWorkerSlotReserved);
     for (;;)
     {
         // 1. run service
@@ -179,6 +182,7 @@ RUNNING:
         if (R != ASYNC_RESULT_OK)
         {
             // deal_error();
+            WorkerPool::Get()->release(kWorkerSlotReserved);
             return R;
         }
         // 3. check status
@@ -189,6 +193,7 @@ RUNNING:
         }
         else if (S == kStatusStopping)
         {
+            WorkerPool::Get()->release(kWorkerSlotReserved);
             goto STOP;
         }
         else // kStatusStopped/Exiting/Exitted/Waking
@@ -242,16 +247,49 @@ EXIT:
 
 void AsyncService::sleep() SKR_NOEXCEPT
 {
-    const auto ms = skr_atomicu32_load_relaxed(&sleep_time);
+    sleep_for(UINT32_MAX);
+}
+
+void AsyncService::sleep_for(uint32_t ms) SKR_NOEXCEPT
+{
     ZoneScopedNC("ioServiceSleep(Cond)", tracy::Color::Gray55);
 
+    // a sleeping service does not count against the worker budget
+    WorkerPool::Get()->release(kWorkerSlotReserved);
     condlock.lock();
-    if (!event)
+    skr_atomicu32_store_relaxed(&waiting, 1);
+    // pairs with the fence in awake(), see there
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (ms == UINT32_MAX)
+    {
+        // awake() signals under the lock, so only spurious wakeups come back here
+        while (!skr_atomicu32_load_acquire(&event))
+            condlock.wait(UINT32_MAX);
+    }
+    else if (!skr_atomicu32_load_acquire(&event))
     {
         condlock.wait(ms);
     }
-    event = false;
+    skr_atomicu32_store_relaxed(&waiting, 0);
+    skr_atomicu32_store_relaxed(&event, 0);
     condlock.unlock();
+    WorkerPool::Get()->acquire(kWorkerSlotReserved);
+}
+
+bool AsyncService::spin(uint32_t spin_count) SKR_NOEXCEPT
+{
+    ZoneScopedNC("ioServiceSpin", tracy::Color::Gray55);
+
+    for (uint32_t i = 0; i < spin_count; ++i)
+    {
+        if (skr_atomicu32_load_acquire(&event))
+        {
+            skr_atomicu32_store_relaxed(&event, 0);
+            return true;
+        }
+        skr_atomic_yield();
+    }
+    return false;
 }
 
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "SkrRT/async/thread_job.hpp"
 #include "SkrRT/async/wait_timeout.hpp"
+#include "SkrRT/async/worker_pool.hpp"
 #include "job_thread.hpp"
 #include "SkrRT/containers/vector.hpp"
 #include "SkrRT/misc/defer.hpp"
@@ -10,9 +11,10 @@ namespace skr
 struct JobThreadFunctionImpl : public JobThreadFunction
 {
 public:
-    JobThreadFunctionImpl(JobItemQueue* itemQueue)
+    JobThreadFunctionImpl(JobItemQueue* itemQueue, bool cpuBound)
         : m_item(nullptr)
         , m_queue(itemQueue)
+        , m_cpuBound(cpuBound)
     {
         
     }
@@ -25,6 +27,7 @@ protected:
 private:
     JobItem*		m_item;
     JobItemQueue*	m_queue;
+    bool			m_cpuBound;
 };
 
 struct JobItemQueue
@@ -162,7 +165,16 @@ JobResult JobThreadFunctionImpl::run() SKR_NOEXCEPT
             // exit the loop when the end job is arrived
             isEndJobArrived = (itemStatus == kJobItemStatusFinishJob);
 
-            m_item->result = m_item->run();
+            // blocking items would hold the slot while waiting, so only cpu bound queues take one
+            if (m_cpuBound)
+            {
+                WorkerPoolSlot slot(kWorkerSlotShared);
+                m_item->result = m_item->run();
+            }
+            else
+            {
+                m_item->result = m_item->run();
+            }
 
             // delete the JobItem which has been executed
             m_queue->erase(m_item);
@@ -238,7 +250,7 @@ JobResult JobQueue::initialize() SKR_NOEXCEPT
     const char8_t* n = desc.name;
     for (uint32_t i = 0; i < desc.thread_count; ++i)
     {
-        JobThreadFunction* jobfunc = SkrNew<JobThreadFunctionImpl>(itemList);
+        JobThreadFunction* jobfunc = SkrNew<JobThreadFunctionImpl>(itemList, desc.cpu_bound);
         SKR_ASSERT(jobfunc != nullptr);
         if (jobfunc == nullptr)
         {
@@ -116,10 +116,14 @@ skr_camera_comp_t
 
 struct skr_transform_system_t {
     dual_query_t* relativeToWorld;
+    // spatial index over the world transforms, refreshed by skr_transform_update
+    struct skr_spatial_system_t* spatial;
 };
 
 SKR_SCENE_EXTERN_C SKR_SCENE_API void skr_transform_setup(dual_storage_t* world, skr_transform_system_t* system);
+// schedules the transform jobs and the spatial index update that depends on them, nothing is waited for
 SKR_SCENE_EXTERN_C SKR_SCENE_API void skr_transform_update(skr_transform_system_t* query);
+SKR_SCENE_EXTERN_C SKR_SCENE_API void skr_transform_release(skr_transform_system_t* system);
 SKR_SCENE_EXTERN_C SKR_SCENE_API void skr_propagate_transform(dual_storage_t* world, dual_entity_t* entities, uint32_t count);
 SKR_SCENE_EXTERN_C SKR_SCENE_API void skr_save_scene(dual_storage_t* world, struct skr_json_writer_t* writer);
 SKR_SCENE_EXTERN_C SKR_SCENE_API void skr_load_scene(dual_storage_t* world, struct skr_json_reader_t* reader);
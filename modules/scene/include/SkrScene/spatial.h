@@ -0,0 +1,176 @@
+#pragma once
+#include "SkrScene/module.configure.h"
+#include "SkrScene/scene.h"
+#ifndef __meta__
+    #include "SkrScene/spatial.generated.h" // IWYU pragma: export
+#endif
+
+// spatial index
+
+// entity space bounds, entities with it and a skr_transform_comp_t are tracked by the spatial system
+sreflect_struct(
+    "guid" : "3b9f6c1e-7d24-4e8a-a5c0-2f81d94b6e37",
+    "component" : true
+)
+skr_spatial_bounds_comp_t
+{
+    skr_float3_t center;
+    skr_float3_t extents;
+};
+typedef struct skr_spatial_bounds_comp_t skr_spatial_bounds_comp_t;
+
+#ifdef __cplusplus
+#include "SkrRT/containers/span.hpp"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/containers/function_ref.hpp"
+#include <cfloat>
+
+namespace skr
+{
+namespace scene
+{
+struct AABB {
+    skr_float3_t min;
+    skr_float3_t max;
+};
+
+struct Sphere {
+    skr_float3_t center;
+    float radius = 0.f;
+};
+
+struct Ray {
+    skr_float3_t origin;
+    // does not need to be normalized, hit distances are in units of its length
+    skr_float3_t direction;
+    float max_distance = FLT_MAX;
+};
+
+struct RayHit {
+    dual_entity_t entity = DUAL_NULL_ENTITY;
+    float distance = FLT_MAX;
+};
+
+// a point p is inside when dot(plane.xyz, p) + plane.w >= 0 for every plane
+struct Frustum {
+    skr_float4_t planes[6];
+
+    // planes of a row-vector view projection matrix with [0, 1] depth
+    SKR_SCENE_API static Frustum FromViewProjection(const skr_float4x4_t& view_projection);
+};
+
+// world center & extents of an entity space box, the center goes through the full transform, the extents through |rotation * scale|
+SKR_SCENE_API void TransformBounds(const skr_transform_t& transform, const skr_float3_t& center, const skr_float3_t& extents,
+    skr_float3_t& out_center, skr_float3_t& out_extents) SKR_NOEXCEPT;
+
+// incrementally updated bounding volume hierarchy over entity bounds
+// leaves keep fat bounds so small motions only refit, subtrees are periodically rebuilt with SAH
+// queries are const and may run concurrently, but never at the same time as a modification
+struct SKR_SCENE_API DynamicBVH {
+    using ProxyId = int32_t;
+    static constexpr ProxyId kNullProxy = -1;
+    // visitors return false to stop the query
+    using Visitor = skr::function_ref<bool(dual_entity_t)>;
+
+    DynamicBVH() SKR_NOEXCEPT;
+    ~DynamicBVH() SKR_NOEXCEPT;
+    DynamicBVH(const DynamicBVH&) = delete;
+    DynamicBVH& operator=(const DynamicBVH&) = delete;
+
+    ProxyId create_proxy(const AABB& bounds, dual_entity_t entity) SKR_NOEXCEPT;
+    void destroy_proxy(ProxyId proxy) SKR_NOEXCEPT;
+    // displacement is the motion since the last move, the fat bounds are stretched along it
+    // returns true when the leaf left its fat bounds and was reinserted
+    bool move_proxy(ProxyId proxy, const AABB& bounds, const skr_float3_t& displacement) SKR_NOEXCEPT;
+    const AABB& get_bounds(ProxyId proxy) const SKR_NOEXCEPT;
+    dual_entity_t get_entity(ProxyId proxy) const SKR_NOEXCEPT;
+
+    // rebuilds one subtree of at most max_leaves leaves with SAH, successive calls walk over the whole tree
+    void rebuild_partial(uint32_t max_leaves) SKR_NOEXCEPT;
+    void rebuild_full() SKR_NOEXCEPT;
+
+    void query_aabb(const AABB& aabb, Visitor visitor) const SKR_NOEXCEPT;
+    void query_sphere(const Sphere& sphere, Visitor visitor) const SKR_NOEXCEPT;
+    void query_frustum(const Frustum& frustum, Visitor visitor) const SKR_NOEXCEPT;
+    // closest hit against the entity bounds
+    bool raycast(const Ray& ray, RayHit& hit) const SKR_NOEXCEPT;
+
+    // batched queries run as parallel jobs, results[i] belongs to queries[i]
+    void raycast_batch(skr::span<const Ray> rays, skr::span<RayHit> hits) const SKR_NOEXCEPT;
+    void query_aabb_batch(skr::span<const AABB> aabbs, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT;
+    void query_sphere_batch(skr::span<const Sphere> spheres, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT;
+    void query_frustum_batch(skr::span<const Frustum> frustums, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT;
+
+    uint32_t get_proxy_count() const SKR_NOEXCEPT { return proxy_count; }
+    int32_t get_height() const SKR_NOEXCEPT;
+    // sum of all node surface areas over the root surface area, grows as the tree degrades
+    float get_area_ratio() const SKR_NOEXCEPT;
+    bool validate() const SKR_NOEXCEPT;
+
+    // leaves are enlarged by this margin, and by the displacement times fat_displacement_scale
+    float fat_margin = 0.1f;
+    float fat_displacement_scale = 2.f;
+
+protected:
+    struct Node {
+        AABB fat_bounds;
+        // tight bounds for leaves
+        AABB bounds;
+        dual_entity_t entity = DUAL_NULL_ENTITY;
+        // parent for nodes in the tree, next free node in the free list
+        int32_t parent = -1;
+        int32_t child1 = -1;
+        int32_t child2 = -1;
+        // leaf 0, free -1
+        int32_t height = -1;
+        bool is_leaf() const { return child1 == -1; }
+    };
+
+    int32_t allocate_node();
+    void free_node(int32_t node);
+    void insert_leaf(int32_t leaf);
+    void remove_leaf(int32_t leaf);
+    int32_t balance(int32_t node);
+    void refit_ancestors(int32_t node);
+    int32_t build_sah(int32_t* leaves, uint32_t count);
+    void collect_subtree(int32_t node, skr::vector<int32_t>& leaves);
+
+    skr::vector<Node> nodes;
+    int32_t root = -1;
+    int32_t free_list = -1;
+    uint32_t proxy_count = 0;
+    uint32_t rebuild_path = 0;
+};
+} // namespace scene
+} // namespace skr
+
+// keeps a DynamicBVH in sync with the world bounds of every entity that has
+// skr_spatial_bounds_comp_t and skr_transform_comp_t
+struct SKR_SCENE_API skr_spatial_system_t {
+    // schedules a job after the jobs writing the transforms or bounds, it adds, moves and removes proxies and rebuilds
+    // a part of the tree. only chunks written since the last update are visited, so transforms and bounds must be
+    // written through rw access (dualV_get_owned_rw). skr_transform_update calls it for the system it owns
+    virtual void update() SKR_NOEXCEPT = 0;
+    // waits for the job of the last update
+    virtual void sync() SKR_NOEXCEPT = 0;
+    // jobs reading the tree list it as a read resource to run after the update
+    virtual dual_entity_t get_resource() const SKR_NOEXCEPT = 0;
+
+    // queries take a read lock and may be called from worker jobs, they see the last finished update
+    virtual void query_aabb(const skr::scene::AABB& aabb, skr::scene::DynamicBVH::Visitor visitor) const SKR_NOEXCEPT = 0;
+    virtual void query_sphere(const skr::scene::Sphere& sphere, skr::scene::DynamicBVH::Visitor visitor) const SKR_NOEXCEPT = 0;
+    virtual void query_frustum(const skr::scene::Frustum& frustum, skr::scene::DynamicBVH::Visitor visitor) const SKR_NOEXCEPT = 0;
+    virtual bool raycast(const skr::scene::Ray& ray, skr::scene::RayHit& hit) const SKR_NOEXCEPT = 0;
+    virtual void raycast_batch(skr::span<const skr::scene::Ray> rays, skr::span<skr::scene::RayHit> hits) const SKR_NOEXCEPT = 0;
+    virtual void query_aabb_batch(skr::span<const skr::scene::AABB> aabbs, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT = 0;
+    virtual void query_sphere_batch(skr::span<const skr::scene::Sphere> spheres, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT = 0;
+    virtual void query_frustum_batch(skr::span<const skr::scene::Frustum> frustums, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT = 0;
+
+    // leaves rebuilt with SAH per update
+    uint32_t rebuild_leaves_per_update = 256;
+
+    static skr_spatial_system_t* Create(dual_storage_t* world);
+    static void Free(skr_spatial_system_t* system);
+    virtual ~skr_spatial_system_t() SKR_NOEXCEPT;
+};
+#endif
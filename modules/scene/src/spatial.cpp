@@ -0,0 +1,975 @@
+#include "SkrRT/platform/thread.h"
+#include "SkrRT/math/rtm/vector4f.h"
+#include "SkrRT/math/rtm/qvvf.h"
+#include "SkrRT/math/rtm/matrix4x4f.h"
+#include "SkrRT/math/vector.h"
+#include "SkrRT/math/transform.h"
+#include "SkrRT/misc/parallel_for.hpp"
+#include "SkrRT/containers/hashmap.hpp"
+#include "SkrRT/ecs/dual.h"
+#include "SkrScene/spatial.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "tracy/Tracy.hpp"
+
+namespace skr
+{
+namespace scene
+{
+namespace
+{
+AABB Union(const AABB& a, const AABB& b)
+{
+    return {
+        { std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z) },
+        { std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z) }
+    };
+}
+
+// half of the surface area, only used for comparisons
+float Area(const AABB& a)
+{
+    const float dx = a.max.x - a.min.x, dy = a.max.y - a.min.y, dz = a.max.z - a.min.z;
+    return dx * dy + dy * dz + dz * dx;
+}
+
+bool Contains(const AABB& outer, const AABB& inner)
+{
+    return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+           inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+}
+
+bool Overlaps(const AABB& a, const AABB& b)
+{
+    return a.min.x <= b.max.x && b.min.x <= a.max.x &&
+           a.min.y <= b.max.y && b.min.y <= a.max.y &&
+           a.min.z <= b.max.z && b.min.z <= a.max.z;
+}
+
+AABB Expand(const AABB& a, float margin)
+{
+    return {
+        { a.min.x - margin, a.min.y - margin, a.min.z - margin },
+        { a.max.x + margin, a.max.y + margin, a.max.z + margin }
+    };
+}
+
+bool Overlaps(const AABB& a, const Sphere& s)
+{
+    const float dx = std::max(std::max(a.min.x - s.center.x, 0.f), s.center.x - a.max.x);
+    const float dy = std::max(std::max(a.min.y - s.center.y, 0.f), s.center.y - a.max.y);
+    const float dz = std::max(std::max(a.min.z - s.center.z, 0.f), s.center.z - a.max.z);
+    return dx * dx + dy * dy + dz * dz <= s.radius * s.radius;
+}
+
+bool Overlaps(const AABB& a, const Frustum& f)
+{
+    const float c[3] = { (a.min.x + a.max.x) * 0.5f, (a.min.y + a.max.y) * 0.5f, (a.min.z + a.max.z) * 0.5f };
+    const float e[3] = { (a.max.x - a.min.x) * 0.5f, (a.max.y - a.min.y) * 0.5f, (a.max.z - a.min.z) * 0.5f };
+    for (const auto& p : f.planes)
+    {
+        const float d = p.x * c[0] + p.y * c[1] + p.z * c[2] + p.w;
+        const float r = fabsf(p.x) * e[0] + fabsf(p.y) * e[1] + fabsf(p.z) * e[2];
+        if (d + r < 0.f) return false;
+    }
+    return true;
+}
+
+// slab test, returns the entry distance or a negative value on miss
+float Intersect(const AABB& a, const skr_float3_t& origin, const skr_float3_t& inv_dir, float max_distance)
+{
+    const float tx1 = (a.min.x - origin.x) * inv_dir.x, tx2 = (a.max.x - origin.x) * inv_dir.x;
+    const float ty1 = (a.min.y - origin.y) * inv_dir.y, ty2 = (a.max.y - origin.y) * inv_dir.y;
+    const float tz1 = (a.min.z - origin.z) * inv_dir.z, tz2 = (a.max.z - origin.z) * inv_dir.z;
+    const float tmin = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::max(std::min(tz1, tz2), 0.f));
+    const float tmax = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::min(std::max(tz1, tz2), max_distance));
+    return tmin <= tmax ? tmin : -1.f;
+}
+
+skr_float3_t Centroid(const AABB& a)
+{
+    return { (a.min.x + a.max.x) * 0.5f, (a.min.y + a.max.y) * 0.5f, (a.min.z + a.max.z) * 0.5f };
+}
+
+float Axis(const skr_float3_t& v, uint32_t axis)
+{
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+// traversal stack that only touches the heap for degenerated trees
+struct TraversalStack {
+    int32_t inline_nodes[64];
+    skr::vector<int32_t> overflow;
+    uint32_t count = 0;
+
+    void push(int32_t node)
+    {
+        if (count < 64)
+            inline_nodes[count] = node;
+        else
+            overflow.push_back(node);
+        count++;
+    }
+    int32_t pop()
+    {
+        count--;
+        if (count < 64)
+            return inline_nodes[count];
+        const auto node = overflow.back();
+        overflow.pop_back();
+        return node;
+    }
+    bool empty() const { return count == 0; }
+};
+
+static constexpr uint32_t kSAHBins = 12;
+} // namespace
+
+Frustum Frustum::FromViewProjection(const skr_float4x4_t& view_projection)
+{
+    // row-vector matrix: clip = p * M, each clip coordinate is a column of M
+    const auto& M = view_projection.M;
+    const auto column = [&](uint32_t j) {
+        return skr_float4_t{ M[0][j], M[1][j], M[2][j], M[3][j] };
+    };
+    const auto c0 = column(0), c1 = column(1), c2 = column(2), c3 = column(3);
+    const auto add = [](const skr_float4_t& a, const skr_float4_t& b) { return skr_float4_t{ a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }; };
+    const auto sub = [](const skr_float4_t& a, const skr_float4_t& b) { return skr_float4_t{ a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w }; };
+    Frustum frustum;
+    frustum.planes[0] = add(c3, c0); // left
+    frustum.planes[1] = sub(c3, c0); // right
+    frustum.planes[2] = add(c3, c1); // bottom
+    frustum.planes[3] = sub(c3, c1); // top
+    frustum.planes[4] = c2;          // near, depth is [0, 1]
+    frustum.planes[5] = sub(c3, c2); // far
+    return frustum;
+}
+
+void TransformBounds(const skr_transform_t& transform, const skr_float3_t& center, const skr_float3_t& extents,
+    skr_float3_t& out_center, skr_float3_t& out_extents) SKR_NOEXCEPT
+{
+    const rtm::matrix4x4f m = rtm::matrix_cast(rtm::matrix_from_qvv(skr::math::load(transform)));
+    const auto& c = center;
+    const auto& e = extents;
+    const auto world_center = rtm::vector_mul_add(m.x_axis, c.x, rtm::vector_mul_add(m.y_axis, c.y, rtm::vector_mul_add(m.z_axis, c.z, m.w_axis)));
+    const auto world_extents = rtm::vector_mul_add(rtm::vector_abs(m.x_axis), e.x, rtm::vector_mul_add(rtm::vector_abs(m.y_axis), e.y, rtm::vector_mul(rtm::vector_abs(m.z_axis), e.z)));
+    skr::math::store(world_center, out_center);
+    skr::math::store(world_extents, out_extents);
+}
+
+DynamicBVH::DynamicBVH() SKR_NOEXCEPT
+{
+    nodes.reserve(64);
+}
+
+DynamicBVH::~DynamicBVH() SKR_NOEXCEPT
+{
+}
+
+int32_t DynamicBVH::allocate_node()
+{
+    if (free_list == -1)
+    {
+        nodes.emplace_back();
+        free_list = (int32_t)nodes.size() - 1;
+        nodes[free_list].parent = -1;
+    }
+    const int32_t node = free_list;
+    free_list = nodes[node].parent;
+    nodes[node] = Node();
+    nodes[node].height = 0;
+    return node;
+}
+
+void DynamicBVH::free_node(int32_t node)
+{
+    SKR_ASSERT(0 <= node && node < (int32_t)nodes.size());
+    nodes[node].parent = free_list;
+    nodes[node].height = -1;
+    free_list = node;
+}
+
+DynamicBVH::ProxyId DynamicBVH::create_proxy(const AABB& bounds, dual_entity_t entity) SKR_NOEXCEPT
+{
+    const int32_t proxy = allocate_node();
+    nodes[proxy].bounds = bounds;
+    nodes[proxy].fat_bounds = Expand(bounds, fat_margin);
+    nodes[proxy].entity = entity;
+    insert_leaf(proxy);
+    proxy_count++;
+    return proxy;
+}
+
+void DynamicBVH::destroy_proxy(ProxyId proxy) SKR_NOEXCEPT
+{
+    SKR_ASSERT(0 <= proxy && proxy < (int32_t)nodes.size() && nodes[proxy].is_leaf());
+    remove_leaf(proxy);
+    free_node(proxy);
+    proxy_count--;
+}
+
+bool DynamicBVH::move_proxy(ProxyId proxy, const AABB& bounds, const skr_float3_t& displacement) SKR_NOEXCEPT
+{
+    SKR_ASSERT(0 <= proxy && proxy < (int32_t)nodes.size() && nodes[proxy].is_leaf());
+    auto& node = nodes[proxy];
+    node.bounds = bounds;
+
+    // predict the motion so that steadily moving entities stay inside their fat bounds for a few updates
+    AABB fat = Expand(bounds, fat_margin);
+    const float d[3] = { displacement.x * fat_displacement_scale, displacement.y * fat_displacement_scale, displacement.z * fat_displacement_scale };
+    (d[0] < 0.f ? fat.min.x : fat.max.x) += d[0];
+    (d[1] < 0.f ? fat.min.y : fat.max.y) += d[1];
+    (d[2] < 0.f ? fat.min.z : fat.max.z) += d[2];
+
+    if (Contains(node.fat_bounds, bounds))
+    {
+        // still inside, only reinsert when the fat bounds became much larger than needed
+        const AABB huge = Expand(fat, 4.f * fat_margin);
+        if (Contains(huge, node.fat_bounds))
+            return false;
+    }
+    remove_leaf(proxy);
+    nodes[proxy].fat_bounds = fat;
+    insert_leaf(proxy);
+    return true;
+}
+
+const AABB& DynamicBVH::get_bounds(ProxyId proxy) const SKR_NOEXCEPT
+{
+    SKR_ASSERT(0 <= proxy && proxy < (int32_t)nodes.size());
+    return nodes[proxy].bounds;
+}
+
+dual_entity_t DynamicBVH::get_entity(ProxyId proxy) const SKR_NOEXCEPT
+{
+    SKR_ASSERT(0 <= proxy && proxy < (int32_t)nodes.size());
+    return nodes[proxy].entity;
+}
+
+void DynamicBVH::insert_leaf(int32_t leaf)
+{
+    if (root == -1)
+    {
+        root = leaf;
+        nodes[root].parent = -1;
+        return;
+    }
+
+    // descend to the sibling with the lowest surface area cost
+    const AABB leaf_bounds = nodes[leaf].fat_bounds;
+    int32_t index = root;
+    while (!nodes[index].is_leaf())
+    {
+        const auto& node = nodes[index];
+        const float area = Area(node.fat_bounds);
+        const float combined_area = Area(Union(node.fat_bounds, leaf_bounds));
+        // cost of a new parent for this node and the leaf
+        const float cost = 2.f * combined_area;
+        // minimum cost of pushing the leaf further down
+        const float inheritance_cost = 2.f * (combined_area - area);
+        const auto child_cost = [&](int32_t child) {
+            const auto& c = nodes[child];
+            const float enlarged = Area(Union(leaf_bounds, c.fat_bounds));
+            return (c.is_leaf() ? enlarged : enlarged - Area(c.fat_bounds)) + inheritance_cost;
+        };
+        const float cost1 = child_cost(node.child1);
+        const float cost2 = child_cost(node.child2);
+        if (cost < cost1 && cost < cost2)
+            break;
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+    const int32_t sibling = index;
+
+    const int32_t old_parent = nodes[sibling].parent;
+    const int32_t new_parent = allocate_node();
+    nodes[new_parent].parent = old_parent;
+    nodes[new_parent].fat_bounds = Union(leaf_bounds, nodes[sibling].fat_bounds);
+    nodes[new_parent].height = nodes[sibling].height + 1;
+    nodes[new_parent].child1 = sibling;
+    nodes[new_parent].child2 = leaf;
+    nodes[sibling].parent = new_parent;
+    nodes[leaf].parent = new_parent;
+    if (old_parent != -1)
+    {
+        if (nodes[old_parent].child1 == sibling)
+            nodes[old_parent].child1 = new_parent;
+        else
+            nodes[old_parent].child2 = new_parent;
+    }
+    else
+        root = new_parent;
+
+    refit_ancestors(nodes[leaf].parent);
+}
+
+void DynamicBVH::remove_leaf(int32_t leaf)
+{
+    if (leaf == root)
+    {
+        root = -1;
+        return;
+    }
+    const int32_t parent = nodes[leaf].parent;
+    const int32_t grand_parent = nodes[parent].parent;
+    const int32_t sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+    if (grand_parent != -1)
+    {
+        if (nodes[grand_parent].child1 == parent)
+            nodes[grand_parent].child1 = sibling;
+        else
+            nodes[grand_parent].child2 = sibling;
+        nodes[sibling].parent = grand_parent;
+        free_node(parent);
+        refit_ancestors(grand_parent);
+    }
+    else
+    {
+        root = sibling;
+        nodes[sibling].parent = -1;
+        free_node(parent);
+    }
+    nodes[leaf].parent = -1;
+}
+
+void DynamicBVH::refit_ancestors(int32_t index)
+{
+    while (index != -1)
+    {
+        index = balance(index);
+        auto& node = nodes[index];
+        const auto& c1 = nodes[node.child1];
+        const auto& c2 = nodes[node.child2];
+        node.height = 1 + std::max(c1.height, c2.height);
+        node.fat_bounds = Union(c1.fat_bounds, c2.fat_bounds);
+        index = node.parent;
+    }
+}
+
+// rotates the taller grand child up when the children of a differ in height by more than one,
+// returns the node now occupying the position of a
+int32_t DynamicBVH::balance(int32_t a)
+{
+    auto& A = nodes[a];
+    if (A.is_leaf() || A.height < 2)
+        return a;
+
+    const int32_t b = A.child1;
+    const int32_t c = A.child2;
+    const int32_t skew = nodes[c].height - nodes[b].height;
+
+    const auto rotate_up = [&](int32_t up, int32_t other) {
+        // up is a child of a with children f and g, it replaces a
+        auto& U = nodes[up];
+        const int32_t f = U.child1;
+        const int32_t g = U.child2;
+        U.child1 = a;
+        U.parent = A.parent;
+        A.parent = up;
+        if (U.parent != -1)
+        {
+            if (nodes[U.parent].child1 == a)
+                nodes[U.parent].child1 = up;
+            else
+                nodes[U.parent].child2 = up;
+        }
+        else
+            root = up;
+
+        // keep the taller of f and g under up, give the other one to a
+        const bool keep_f = nodes[f].height > nodes[g].height;
+        const int32_t keep = keep_f ? f : g;
+        const int32_t give = keep_f ? g : f;
+        U.child2 = keep;
+        if (A.child1 == up)
+            A.child1 = give;
+        else
+            A.child2 = give;
+        nodes[give].parent = a;
+        A.fat_bounds = Union(nodes[other].fat_bounds, nodes[give].fat_bounds);
+        U.fat_bounds = Union(A.fat_bounds, nodes[keep].fat_bounds);
+        A.height = 1 + std::max(nodes[other].height, nodes[give].height);
+        U.height = 1 + std::max(A.height, nodes[keep].height);
+        return up;
+    };
+
+    if (skew > 1)
+        return rotate_up(c, b);
+    if (skew < -1)
+        return rotate_up(b, c);
+    return a;
+}
+
+void DynamicBVH::collect_subtree(int32_t node, skr::vector<int32_t>& leaves)
+{
+    if (nodes[node].is_leaf())
+    {
+        leaves.push_back(node);
+        return;
+    }
+    const int32_t child1 = nodes[node].child1;
+    const int32_t child2 = nodes[node].child2;
+    free_node(node);
+    collect_subtree(child1, leaves);
+    collect_subtree(child2, leaves);
+}
+
+// binned SAH over the leaf centroids, internal nodes come from the free list filled by collect_subtree
+int32_t DynamicBVH::build_sah(int32_t* leaves, uint32_t count)
+{
+    if (count == 1)
+        return leaves[0];
+
+    AABB centroid_bounds = { Centroid(nodes[leaves[0]].fat_bounds), Centroid(nodes[leaves[0]].fat_bounds) };
+    for (uint32_t i = 1; i < count; ++i)
+    {
+        const auto c = Centroid(nodes[leaves[i]].fat_bounds);
+        centroid_bounds = Union(centroid_bounds, { c, c });
+    }
+    const skr_float3_t extent = {
+        centroid_bounds.max.x - centroid_bounds.min.x,
+        centroid_bounds.max.y - centroid_bounds.min.y,
+        centroid_bounds.max.z - centroid_bounds.min.z
+    };
+    const uint32_t axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+    const float axis_min = Axis(centroid_bounds.min, axis);
+    const float axis_extent = Axis(extent, axis);
+
+    uint32_t mid = count / 2;
+    if (axis_extent > 0.f && count > 2)
+    {
+        const float scale = kSAHBins / axis_extent;
+        const auto bin_of = [&](int32_t leaf) {
+            const float c = Axis(Centroid(nodes[leaf].fat_bounds), axis);
+            return std::min((uint32_t)((c - axis_min) * scale), kSAHBins - 1);
+        };
+        uint32_t bin_counts[kSAHBins] = {};
+        AABB bin_bounds[kSAHBins];
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const auto bin = bin_of(leaves[i]);
+            bin_bounds[bin] = bin_counts[bin] ? Union(bin_bounds[bin], nodes[leaves[i]].fat_bounds) : nodes[leaves[i]].fat_bounds;
+            bin_counts[bin]++;
+        }
+        // sweep from the right to get the cost of every right side, then from the left
+        float right_areas[kSAHBins];
+        uint32_t right_counts[kSAHBins];
+        {
+            AABB acc = {};
+            uint32_t n = 0;
+            for (uint32_t i = kSAHBins - 1; i > 0; --i)
+            {
+                if (bin_counts[i])
+                    acc = n ? Union(acc, bin_bounds[i]) : bin_bounds[i];
+                n += bin_counts[i];
+                right_counts[i] = n;
+                right_areas[i] = n ? Area(acc) : 0.f;
+            }
+        }
+        float best_cost = FLT_MAX;
+        uint32_t best_split = 0;
+        AABB acc = {};
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < kSAHBins - 1; ++i)
+        {
+            if (bin_counts[i])
+                acc = n ? Union(acc, bin_bounds[i]) : bin_bounds[i];
+            n += bin_counts[i];
+            if (!n || !right_counts[i + 1]) continue;
+            const float cost = n * Area(acc) + right_counts[i + 1] * right_areas[i + 1];
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best_split = i + 1;
+            }
+        }
+        if (best_split)
+            mid = (uint32_t)(std::partition(leaves, leaves + count, [&](int32_t leaf) { return bin_of(leaf) < best_split; }) - leaves);
+    }
+    if (mid == 0 || mid == count)
+    {
+        // every centroid in one bin, fall back to a median split
+        mid = count / 2;
+        std::nth_element(leaves, leaves + mid, leaves + count, [&](int32_t a, int32_t b) {
+            return Axis(Centroid(nodes[a].fat_bounds), axis) < Axis(Centroid(nodes[b].fat_bounds), axis);
+        });
+    }
+
+    const int32_t child1 = build_sah(leaves, mid);
+    const int32_t child2 = build_sah(leaves + mid, count - mid);
+    const int32_t node = allocate_node();
+    auto& N = nodes[node];
+    N.child1 = child1;
+    N.child2 = child2;
+    N.fat_bounds = Union(nodes[child1].fat_bounds, nodes[child2].fat_bounds);
+    N.height = 1 + std::max(nodes[child1].height, nodes[child2].height);
+    nodes[child1].parent = node;
+    nodes[child2].parent = node;
+    return node;
+}
+
+void DynamicBVH::rebuild_partial(uint32_t max_leaves) SKR_NOEXCEPT
+{
+    if (root == -1 || max_leaves < 2) return;
+
+    // walk down along the bits of a rotating counter, so successive calls visit different subtrees
+    int32_t target_height = 0;
+    while ((2u << target_height) <= max_leaves) target_height++;
+    int32_t index = root;
+    uint32_t path = rebuild_path++;
+    while (nodes[index].height > target_height)
+    {
+        index = (path & 1) ? nodes[index].child2 : nodes[index].child1;
+        path >>= 1;
+    }
+    if (nodes[index].is_leaf()) return;
+
+    ZoneScopedN("BVHRebuildPartial");
+    const int32_t parent = nodes[index].parent;
+    skr::vector<int32_t> leaves;
+    leaves.reserve(1u << target_height);
+    collect_subtree(index, leaves);
+    const int32_t subtree = build_sah(leaves.data(), (uint32_t)leaves.size());
+    nodes[subtree].parent = parent;
+    if (parent != -1)
+    {
+        if (nodes[parent].child1 == index)
+            nodes[parent].child1 = subtree;
+        else
+            nodes[parent].child2 = subtree;
+        refit_ancestors(parent);
+    }
+    else
+        root = subtree;
+}
+
+void DynamicBVH::rebuild_full() SKR_NOEXCEPT
+{
+    if (root == -1) return;
+
+    ZoneScopedN("BVHRebuildFull");
+    skr::vector<int32_t> leaves;
+    leaves.reserve(proxy_count);
+    collect_subtree(root, leaves);
+    root = build_sah(leaves.data(), (uint32_t)leaves.size());
+    nodes[root].parent = -1;
+}
+
+void DynamicBVH::query_aabb(const AABB& aabb, Visitor visitor) const SKR_NOEXCEPT
+{
+    if (root == -1) return;
+    TraversalStack stack;
+    stack.push(root);
+    while (!stack.empty())
+    {
+        const auto& node = nodes[stack.pop()];
+        if (!Overlaps(node.fat_bounds, aabb)) continue;
+        if (node.is_leaf())
+        {
+            if (Overlaps(node.bounds, aabb) && !visitor(node.entity))
+                return;
+            continue;
+        }
+        stack.push(node.child1);
+        stack.push(node.child2);
+    }
+}
+
+void DynamicBVH::query_sphere(const Sphere& sphere, Visitor visitor) const SKR_NOEXCEPT
+{
+    if (root == -1) return;
+    TraversalStack stack;
+    stack.push(root);
+    while (!stack.empty())
+    {
+        const auto& node = nodes[stack.pop()];
+        if (!Overlaps(node.fat_bounds, sphere)) continue;
+        if (node.is_leaf())
+        {
+            if (Overlaps(node.bounds, sphere) && !visitor(node.entity))
+                return;
+            continue;
+        }
+        stack.push(node.child1);
+        stack.push(node.child2);
+    }
+}
+
+void DynamicBVH::query_frustum(const Frustum& frustum, Visitor visitor) const SKR_NOEXCEPT
+{
+    if (root == -1) return;
+    TraversalStack stack;
+    stack.push(root);
+    while (!stack.empty())
+    {
+        const auto& node = nodes[stack.pop()];
+        if (!Overlaps(node.fat_bounds, frustum)) continue;
+        if (node.is_leaf())
+        {
+            if (Overlaps(node.bounds, frustum) && !visitor(node.entity))
+                return;
+            continue;
+        }
+        stack.push(node.child1);
+        stack.push(node.child2);
+    }
+}
+
+bool DynamicBVH::raycast(const Ray& ray, RayHit& hit) const SKR_NOEXCEPT
+{
+    hit = RayHit();
+    if (root == -1) return false;
+
+    // 1/0 gives inf, which the slab test handles for axis aligned rays
+    const skr_float3_t inv_dir = { 1.f / ray.direction.x, 1.f / ray.direction.y, 1.f / ray.direction.z };
+    float closest = ray.max_distance;
+    TraversalStack stack;
+    stack.push(root);
+    while (!stack.empty())
+    {
+        const auto& node = nodes[stack.pop()];
+        if (Intersect(node.fat_bounds, ray.origin, inv_dir, closest) < 0.f) continue;
+        if (node.is_leaf())
+        {
+            const float t = Intersect(node.bounds, ray.origin, inv_dir, closest);
+            if (t >= 0.f && t <= closest)
+            {
+                closest = t;
+                hit.entity = node.entity;
+                hit.distance = t;
+            }
+            continue;
+        }
+        // visit the nearer child first so the far one is more likely to be pruned
+        const float t1 = Intersect(nodes[node.child1].fat_bounds, ray.origin, inv_dir, closest);
+        const float t2 = Intersect(nodes[node.child2].fat_bounds, ray.origin, inv_dir, closest);
+        if (t1 < t2)
+        {
+            if (t2 >= 0.f) stack.push(node.child2);
+            if (t1 >= 0.f) stack.push(node.child1);
+        }
+        else
+        {
+            if (t1 >= 0.f) stack.push(node.child1);
+            if (t2 >= 0.f) stack.push(node.child2);
+        }
+    }
+    return hit.entity != DUAL_NULL_ENTITY;
+}
+
+void DynamicBVH::raycast_batch(skr::span<const Ray> rays, skr::span<RayHit> hits) const SKR_NOEXCEPT
+{
+    ZoneScopedN("BVHRaycastBatch");
+    SKR_ASSERT(hits.size() >= rays.size());
+    const Ray* begin = rays.data();
+    skr::parallel_for(begin, begin + rays.size(), 64u,
+        [&](const Ray* l, const Ray* r) {
+            for (auto ray = l; ray != r; ++ray)
+                raycast(*ray, hits[ray - begin]);
+        }, 2u);
+}
+
+template <class Query, class F>
+static void QueryBatch(skr::span<const Query> queries, skr::span<skr::vector<dual_entity_t>> results, F&& query)
+{
+    SKR_ASSERT(results.size() >= queries.size());
+    const Query* begin = queries.data();
+    skr::parallel_for(begin, begin + queries.size(), 4u,
+        [&](const Query* l, const Query* r) {
+            for (auto q = l; q != r; ++q)
+            {
+                auto& result = results[q - begin];
+                result.clear();
+                query(*q, [&](dual_entity_t entity) {
+                    result.push_back(entity);
+                    return true;
+                });
+            }
+        }, 2u);
+}
+
+void DynamicBVH::query_aabb_batch(skr::span<const AABB> aabbs, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT
+{
+    ZoneScopedN("BVHQueryAABBBatch");
+    QueryBatch(aabbs, results, [this](const AABB& q, Visitor v) { query_aabb(q, v); });
+}
+
+void DynamicBVH::query_sphere_batch(skr::span<const Sphere> spheres, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT
+{
+    ZoneScopedN("BVHQuerySphereBatch");
+    QueryBatch(spheres, results, [this](const Sphere& q, Visitor v) { query_sphere(q, v); });
+}
+
+void DynamicBVH::query_frustum_batch(skr::span<const Frustum> frustums, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT
+{
+    ZoneScopedN("BVHQueryFrustumBatch");
+    QueryBatch(frustums, results, [this](const Frustum& q, Visitor v) { query_frustum(q, v); });
+}
+
+int32_t DynamicBVH::get_height() const SKR_NOEXCEPT
+{
+    return root == -1 ? 0 : nodes[root].height;
+}
+
+float DynamicBVH::get_area_ratio() const SKR_NOEXCEPT
+{
+    if (root == -1) return 0.f;
+    const float root_area = Area(nodes[root].fat_bounds);
+    if (root_area <= 0.f) return 0.f;
+    float total_area = 0.f;
+    for (const auto& node : nodes)
+    {
+        if (node.height < 0) continue;
+        total_area += Area(node.fat_bounds);
+    }
+    return total_area / root_area;
+}
+
+bool DynamicBVH::validate() const SKR_NOEXCEPT
+{
+    if (root == -1) return proxy_count == 0;
+    if (nodes[root].parent != -1) return false;
+
+    uint32_t leaf_count = 0;
+    skr::vector<int32_t> stack;
+    stack.push_back(root);
+    while (!stack.empty())
+    {
+        const int32_t index = stack.back();
+        stack.pop_back();
+        const auto& node = nodes[index];
+        if (node.is_leaf())
+        {
+            if (node.height != 0 || !Contains(node.fat_bounds, node.bounds)) return false;
+            leaf_count++;
+            continue;
+        }
+        const auto& c1 = nodes[node.child1];
+        const auto& c2 = nodes[node.child2];
+        if (c1.parent != index || c2.parent != index) return false;
+        if (node.height != 1 + std::max(c1.height, c2.height)) return false;
+        if (!Contains(node.fat_bounds, c1.fat_bounds) || !Contains(node.fat_bounds, c2.fat_bounds)) return false;
+        stack.push_back(node.child1);
+        stack.push_back(node.child2);
+    }
+    return leaf_count == proxy_count;
+}
+} // namespace scene
+} // namespace skr
+
+namespace
+{
+using namespace skr::scene;
+
+struct SpatialSystemImpl : public skr_spatial_system_t {
+    struct Proxy {
+        DynamicBVH::ProxyId id;
+        uint32_t frame;
+        skr_float3_t center;
+    };
+
+    SpatialSystemImpl(dual_storage_t* world)
+        : world(world)
+    {
+        query = dualQ_from_literal(world, "[in]skr_spatial_bounds_comp_t,[in]skr_transform_comp_t");
+        resource = dualJ_add_resource();
+        skr_init_rw_mutex(&rw_mutex);
+    }
+
+    ~SpatialSystemImpl() SKR_NOEXCEPT
+    {
+        sync();
+        dualJ_remove_resource(resource);
+        dualQ_release(query);
+        skr_destroy_rw_mutex(&rw_mutex);
+    }
+
+    void update() SKR_NOEXCEPT final override
+    {
+        // the query reads the bounds and the transforms, so the scheduler runs the job after the jobs writing them,
+        // the resource keeps updates in order and lets query jobs depend on them
+        int readonly = 0, atomic = 0;
+        dual_resource_operation_t resources = { &resource, &readonly, &atomic, 1 };
+        auto job = +[](void* u, dual_query_t* query) {
+            static_cast<SpatialSystemImpl*>(u)->refresh();
+        };
+        dualJ_schedule_custom(query, job, this, nullptr, nullptr, &resources, &pending);
+    }
+
+    void sync() SKR_NOEXCEPT final override
+    {
+        if (pending)
+            pending.wait(false);
+    }
+
+    dual_entity_t get_resource() const SKR_NOEXCEPT final override
+    {
+        return resource;
+    }
+
+    // wrap safe, a stamp of the current version is newer than every version seen before
+    bool chunk_written(const dual_chunk_t* chunk) const
+    {
+        return (int32_t)(dualC_get_timestamp(chunk, dual_id_of<skr_transform_comp_t>::get()) - seen_version) > 0 ||
+               (int32_t)(dualC_get_timestamp(chunk, dual_id_of<skr_spatial_bounds_comp_t>::get()) - seen_version) > 0;
+    }
+
+    void refresh_view(dual_chunk_view_t* view)
+    {
+        const auto entities = dualV_get_entities(view);
+        const auto bounds = dual::get_component_ro<skr_spatial_bounds_comp_t>(view);
+        const auto transforms = dual::get_component_ro<skr_transform_comp_t>(view);
+        for (uint32_t i = 0; i < view->count; ++i)
+        {
+            skr_float3_t world_center, world_extents;
+            TransformBounds(transforms[i].value, bounds[i].center, bounds[i].extents, world_center, world_extents);
+            const AABB aabb = {
+                { world_center.x - world_extents.x, world_center.y - world_extents.y, world_center.z - world_extents.z },
+                { world_center.x + world_extents.x, world_center.y + world_extents.y, world_center.z + world_extents.z }
+            };
+
+            auto iter = proxies.find(entities[i]);
+            if (iter == proxies.end())
+            {
+                proxies.emplace(entities[i], Proxy{ bvh.create_proxy(aabb, entities[i]), frame, world_center });
+                continue;
+            }
+            auto& proxy = iter->second;
+            const skr_float3_t displacement = {
+                world_center.x - proxy.center.x,
+                world_center.y - proxy.center.y,
+                world_center.z - proxy.center.z
+            };
+            bvh.move_proxy(proxy.id, aabb, displacement);
+            proxy.frame = frame;
+            proxy.center = world_center;
+        }
+    }
+
+    // only the chunks whose transforms or bounds were written since the last update are visited, writers stamp them
+    // through rw access and moving entities into a chunk stamps it too. the version is advanced afterwards so later
+    // writes are newer than the one seen here. entities that left the query cannot be found that way, when fewer
+    // entities than proxies remain every entity is visited and the proxies not seen are removed
+    void refresh()
+    {
+        ZoneScopedN("SpatialSystemUpdate");
+
+        const auto version = (uint32_t)dualS_get_version(world);
+        skr_rw_mutex_acquire_w(&rw_mutex);
+        frame++;
+        uint64_t count = 0;
+        auto changed = [&](dual_chunk_view_t* view) {
+            count += view->count;
+            if (chunk_written(view->chunk))
+                refresh_view(view);
+        };
+        if (synced)
+            dualQ_get_views(query, DUAL_LAMBDA(changed));
+        if (!synced || count != proxies.size())
+        {
+            frame++;
+            auto all = [&](dual_chunk_view_t* view) {
+                refresh_view(view);
+            };
+            dualQ_get_views(query, DUAL_LAMBDA(all));
+            for (auto iter = proxies.begin(); iter != proxies.end();)
+            {
+                if (iter->second.frame != frame)
+                {
+                    bvh.destroy_proxy(iter->second.id);
+                    proxies.erase(iter++);
+                }
+                else
+                    ++iter;
+            }
+            synced = true;
+        }
+        seen_version = version;
+        dualS_set_version(world, version + 1);
+
+        if (rebuild_leaves_per_update)
+            bvh.rebuild_partial(rebuild_leaves_per_update);
+        skr_rw_mutex_release_w(&rw_mutex);
+    }
+
+    struct ReadLock {
+        ReadLock(SRWMutex* mutex) : mutex(mutex) { skr_rw_mutex_acquire_r(mutex); }
+        ~ReadLock() { skr_rw_mutex_release_r(mutex); }
+        SRWMutex* mutex;
+    };
+
+    void query_aabb(const AABB& aabb, DynamicBVH::Visitor visitor) const SKR_NOEXCEPT final override
+    {
+        ReadLock _(&rw_mutex);
+        bvh.query_aabb(aabb, visitor);
+    }
+
+    void query_sphere(const Sphere& sphere, DynamicBVH::Visitor visitor) const SKR_NOEXCEPT final override
+    {
+        ReadLock _(&rw_mutex);
+        bvh.query_sphere(sphere, visitor);
+    }
+
+    void query_frustum(const Frustum& frustum, DynamicBVH::Visitor visitor) const SKR_NOEXCEPT final override
+    {
+        ReadLock _(&rw_mutex);
+        bvh.query_frustum(frustum, visitor);
+    }
+
+    bool raycast(const Ray& ray, RayHit& hit) const SKR_NOEXCEPT final override
+    {
+        ReadLock _(&rw_mutex);
+        return bvh.raycast(ray, hit);
+    }
+
+    void raycast_batch(skr::span<const Ray> rays, skr::span<RayHit> hits) const SKR_NOEXCEPT final override
+    {
+        ReadLock _(&rw_mutex);
+        bvh.raycast_batch(rays, hits);
+    }
+
+    void query_aabb_batch(skr::span<const AABB> aabbs, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT final override
+    {
+        ReadLock _(&rw_mutex);
+        bvh.query_aabb_batch(aabbs, results);
+    }
+
+    void query_sphere_batch(skr::span<const Sphere> spheres, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT final override
+    {
+        ReadLock _(&rw_mutex);
+        bvh.query_sphere_batch(spheres, results);
+    }
+
+    void query_frustum_batch(skr::span<const Frustum> frustums, skr::span<skr::vector<dual_entity_t>> results) const SKR_NOEXCEPT final override
+    {
+        ReadLock _(&rw_mutex);
+        bvh.query_frustum_batch(frustums, results);
+    }
+
+    dual_storage_t* world = nullptr;
+    dual_query_t* query = nullptr;
+    dual_entity_t resource;
+    skr::task::event_t pending = nullptr;
+    DynamicBVH bvh;
+    skr::flat_hash_map<dual_entity_t, Proxy> proxies;
+    uint32_t frame = 0;
+    uint32_t seen_version = 0;
+    bool synced = false;
+    mutable SRWMutex rw_mutex;
+};
+} // namespace
+
+skr_spatial_system_t::~skr_spatial_system_t() SKR_NOEXCEPT
+{
+}
+
+skr_spatial_system_t* skr_spatial_system_t::Create(dual_storage_t* world)
+{
+    return SkrNew<SpatialSystemImpl>(world);
+}
+
+void skr_spatial_system_t::Free(skr_spatial_system_t* system)
+{
+    SkrDelete(system);
+}
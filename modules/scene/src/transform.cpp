@@ -4,11 +4,14 @@
 #include "SkrRT/ecs/dual_config.h"
 #include "SkrRT/misc/parallel_for.hpp"
 #include "SkrScene/scene.h"
+#include "SkrScene/spatial.h"
 #include "SkrRT/math/matrix4x4f.h"
 #include "SkrRT/math/vector.h"
 #include "SkrRT/math/quat.h"
 #include "SkrRT/math/rtm/qvvf.h"
 
+#include <string.h>
+
 rtm::qvvf make_qvv(skr_rotator_t* r, skr_float3_t* t, skr_float3_t* s)
 {
     const auto default_translation = rtm::vector_set(0.f, 0.f, 0.f);
@@ -32,12 +35,21 @@ rtm::qvvf make_qvv(skr_rotator_t* r, skr_float3_t* t, skr_float3_t* s)
         return rtm::qvv_set(default_quat, default_translation, default_scale);
 }
 
+// chunks are only taken for write when a transform changed, the write stamps them for change detection (see skr_spatial_system_t)
+static bool same_transform(const skr_transform_t& a, const skr_transform_t& b)
+{
+    return !memcmp(&a.translation, &b.translation, sizeof(a.translation)) &&
+           !memcmp(&a.rotation, &b.rotation, sizeof(a.rotation)) &&
+           !memcmp(&a.scale, &b.scale, sizeof(a.scale));
+}
+
 static void skr_relative_to_world_children(skr_children_t* children, rtm::qvvf parent, dual_storage_t* storage)
 {
     auto process = [&](dual_chunk_view_t* view) {
-        auto transforms = (skr_transform_t*)dualV_get_owned_ro(view, dual_id_of<skr_transform_comp_t>::get());
+        auto transforms = (const skr_transform_t*)dualV_get_owned_ro(view, dual_id_of<skr_transform_comp_t>::get());
         if (!transforms) 
             return;
+        skr_transform_t* written = nullptr;
         auto translations = (skr_float3_t*)dualV_get_owned_ro(view, dual_id_of<skr_translation_comp_t>::get());
         auto rotations = (skr_rotator_t*)dualV_get_owned_ro(view, dual_id_of<skr_rotation_comp_t>::get());
         auto scales = (skr_float3_t*)dualV_get_owned_ro(view, dual_id_of<skr_scale_comp_t>::get());
@@ -46,9 +58,16 @@ static void skr_relative_to_world_children(skr_children_t* children, rtm::qvvf p
         {
             auto relative = make_qvv(rotations ? &rotations[i] : nullptr, translations ? &translations[i] : nullptr, scales ? &scales[i] : nullptr);
             auto transform = rtm::qvv_mul(relative, parent);
-            skr::math::store(transform.translation, transforms[i].translation);
-            skr::math::store(transform.rotation, transforms[i].rotation);
-            skr::math::store(transform.scale, transforms[i].scale);
+            skr_transform_t world;
+            skr::math::store(transform.translation, world.translation);
+            skr::math::store(transform.rotation, world.rotation);
+            skr::math::store(transform.scale, world.scale);
+            if (!same_transform(transforms[i], world))
+            {
+                if (!written)
+                    written = (skr_transform_t*)dualV_get_owned_rw(view, dual_id_of<skr_transform_comp_t>::get());
+                written[i] = world;
+            }
             if (!childrens) 
                 continue;
             skr_relative_to_world_children(children, transform, storage);
@@ -71,16 +90,23 @@ static void skr_relative_to_world_children(skr_children_t* children, rtm::qvvf p
 static void skr_relative_to_world_root(void* u, dual_query_t* query, dual_chunk_view_t* view, dual_type_index_t* localTypes, EIndex entityIndex)
 {
     using namespace skr::math;
-    auto transforms = (skr_transform_t*)dualV_get_owned_ro_local(view, localTypes[0]);
+    auto transforms = (const skr_transform_t*)dualV_get_owned_ro_local(view, localTypes[0]);
+    skr_transform_t* written = nullptr;
     auto children = (skr_children_t*)dualV_get_owned_ro_local(view, localTypes[1]);
     auto translations = (skr_float3_t*)dualV_get_owned_ro_local(view, localTypes[2]);
     auto rotations = (skr_rotator_t*)dualV_get_owned_ro_local(view, localTypes[3]);
     auto scales = (skr_float3_t*)dualV_get_owned_ro_local(view, localTypes[4]);
     for(EIndex i = 0; i < view->count; ++i)
     {
-        transforms[i].translation = translations ? translations[i] : skr_float3_t{0,0,0};
-        transforms[i].rotation = rotations ? rotations[i] : skr_rotator_t{0,0,0};
-        transforms[i].scale = scales ? scales[i] : skr_float3_t{1,1,1};
+        skr_transform_t relative;
+        relative.translation = translations ? translations[i] : skr_float3_t{0,0,0};
+        relative.rotation = rotations ? rotations[i] : skr_rotator_t{0,0,0};
+        relative.scale = scales ? scales[i] : skr_float3_t{1,1,1};
+        if (same_transform(transforms[i], relative))
+            continue;
+        if (!written)
+            written = (skr_transform_t*)dualV_get_owned_rw_local(view, localTypes[0]);
+        written[i] = relative;
     }
     auto storage = dualQ_get_storage(query);
     forloop (i, 0, view->count)
@@ -94,9 +120,22 @@ void skr_transform_setup(dual_storage_t* world, skr_transform_system_t* system)
 {
     // then recursively calculate local to world for node entities
     system->relativeToWorld = dualQ_from_literal(world, "[inout]<seq>skr_transform_comp_t,[in]<seq>skr_child_comp_t,!skr_parent_comp_t,[in]<seq>?skr_translation_comp_t,[in]<seq>?skr_rotation_comp_t,[in]<seq>?skr_scale_comp_t");
+    system->spatial = skr_spatial_system_t::Create(world);
 }
 
 void skr_transform_update(skr_transform_system_t* query)
 {
     dualJ_schedule_ecs(query->relativeToWorld, 128, &skr_relative_to_world_root, nullptr, nullptr, nullptr, nullptr, nullptr);
+    if (query->spatial)
+        query->spatial->update();
+}
+
+void skr_transform_release(skr_transform_system_t* system)
+{
+    if (system->spatial)
+        skr_spatial_system_t::Free(system->spatial);
+    system->spatial = nullptr;
+    if (system->relativeToWorld)
+        dualQ_release(system->relativeToWorld);
+    system->relativeToWorld = nullptr;
 }
@@ -123,7 +123,19 @@ void SGameModule::installResourceFactories()
     ram_service = skr_io_ram_service_t::create(&ioServiceDesc);
     ram_service->run();
 
-    registry = SkrNew<skr::resource::SLocalResourceRegistry>(resource_vfs);
+    registry = SkrNew<skr::resource::SLocalResourceRegistry>(resource_vfs, ram_service);
+    // bundles packed by the resource compiler (-b) are read in place of the loose .bin files they hold
+    skr::filesystem::directory_iterator bundleIter(resourceRoot, ec);
+    while (bundleIter != end(bundleIter))
+    {
+        const auto& path = bundleIter->path();
+        if (bundleIter->is_regular_file(ec) && path.extension() == ".idx" && path.stem().extension() == ".bundle")
+        {
+            const auto indexUri = path.filename().u8string();
+            registry->LoadBundleIndex(indexUri.c_str());
+        }
+        bundleIter.increment(ec);
+    }
     skr::resource::GetResourceSystem()->Initialize(registry, ram_service);
     //
 
@@ -185,6 +185,24 @@ void RenderPassForward::execute(const skr_primitive_pass_context_t* context, skr
                 .as_uniform_buffer();
         });
 
+    // 2.1 instance payloads of the merged draws, read as an instance rate vertex stream
+    const auto instance_data = context->instance_data;
+    const auto instance_data_size = context->instance_data_size;
+    skr::render_graph::BufferHandle instance_buffer;
+    if (instance_data_size)
+    {
+        instance_buffer = renderGraph->create_buffer(
+            [=](skr::render_graph::RenderGraph& g, skr::render_graph::BufferBuilder& builder) {
+                builder.set_name(SKR_UTF8("forward_instance_buffer"))
+                    .size(instance_data_size)
+                    .memory_usage(CGPU_MEM_USAGE_CPU_TO_GPU)
+                    .with_flags(CGPU_BCF_PERSISTENT_MAP_BIT)
+                    .with_tags(kRenderGraphDynamicResourceTag)
+                    .prefer_on_device()
+                    .as_vertex_buffer();
+            });
+    }
+
     // 3.barrier skin vbs
     renderGraph->add_copy_pass(
         [=](skr::render_graph::RenderGraph& g, skr::render_graph::CopyPassBuilder& builder) {
@@ -244,6 +262,8 @@ void RenderPassForward::execute(const skr_primitive_pass_context_t* context, skr
                 // we know that the drawcalls always have a same pipeline
                 .read(SKR_UTF8("pass_cb"), cbuffer.range(0, sizeof(skr_float4x4_t)))
                 .write(0, out_color, need_clear ? CGPU_LOAD_ACTION_CLEAR : CGPU_LOAD_ACTION_LOAD);
+            if (instance_data_size)
+                builder.use_buffer(instance_buffer, CGPU_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
             if (need_clear)
                 builder.set_depth_stencil(depth_buffer.clear_depth(1.f));
             else
@@ -254,6 +274,13 @@ void RenderPassForward::execute(const skr_primitive_pass_context_t* context, skr
             auto cb = pass_context.resolve(cbuffer);
             SKR_ASSERT(cb && "cbuffer not found");
             ::memcpy(cb->info->cpu_mapped_address, &viewport->view_projection, sizeof(viewport->view_projection));
+            CGPUBufferId instances = nullptr;
+            if (instance_data_size)
+            {
+                instances = pass_context.resolve(instance_buffer);
+                SKR_ASSERT(instances && "instance buffer not found");
+                ::memcpy(instances->info->cpu_mapped_address, instance_data, instance_data_size);
+            }
             cgpu_render_encoder_set_viewport(pass_context.encoder,
                 0.0f, 0.0f,
                 (float)viewport->viewport_width, (float)viewport->viewport_height,
@@ -311,11 +338,21 @@ void RenderPassForward::execute(const skr_primitive_pass_context_t* context, skr
                     {
                         if (strides[i] == 0) offsets[i] = 0;
                     }
-                    cgpu_render_encoder_bind_vertex_buffers(pass_context.encoder, dc.vertex_buffer_count, vertex_buffers, strides, offsets);
+                    uint32_t vertex_buffer_count = dc.vertex_buffer_count;
+                    if (dc.instance_count)
+                    {
+                        vertex_buffers[vertex_buffer_count] = instances;
+                        strides[vertex_buffer_count] = dc.instance_stride;
+                        offsets[vertex_buffer_count] = dc.instance_offset;
+                        vertex_buffer_count++;
+                    }
+                    cgpu_render_encoder_bind_vertex_buffers(pass_context.encoder, vertex_buffer_count, vertex_buffers, strides, offsets);
                 }
-                cgpu_render_encoder_push_constants(pass_context.encoder, dc.pipeline->root_signature, dc.push_const_name, dc.push_const);
+                if (dc.push_const)
+                    cgpu_render_encoder_push_constants(pass_context.encoder, dc.pipeline->root_signature, dc.push_const_name, dc.push_const);
                 cgpu_render_encoder_set_shading_rate(pass_context.encoder, shading_rate, CGPU_SHADING_RATE_COMBINER_PASSTHROUGH, CGPU_SHADING_RATE_COMBINER_PASSTHROUGH);
-                cgpu_render_encoder_draw_indexed_instanced(pass_context.encoder, dc.index_buffer.index_count, dc.index_buffer.first_index, 1, 0, 0);
+                const uint32_t instance_count = dc.instance_count ? dc.instance_count : 1;
+                cgpu_render_encoder_draw_indexed_instanced(pass_context.encoder, dc.index_buffer.index_count, dc.index_buffer.first_index, instance_count, 0, 0);
             }
             }
     });
@@ -23,6 +23,7 @@
 #include "SkrRenderer/resources/texture_resource.h"
 #include "SkrRenderer/render_mesh.h"
 #include "SkrRenderer/render_group.h"
+#include "SkrRenderer/render_culling.h"
 #include "SkrAnim/components/skin_component.h"
 #include "SkrAnim/components/skeleton_component.h"
 
@@ -57,6 +58,7 @@ void RenderEffectForward::on_register(SRendererId renderer, dual_storage_t* stor
         type_builder.with(identity_type);
         type_builder.with<skr_render_mesh_comp_t>();
         type_builder.with<skr_render_group_t>();
+        type_builder.with<skr_render_bounds_comp_t>();
         typeset = type_builder.build();
     }
     initialize_queries(storage);
@@ -71,6 +73,7 @@ void RenderEffectForward::initialize_queries(dual_storage_t* storage)
     mesh_query = dualQ_from_literal(storage, "[in]forward_render_identity, [in]skr_render_mesh_comp_t");
     mesh_write_query = dualQ_from_literal(storage, "[inout]skr_render_mesh_comp_t");
     draw_mesh_query = dualQ_from_literal(storage, "[in]forward_render_identity, [in]skr_render_mesh_comp_t, [out]skr_render_group_t");
+    bounds_query = dualQ_from_literal(storage, "[in]forward_render_identity, [in]skr_render_mesh_comp_t, [out]skr_render_bounds_comp_t");
 }
 
 void RenderEffectForward::release_queries()
@@ -78,6 +81,7 @@ void RenderEffectForward::release_queries()
     dualQ_release(mesh_query);
     dualQ_release(mesh_write_query);
     dualQ_release(draw_mesh_query);
+    dualQ_release(bounds_query);
 }
 
 void RenderEffectForward::on_unregister(SRendererId renderer, dual_storage_t* storage)
@@ -127,6 +131,34 @@ void RenderEffectForward::initialize_data(SRendererId renderer, dual_storage_t*
     }
 }
 
+void RenderEffectForward::on_update(const skr_primitive_update_context_t* context)
+{
+    if (!bounds_query) return;
+    // world bounds for the renderer's culling, which runs right after every effect updated
+    auto boundsF = [&](dual_chunk_view_t* r_cv) {
+        auto identities = (forward_effect_identity_t*)dualV_get_owned_ro(r_cv, identity_type);
+        skr_render_bounds_update(context->storage, r_cv, (const dual_entity_t*)identities);
+    };
+    dualQ_get_views(bounds_query, DUAL_LAMBDA(boundsF));
+}
+
+void RenderEffectForward::set_draw_constants(skr_primitive_draw_t& drawcall, const PushConstants& push_const)
+{
+    if (drawcall.pipeline == pipeline)
+    {
+        // the default pipeline is instanced: identical draws are merged by the renderer,
+        // it reads the first streams of the mesh and the model matrix from the instance stream after them
+        drawcall.instance_data = (const uint8_t*)(&push_const.model);
+        drawcall.instance_stride = sizeof(push_const.model);
+        drawcall.vertex_buffer_count = eastl::min(drawcall.vertex_buffer_count, kInstancedVertexStreamCount);
+    }
+    else
+    {
+        drawcall.push_const_name = push_constants_name;
+        drawcall.push_const = (const uint8_t*)(&push_const);
+    }
+}
+
 skr_primitive_draw_packet_t RenderEffectForward::produce_draw_packets(const skr_primitive_draw_context_t* context)
 {
     auto pass = context->pass;
@@ -170,7 +202,7 @@ skr_primitive_draw_packet_t RenderEffectForward::produce_draw_packets(const skr_
     push_constants.reserve(primitiveCount);
     mesh_drawcalls.reserve(primitiveCount);
 
-    // 3. fill draw packets
+    // 3. fill draw packets for entities that survived culling against the main viewport
     auto r_effect_callback = [&](dual_chunk_view_t* r_cv) {
         uint32_t r_idx = 0;
         uint32_t dc_idx = 0;
@@ -288,11 +320,10 @@ skr_primitive_draw_packet_t RenderEffectForward::produce_draw_packets(const skr_
                             auto& drawcall = mesh_drawcalls.emplace_back();
                             drawcall.pipeline = proper_pipeline;
                             drawcall.bind_table = proper_bind_table;
-                            drawcall.push_const_name = push_constants_name;
-                            drawcall.push_const = (const uint8_t*)(&push_const);
                             drawcall.index_buffer = *cmd.ibv;
                             drawcall.vertex_buffers = anims[r_idx].primitives[i].views.data();
                             drawcall.vertex_buffer_count = (uint32_t)anims[r_idx].primitives[i].views.size();
+                            set_draw_constants(drawcall, push_const);
                             dc_idx++;
                         }
                     }
@@ -316,11 +347,10 @@ skr_primitive_draw_packet_t RenderEffectForward::produce_draw_packets(const skr_
                             auto& drawcall = mesh_drawcalls.emplace_back();
                             drawcall.pipeline = proper_pipeline;
                             drawcall.bind_table = proper_bind_table;
-                            drawcall.push_const_name = push_constants_name;
-                            drawcall.push_const = (const uint8_t*)(&push_const);
                             drawcall.index_buffer = *cmd.ibv;
                             drawcall.vertex_buffers = cmd.vbvs.data();
                             drawcall.vertex_buffer_count = (uint32_t)cmd.vbvs.size();
+                            set_draw_constants(drawcall, push_const);
                             dc_idx++;
                         }
                     }
@@ -331,11 +361,10 @@ skr_primitive_draw_packet_t RenderEffectForward::produce_draw_packets(const skr_
                     push_const.model = model_matrix;
                     auto& drawcall = mesh_drawcalls.emplace_back();
                     drawcall.pipeline = pipeline;
-                    drawcall.push_const_name = push_constants_name;
-                    drawcall.push_const = (const uint8_t*)(&push_const);
                     drawcall.index_buffer = ibv;
                     drawcall.vertex_buffers = vbvs;
                     drawcall.vertex_buffer_count = 5;
+                    set_draw_constants(drawcall, push_const);
                     dc_idx++;
                 }
             }
@@ -343,7 +372,15 @@ skr_primitive_draw_packet_t RenderEffectForward::produce_draw_packets(const skr_
         };
         dualS_batch(storage, unbatched_g_ents, r_cv->count, DUAL_LAMBDA(gBatchCallback));
     };
-    dualQ_get_views(draw_mesh_query, DUAL_LAMBDA(r_effect_callback));
+    if (bounds_query)
+    {
+        const auto visible_entities = context->renderer->get_render_culling()->get_visible_entities(0u);
+        dualS_batch(storage, visible_entities.data(), (EIndex)visible_entities.size(), DUAL_LAMBDA(r_effect_callback));
+    }
+    else
+    {
+        dualQ_get_views(draw_mesh_query, DUAL_LAMBDA(r_effect_callback));
+    }
 
     // 4. return packet info
     mesh_draw_list.drawcalls = mesh_drawcalls.data();
@@ -466,7 +503,7 @@ void RenderEffectForward::prepare_pipeline(SRendererId renderer)
     const auto backend = device->adapter->instance->backend;
 
     // read shaders
-    skr::string vsname = u8"shaders/Game/gbuffer_vs";
+    skr::string vsname = u8"shaders/Game/gbuffer_instanced_vs";
     vsname.append(backend == ::CGPU_BACKEND_D3D12 ? u8".dxil" : u8".spv");
     auto vsfile = skr_vfs_fopen(resource_vfs, vsname.u8_str(), SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
     uint32_t _vs_length = (uint32_t)skr_vfs_fsize(vsfile);
@@ -509,8 +546,6 @@ void RenderEffectForward::prepare_pipeline(SRendererId renderer)
     ps.entry = u8"main";
 
     auto rs_desc = make_zeroed<CGPURootSignatureDescriptor>();
-    rs_desc.push_constant_count = 1;
-    rs_desc.push_constant_names = &push_constants_name;
     rs_desc.shader_count = 2;
     rs_desc.shaders = ppl_shaders;
     rs_desc.pool = render_device->get_root_signature_pool();
@@ -521,8 +556,8 @@ void RenderEffectForward::prepare_pipeline(SRendererId renderer)
     vertex_layout.attributes[1] = { u8"TEXCOORD", 1, CGPU_FORMAT_R32G32_SFLOAT, 1, 0, sizeof(skr_float2_t), CGPU_INPUT_RATE_VERTEX };
     vertex_layout.attributes[2] = { u8"TEXCOORD", 1, CGPU_FORMAT_R32G32_SFLOAT, 2, 0, sizeof(skr_float2_t), CGPU_INPUT_RATE_VERTEX };
     vertex_layout.attributes[3] = { u8"NORMAL", 1, CGPU_FORMAT_R32G32B32_SFLOAT, 3, 0, sizeof(skr_float3_t), CGPU_INPUT_RATE_VERTEX };
-    vertex_layout.attributes[4] = { u8"TANGENT", 1, CGPU_FORMAT_R32G32B32A32_SFLOAT, 4, 0, sizeof(skr_float4_t), CGPU_INPUT_RATE_VERTEX };
-    vertex_layout.attribute_count = 4;
+    vertex_layout.attributes[4] = { u8"MODEL", 4, CGPU_FORMAT_R32G32B32A32_SFLOAT, kInstancedVertexStreamCount, 0, sizeof(skr_float4x4_t), CGPU_INPUT_RATE_INSTANCE };
+    vertex_layout.attribute_count = 5;
 
     const auto fmt = CGPU_FORMAT_B8G8R8A8_UNORM;
     auto rp_desc = make_zeroed<CGPURenderPipelineDescriptor>();
@@ -596,6 +631,7 @@ void RenderEffectForwardSkin::initialize_queries(dual_storage_t* storage)
     mesh_write_query = dualQ_from_literal(storage, "[inout]forward_skin_render_identity, [inout]skr_render_mesh_comp_t");
     draw_mesh_query = dualQ_from_literal(storage, "[in]forward_skin_render_identity, [in]skr_render_mesh_comp_t, [out]skr_render_group_t");
     install_query = dualQ_from_literal(storage, "[in]forward_skin_render_identity, [in]skr_render_anim_comp_t, [in]skr_render_skel_comp_t, [in]skr_render_skin_comp_t");
+    // no bounds query: bind pose bounds do not cover animated skins, so they are never culled
 }
 
 void RenderEffectForwardSkin::release_queries()
@@ -23,6 +23,7 @@ struct RenderEffectForward : public IRenderEffectProcessor
     dual_type_index_t get_identity_type() override;
     void initialize_data(SRendererId renderer, dual_storage_t* storage, dual_chunk_view_t* game_cv, dual_chunk_view_t* render_cv) override;
     skr_primitive_draw_packet_t produce_draw_packets(const skr_primitive_draw_context_t* context) override;
+    void on_update(const skr_primitive_update_context_t* context) override;
 
 protected:
     void initialize_queries(dual_storage_t* storage);
@@ -44,6 +45,8 @@ protected:
     
 protected:
     // render resources
+    // streams read by the instanced default pipeline, its instance stream is bound right after them
+    static constexpr uint32_t kInstancedVertexStreamCount = 4;
     skr_vertex_buffer_view_t vbvs[5];
     skr_index_buffer_view_t ibv;
     CGPUBufferId vertex_buffer;
@@ -56,10 +59,13 @@ protected:
     dual_query_t* mesh_write_query = nullptr;
     dual_query_t* draw_mesh_query = nullptr;
     dual_query_t* draw_skin_query = nullptr;
+    dual_query_t* bounds_query = nullptr;
     dual_type_index_t identity_type = {};
     struct PushConstants {
         skr_float4x4_t model;
     };
+    // material pipelines take the model matrix as push constants, the default pipeline as instance data
+    void set_draw_constants(skr_primitive_draw_t& drawcall, const PushConstants& push_const);
     eastl::vector<PushConstants> push_constants;
     eastl::vector<skr_float4x4_t> model_matrices;
 };
\ No newline at end of file
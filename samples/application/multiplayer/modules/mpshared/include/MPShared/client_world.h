@@ -2,6 +2,7 @@
 #pragma once
 #include "steam/steamnetworkingtypes.h"
 #include "SkrRT/platform/time.h"
+#include "SkrRT/containers/sptr.hpp"
 #include "MPShared/shared.h"
 #include "MPShared/world_delta.h"
 
@@ -12,6 +13,24 @@ struct Prefab
 };
 
 constexpr static size_t MaxPredictFrame = 512;
+constexpr static size_t MaxSnapshotFrame = 8;
+
+// copy of the predicted components of one chunk, shared between snapshots while the chunk is untouched
+struct MPChunkSnapshot
+{
+    skr::vector<dual_entity_t> entities;
+    skr::vector<dual_type_index_t> types;
+    skr::vector<uint32_t> timestamps;
+    skr::vector<uint32_t> offsets;
+    skr::vector<uint8_t> data;
+};
+
+struct MPWorldSnapshot
+{
+    uint64_t frame = UINT64_MAX;
+    skr::flat_hash_map<dual_chunk_t*, skr::SPtr<MPChunkSnapshot>> chunks;
+};
+
 struct MP_SHARED_API MPClientWorld : MPGameWorld
 {
     MPClientWorld();
@@ -23,7 +42,11 @@ struct MP_SHARED_API MPClientWorld : MPGameWorld
     uint64_t inputFrame;
     MPInputFrame predictedInputs[MaxPredictFrame];
     MPInputFrame input;
-    dual_storage_t* snapshotStorage;
+    MPWorldSnapshot snapshots[MaxSnapshotFrame];
+    uint32_t snapshotHead = 0;
+    uint32_t snapshotCount = 0;
+    uint64_t snapshotVersion = 0;
+    skr::vector<dual_entity_t> rolledBackEntities;
     dual_query_t* snapshotQuery;
     dual_query_t* healthQuery;
     IWorldDeltaApplier* worldDeltaApplier;
@@ -47,7 +70,10 @@ struct MP_SHARED_API MPClientWorld : MPGameWorld
     bool Update();
     void Shutdown() override;
     void Snapshot();
+    const MPWorldSnapshot* FindSnapshot(uint64_t frame) const;
     void RollBack();
+    void RollBack(const MPWorldSnapshot& snapshot);
+    const skr::vector<dual_entity_t>& GetRolledBackEntities() const { return rolledBackEntities; }
     void RollForward();
     void SkipFrame();
     void SetPredictionEnabled(bool enabled);
@@ -23,7 +23,6 @@ void MPClientWorld::Initialize()
 {
     MPGameWorld::Initialize();
     dualJ_bind_storage(storage);
-    snapshotStorage = nullptr;
     skr_init_hires_timer(&timer);
     input.inputs.resize(1);
     lastTime = predictedGameTime = skr_hires_timer_get_seconds(&timer, false);
@@ -46,10 +45,9 @@ void MPClientWorld::Initialize()
 void MPClientWorld::Shutdown()
 {
     dualQ_release(snapshotQuery);
-    if (snapshotStorage)
-    {
-        dualS_release(snapshotStorage); 
-    }
+    for(auto& snapshot : snapshots)
+        snapshot = MPWorldSnapshot{};
+    snapshotCount = 0;
     dualJ_unbind_storage(storage);
     MPGameWorld::Shutdown();
 }
@@ -163,35 +161,6 @@ void MPClientWorld::SendInput()
     SteamNetworkingSockets()->SendMessageToConnection(serverConnection, buffer.data(), buffer.size(), k_nSteamNetworkingSend_Reliable, nullptr);
 }
 
-skr::vector<dual_chunk_view_t> merge_views(skr::vector<dual_chunk_view_t>& views)
-{
-    skr::vector<dual_chunk_view_t> merged;
-    std::sort(views.begin(), views.end(), [](const dual_chunk_view_t& lhs, const dual_chunk_view_t& rhs)
-    {
-        return lhs.start < rhs.start;
-    });
-    for(auto view : views)
-    {
-        if(merged.empty())
-        {
-            merged.push_back(view);
-        }
-        else 
-        {
-            auto& curr = merged.back();
-            if(view.start < curr.start + curr.count)
-            {
-                curr.count = std::max(curr.count, view.start+view.count-curr.start);
-            }
-            else 
-            {
-                merged.push_back(view);
-            }
-        }
-    }
-    return merged;
-}
-
 void SnapshotComponent(void* dst, const void* src, dual_type_index_t type, uint32_t count)
 {
     //TODO: handle reference
@@ -206,18 +175,103 @@ void ApplyComponent(void* dst, const void* src, dual_type_index_t type, uint32_t
     memcpy(dst, src, desc->size * count);
 }
 
+// true if the recorded entities still live in the recorded chunk at the recorded rows
+static bool SameEntities(dual_storage_t* storage, const MPChunkSnapshot& record, dual_chunk_t* chunk)
+{
+    if(record.entities.empty())
+        return false;
+    //the chunk may have been released since the record was taken, check it through the entity first
+    dual_chunk_view_t first;
+    dualS_access(storage, record.entities[0], &first);
+    if(first.chunk != chunk || first.start != 0)
+        return false;
+    auto count = dualC_get_count(chunk);
+    if(count != record.entities.size())
+        return false;
+    dual_chunk_view_t view = {chunk, 0, count};
+    return std::memcmp(dualV_get_entities(&view), record.entities.data(), sizeof(dual_entity_t) * count) == 0;
+}
+
+// true if some predicted component of the chunk was written since the record was taken
+static bool ChunkWritten(const MPChunkSnapshot& record, dual_chunk_t* chunk)
+{
+    for(size_t i=0; i<record.types.size(); ++i)
+    {
+        if(dualC_get_timestamp(chunk, record.types[i]) != record.timestamps[i])
+            return true;
+    }
+    return false;
+}
+
+static void CaptureChunk(MPChunkSnapshot& record, dual_chunk_t* chunk, const dual_type_set_t& types)
+{
+    auto count = dualC_get_count(chunk);
+    dual_chunk_view_t view = {chunk, 0, count};
+    const dual_entity_t* entities = dualV_get_entities(&view);
+    record.entities.assign(entities, entities + count);
+    record.types.assign(types.data, types.data + types.length);
+    record.timestamps.resize(types.length);
+    record.offsets.resize(types.length);
+    size_t size = 0;
+    for(int i=0; i<types.length; ++i)
+    {
+        record.timestamps[i] = dualC_get_timestamp(chunk, types.data[i]);
+        record.offsets[i] = (uint32_t)size;
+        size += dualT_get_desc(types.data[i])->size * count;
+    }
+    record.data.resize(size);
+    for(int i=0; i<types.length; ++i)
+    {
+        const void* src = dualV_get_owned_ro(&view, types.data[i]);
+        if(src)
+            SnapshotComponent(record.data.data() + record.offsets[i], src, types.data[i], count);
+    }
+}
+
+// restore the rows of dview whose predicted components diverged from the record, starting at row first of the record
+static void RestoreRows(const MPChunkSnapshot& record, uint32_t first, dual_chunk_view_t* dview, skr::vector<dual_entity_t>& restored)
+{
+    const dual_entity_t* entities = dualV_get_entities(dview);
+    for(uint32_t r=0; r<dview->count; ++r)
+    {
+        bool diverged = false;
+        for(size_t k=0; k<record.types.size() && !diverged; ++k)
+        {
+            auto type = record.types[k];
+            auto size = dualT_get_desc(type)->size;
+            auto current = (const uint8_t*)dualV_get_owned_ro(dview, type);
+            if(!current)
+                continue;
+            auto src = record.data.data() + record.offsets[k] + size * (first + r);
+            diverged = std::memcmp(current + size * r, src, size) != 0;
+        }
+        if(!diverged)
+            continue;
+        dual_chunk_view_t row = {dview->chunk, dview->start + r, 1};
+        for(size_t k=0; k<record.types.size(); ++k)
+        {
+            auto type = record.types[k];
+            auto dst = dualV_get_owned_rw(&row, type);
+            if(!dst)
+                continue;
+            auto src = record.data.data() + record.offsets[k] + dualT_get_desc(type)->size * (first + r);
+            ApplyComponent(dst, src, type, 1);
+        }
+        restored.push_back(entities[r]);
+    }
+}
+
 void MPClientWorld::Snapshot()
 {
     ZoneScopedN("MPClientWorld::Snapshot");
-    if(snapshotStorage)
-        dualS_reset(snapshotStorage);
-    else
-        snapshotStorage = dualS_create();
+    //only chunks written since the previous snapshot are copied, the others share the previous record
+    const MPWorldSnapshot* base = snapshotCount ? &snapshots[snapshotHead] : nullptr;
+    MPWorldSnapshot next;
+    next.frame = verifiedFrame;
     //find out datas needed to snapshot by scan all gameplay related query
-    //then create a snapshot entity to store those data
     auto callback = [&](dual_group_t* group) 
     {
-        skr::flat_hash_map<dual_chunk_t*, skr::vector<dual_chunk_view_t>> views;
+        skr::flat_hash_set<dual_chunk_t*> chunks;
         dual::type_builder_t predictedBuilder;
         for(auto query : {movementQuery.query, controlQuery.query})
         {
@@ -225,8 +279,7 @@ void MPClientWorld::Snapshot()
             auto callback = [&](dual_chunk_view_t* view)
             {
                 match = true;
-                //match end point
-                views[view->chunk].push_back(*view);
+                chunks.insert(view->chunk);
             };
             dualQ_get_views_group(query, group, DUAL_LAMBDA(callback));
             
@@ -242,6 +295,8 @@ void MPClientWorld::Snapshot()
                 }
             }
         }
+        if(chunks.empty())
+            return;
         auto predictedType = predictedBuilder.build();
         
         dual_entity_type_t entType;
@@ -249,72 +304,83 @@ void MPClientWorld::Snapshot()
         std::vector<dual_type_index_t> buffer;
         buffer.resize(std::max(predictedType.length, entType.type.length));
         auto predictedInView = dual::set_utils<dual_type_index_t>::intersect(entType.type, predictedType, buffer.data());
-        dual::type_builder_t builder;
-        builder.with(predictedInView.data, predictedInView.length);
-        builder.with<CSnapshot>();
-        auto snapshotType = make_zeroed<dual_entity_type_t>();
-        snapshotType.type = builder.build();
 
-        for(auto& pair : views)
+        for(auto chunk : chunks)
         {
-            skr::vector<dual_chunk_view_t> merged = merge_views(pair.second);
-            
-            for(auto view : merged)
+            if(base)
             {
-                auto callback = [&](dual_chunk_view_t* sview)
+                auto iter = base->chunks.find(chunk);
+                if(iter != base->chunks.end())
                 {
-                    for(int i=0; i<predictedInView.length; ++i)
+                    auto& record = *iter->second;
+                    bool sameTypes = record.types.size() == predictedInView.length &&
+                        std::equal(record.types.begin(), record.types.end(), predictedInView.data);
+                    if(sameTypes && SameEntities(storage, record, chunk) && !ChunkWritten(record, chunk))
                     {
-                        auto type = predictedInView.data[i];
-                        void* dst = (void*)dualV_get_owned_ro(sview, type);
-                        const void* src = dualV_get_owned_ro(&view, type);
-                        SnapshotComponent(dst, src, type, sview->count);
+                        next.chunks.emplace(chunk, iter->second);
+                        continue;
                     }
-                    auto owners = dualV_get_owned_ro(sview, dual_id_of<CSnapshot>::get());
-                    const dual_entity_t* entities = dualV_get_entities(&view);
-                    std::memcpy((void*)owners, entities, sizeof(dual_entity_t) * sview->count);
-                    view.start += sview->count;
-                    view.count -= sview->count;
-                };
-                dualS_allocate_type(snapshotStorage, &snapshotType, view.count, DUAL_LAMBDA(callback));
+                }
             }
+            auto record = skr::SPtr<MPChunkSnapshot>::Create();
+            CaptureChunk(*record, chunk, predictedInView);
+            next.chunks.emplace(chunk, std::move(record));
         }
     };
     dualQ_get_groups(snapshotQuery, DUAL_LAMBDA(callback));
+    snapshotHead = snapshotCount ? (snapshotHead + 1) % MaxSnapshotFrame : 0;
+    snapshotCount = std::min<uint32_t>(snapshotCount + 1, MaxSnapshotFrame);
+    snapshots[snapshotHead] = std::move(next);
+    //writes after this point carry a newer version than any recorded timestamp, advanced from the storage as the spatial system bumps it too
+    snapshotVersion = dualS_get_version(storage) + 1;
+    dualS_set_version(storage, snapshotVersion);
+}
+
+const MPWorldSnapshot* MPClientWorld::FindSnapshot(uint64_t frame) const
+{
+    for(uint32_t i=0; i<snapshotCount; ++i)
+    {
+        auto& snapshot = snapshots[(snapshotHead + MaxSnapshotFrame - i) % MaxSnapshotFrame];
+        if(snapshot.frame == frame)
+            return &snapshot;
+    }
+    return nullptr;
 }
 
 void MPClientWorld::RollBack()
+{
+    if(snapshotCount)
+        RollBack(snapshots[snapshotHead]);
+}
+
+void MPClientWorld::RollBack(const MPWorldSnapshot& snapshot)
 {
     ZoneScopedN("MPClientWorld::RollBack");
-    if(snapshotStorage)
+    rolledBackEntities.clear();
+    for(auto& pair : snapshot.chunks)
     {
-        dual_type_index_t snapshotT = dual_id_of<CSnapshot>::get();
-        dual_filter_t filter = make_zeroed<dual_filter_t>();
-        filter.all.data = &snapshotT;
-        filter.all.length = 1;
-        dual_meta_filter_t meta = make_zeroed<dual_meta_filter_t>();
-        auto callback = [&](dual_chunk_view_t* sview) {
-            auto owners = (const dual_entity_t*)dualV_get_owned_ro(sview, snapshotT);
-            dual_entity_type_t setype;
-            dualG_get_type(dualC_get_group(sview->chunk), &setype);
-            int i = 0;
+        auto chunk = pair.first;
+        auto& record = *pair.second;
+        if(SameEntities(storage, record, chunk))
+        {
+            //nothing predicted in this chunk
+            if(!ChunkWritten(record, chunk))
+                continue;
+            dual_chunk_view_t view = {chunk, 0, (uint32_t)record.entities.size()};
+            RestoreRows(record, 0, &view, rolledBackEntities);
+        }
+        else 
+        {
+            //entities moved since the snapshot, locate them one by one
+            uint32_t i = 0;
             auto callback = [&](dual_chunk_view_t* dview)
             {
-                for(int k=0; k<setype.type.length; ++k)
-                {
-                    auto type = setype.type.data[k];
-                    if(type == snapshotT)
-                        continue;
-                    auto dst = dualV_get_owned_rw(dview, type);
-                    dual_chunk_view_t current = {sview->chunk, sview->start + i, sview->count - i};
-                    auto src = dualV_get_owned_ro(&current, type);
-                    ApplyComponent(dst, src, type, dview->count);
-                }
+                if(dview->chunk)
+                    RestoreRows(record, i, dview, rolledBackEntities);
                 i += dview->count;
             };
-            dualS_batch(storage, owners, sview->count, DUAL_LAMBDA(callback));
-        };
-        dualS_query(snapshotStorage, &filter, &meta, DUAL_LAMBDA(callback));
+            dualS_batch(storage, record.entities.data(), (EIndex)record.entities.size(), DUAL_LAMBDA(callback));
+        }
     }
 }
 
@@ -61,6 +61,7 @@ void MPGameWorld::Shutdown()
     zombieAIQuery.Release();
     dualQ_release(ballChildQuery);
     dualQ_release(relevanceChildQuery);
+    skr_transform_release(&transformSystem);
     dualS_release(storage);
 }
 
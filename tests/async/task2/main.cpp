@@ -21,6 +21,7 @@ static struct ProcInitializer
 #if __cpp_impl_coroutine
 #include "SkrRT/async/co_task.hpp"
 #include "SkrRT/platform/filesystem.hpp"
+#include <thread>
 
 class Task2
 {
@@ -246,6 +247,40 @@ TEST_CASE_METHOD(Task2, "MassiveCoroutine")
     EXPECT_EQ(a, 1010000);
 }
 
+TEST_CASE_METHOD(Task2, "BlockingWait")
+{
+    ZoneScopedN("BlockingWait");
+    using namespace skr::task2;
+    std::atomic<int> a = 0;
+    counter_t counter;
+    counter.add(1000);
+    event_t event;
+    schedule([](std::atomic<int>& a, counter_t counter, event_t event) -> skr_task_t
+    {
+        co_await co_wait(counter);
+        a += 1;
+        event.notify();
+    }(a, counter, event));
+    for(int i=0; i<1000; ++i)
+    {
+        schedule([=, &a]() mutable
+        {
+            a += 10;
+            counter.decrease();
+        });
+    }
+    // non-worker threads park on the waiter list instead of spinning
+    int observed = 0;
+    std::thread thread([&]()
+    {
+        wait(counter);
+        wait(event);
+        observed = a;
+    });
+    thread.join();
+    EXPECT_EQ(observed, 10001);
+}
+
 #else
 struct Task2
 {
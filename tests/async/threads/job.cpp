@@ -2,6 +2,7 @@
 #include "SkrRT/misc/log.h"
 #include "SkrRT/misc/make_zeroed.hpp"
 #include "SkrRT/async/thread_job.hpp"
+#include "SkrRT/async/worker_pool.hpp"
 
 #include "SkrTestFramework/framework.hpp"
 
@@ -47,6 +48,40 @@ TEST_CASE("JobQueue")
     jq.wait_empty();
 }
 
+TEST_CASE("WorkerPool")
+{
+    skr::WorkerPool pool;
+    skr::WorkerPoolDesc desc = {};
+    desc.concurrency = 4;
+    desc.reserved_slots = 1;
+    desc.overcommit_timeout_ms = 1;
+    pool.configure(desc);
+    EXPECT_EQ(pool.get_shared_slots(), 3);
+    EXPECT_EQ(pool.get_worker_count(), 3);
+
+    for (uint32_t i = 0; i < 3; i++)
+        REQUIRE(pool.try_acquire(skr::kWorkerSlotShared));
+    EXPECT_FALSE(pool.try_acquire(skr::kWorkerSlotShared));
+
+    // reserved slots never block, services past the reservation shrink the shared budget
+    pool.acquire(skr::kWorkerSlotReserved);
+    pool.acquire(skr::kWorkerSlotReserved);
+    EXPECT_EQ(pool.get_shared_slots(), 2);
+
+    // budget exhausted, acquire overcommits after the timeout instead of deadlocking
+    pool.acquire(skr::kWorkerSlotShared);
+    EXPECT_EQ(pool.get_overcommit_count(), 1);
+    EXPECT_EQ(pool.get_active_count(skr::kWorkerSlotShared), 4);
+
+    pool.release(skr::kWorkerSlotReserved);
+    pool.release(skr::kWorkerSlotReserved);
+    for (uint32_t i = 0; i < 4; i++)
+        pool.release(skr::kWorkerSlotShared);
+    EXPECT_EQ(pool.get_active_count(skr::kWorkerSlotShared), 0);
+    REQUIRE(pool.try_acquire(skr::kWorkerSlotShared));
+    pool.release(skr::kWorkerSlotShared);
+}
+
 #include "SkrRT/misc/log.h"
 #include "SkrRT/async/async_progress.hpp"
 #include <SkrRT/containers/string.hpp>
@@ -0,0 +1,81 @@
+#include "SkrRT/platform/crash.h"
+#include "SkrRT/misc/log.h"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/containers/hashmap.hpp"
+#include "SkrRT/containers/string.hpp"
+
+#include "SkrTestFramework/benchmark.hpp"
+
+static struct ProcInitializer
+{
+    ProcInitializer()
+    {
+        ::skr_log_set_level(SKR_LOG_LEVEL_WARN);
+        ::skr_initialize_crash_handler();
+        ::skr_log_initialize_async_worker();
+    }
+    ~ProcInitializer()
+    {
+        ::skr_log_finalize_async_worker();
+        ::skr_finalize_crash_handler();
+    }
+} init;
+
+SKR_BENCHMARK_ARGS(vector_push_back, 1024, 65536)
+{
+    const auto count = state.arg();
+    while (state.keep_running())
+    {
+        skr::vector<uint64_t> values;
+        for (int64_t i = 0; i < count; ++i)
+            values.push_back((uint64_t)i);
+        skr::bench::do_not_optimize(values.data());
+    }
+    state.set_items_per_iteration(count);
+}
+
+SKR_BENCHMARK_ARGS(flat_hash_map_insert, 1024, 65536)
+{
+    const auto count = state.arg();
+    while (state.keep_running())
+    {
+        skr::flat_hash_map<uint64_t, uint64_t> map;
+        for (int64_t i = 0; i < count; ++i)
+            map.emplace((uint64_t)i * 0x9E3779B97F4A7C15ull, (uint64_t)i);
+        skr::bench::do_not_optimize(map.size());
+    }
+    state.set_items_per_iteration(count);
+}
+
+SKR_BENCHMARK_ARGS(flat_hash_map_find, 1024, 65536)
+{
+    const auto count = state.arg();
+    skr::flat_hash_map<uint64_t, uint64_t> map;
+    for (int64_t i = 0; i < count; ++i)
+        map.emplace((uint64_t)i * 0x9E3779B97F4A7C15ull, (uint64_t)i);
+    while (state.keep_running())
+    {
+        uint64_t sum = 0;
+        for (int64_t i = 0; i < count; ++i)
+        {
+            auto iter = map.find((uint64_t)i * 0x9E3779B97F4A7C15ull);
+            sum += iter->second;
+        }
+        skr::bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(count);
+}
+
+SKR_BENCHMARK_ARGS(string_format, 256, 4096)
+{
+    const auto count = state.arg();
+    while (state.keep_running())
+    {
+        for (int64_t i = 0; i < count; ++i)
+        {
+            auto str = skr::format(u8"resource/path/to/asset_{}.bin", i);
+            skr::bench::do_not_optimize(str.size());
+        }
+    }
+    state.set_items_per_iteration(count);
+}
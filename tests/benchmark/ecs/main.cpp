@@ -0,0 +1,172 @@
+#include "SkrRT/platform/crash.h"
+#include "SkrRT/platform/guid.hpp"
+#include "SkrRT/ecs/dual.h"
+#include "SkrRT/ecs/type_builder.hpp"
+#include "SkrRT/async/fib_task.hpp"
+#include "SkrRT/misc/make_zeroed.hpp"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/misc/log.h"
+
+#include "SkrTestFramework/benchmark.hpp"
+
+struct BenchPosition {
+    float x, y, z;
+};
+struct BenchVelocity {
+    float x, y, z;
+};
+static dual_type_index_t type_position;
+static dual_type_index_t type_velocity;
+
+static dual_type_index_t register_bench_component(const char8_t* name, const skr_guid_t& guid, uint32_t size, uint32_t alignment)
+{
+    dual_type_description_t desc = make_zeroed<dual_type_description_t>();
+    desc.name = name;
+    desc.size = size;
+    desc.guid = guid;
+    desc.alignment = alignment;
+    return dualT_register_type(&desc);
+}
+
+static struct ProcInitializer
+{
+    ProcInitializer()
+    {
+        using namespace skr::guid::literals;
+        ::skr_log_set_level(SKR_LOG_LEVEL_WARN);
+        ::skr_initialize_crash_handler();
+        ::skr_log_initialize_async_worker();
+
+        type_position = register_bench_component(u8"bench_position", u8"{2B6B1C4A-2B37-4C0E-9E54-1C0B2E1F6A11}"_guid, sizeof(BenchPosition), alignof(BenchPosition));
+        type_velocity = register_bench_component(u8"bench_velocity", u8"{7E0D6F31-9C55-4C8B-A3E2-51D4F0B7C922}"_guid, sizeof(BenchVelocity), alignof(BenchVelocity));
+    }
+    ~ProcInitializer()
+    {
+        ::dual_shutdown();
+
+        ::skr_log_finalize_async_worker();
+        ::skr_finalize_crash_handler();
+    }
+} init;
+
+static void allocate_moving(dual_storage_t* storage, EIndex count)
+{
+    dual::type_builder_t builder;
+    builder.with(type_position).with(type_velocity);
+    dual_entity_type_t entityType = make_zeroed<dual_entity_type_t>();
+    entityType.type = builder.build();
+    auto callback = [&](dual_chunk_view_t* view) {
+        auto positions = (BenchPosition*)dualV_get_owned_rw(view, type_position);
+        auto velocities = (BenchVelocity*)dualV_get_owned_rw(view, type_velocity);
+        for (EIndex i = 0; i < view->count; ++i)
+        {
+            positions[i] = { 0.f, 0.f, 0.f };
+            velocities[i] = { 1.f, 2.f, 3.f };
+        }
+    };
+    dualS_allocate_type(storage, &entityType, count, DUAL_LAMBDA(callback));
+}
+
+SKR_BENCHMARK_ARGS(ecs_allocate, 1000, 100000)
+{
+    dual_storage_t* storage = dualS_create();
+    const auto count = (EIndex)state.arg();
+    while (state.keep_running())
+    {
+        allocate_moving(storage, count);
+        state.pause_timing();
+        dualS_destroy_all(storage, nullptr);
+        state.resume_timing();
+    }
+    state.set_items_per_iteration(count);
+    dualS_release(storage);
+}
+
+SKR_BENCHMARK_ARGS(ecs_add_remove_component, 1000, 100000)
+{
+    dual_storage_t* storage = dualS_create();
+    const auto count = (EIndex)state.arg();
+    allocate_moving(storage, count);
+    dual::type_builder_t builder;
+    builder.with(type_velocity);
+    dual_delta_type_t delta = make_zeroed<dual_delta_type_t>();
+    skr::vector<dual_entity_t> entities;
+    auto query = dualQ_from_literal(storage, "[in]bench_position");
+    auto collect = [&](dual_chunk_view_t* view) {
+        auto ents = dualV_get_entities(view);
+        entities.insert(entities.end(), ents, ents + view->count);
+    };
+    dualQ_get_views(query, DUAL_LAMBDA(collect));
+    dualQ_release(query);
+    auto cast = [&](dual_chunk_view_t* view) { dualS_cast_view_delta(storage, view, &delta, nullptr, nullptr); };
+    while (state.keep_running())
+    {
+        // strip velocity from every entity and add it back, two structural changes per entity
+        delta.removed.type = builder.build();
+        delta.added.type = {};
+        dualS_batch(storage, entities.data(), (EIndex)entities.size(), DUAL_LAMBDA(cast));
+        delta.added.type = builder.build();
+        delta.removed.type = {};
+        dualS_batch(storage, entities.data(), (EIndex)entities.size(), DUAL_LAMBDA(cast));
+    }
+    state.set_items_per_iteration(count * 2);
+    dualS_release(storage);
+}
+
+SKR_BENCHMARK_ARGS(ecs_query_iterate, 1000, 100000)
+{
+    dual_storage_t* storage = dualS_create();
+    const auto count = (EIndex)state.arg();
+    allocate_moving(storage, count);
+    auto query = dualQ_from_literal(storage, "[inout]bench_position, [in]bench_velocity");
+    while (state.keep_running())
+    {
+        auto callback = [&](dual_chunk_view_t* view) {
+            auto positions = (BenchPosition*)dualV_get_owned_rw(view, type_position);
+            auto velocities = (const BenchVelocity*)dualV_get_owned_ro(view, type_velocity);
+            for (EIndex i = 0; i < view->count; ++i)
+            {
+                positions[i].x += velocities[i].x;
+                positions[i].y += velocities[i].y;
+                positions[i].z += velocities[i].z;
+            }
+        };
+        dualQ_get_views(query, DUAL_LAMBDA(callback));
+        skr::bench::clobber_memory();
+    }
+    state.set_items_per_iteration(count);
+    dualQ_release(query);
+    dualS_release(storage);
+}
+
+SKR_BENCHMARK_ARGS(ecs_schedule_parallel, 1000, 100000)
+{
+    skr::task::scheduler_t scheduler;
+    scheduler.initialize(skr::task::scheudler_config_t{});
+    scheduler.bind();
+    dual_storage_t* storage = dualS_create();
+    dualJ_bind_storage(storage);
+    const auto count = (EIndex)state.arg();
+    allocate_moving(storage, count);
+    auto query = dualQ_from_literal(storage, "[inout]bench_position, [in]bench_velocity");
+    while (state.keep_running())
+    {
+        auto job = +[](void* u, dual_query_t* query, dual_chunk_view_t* view, dual_type_index_t* localTypes, EIndex entityIndex) {
+            auto positions = (BenchPosition*)dualV_get_owned_rw_local(view, localTypes[0]);
+            auto velocities = (const BenchVelocity*)dualV_get_owned_ro_local(view, localTypes[1]);
+            for (EIndex i = 0; i < view->count; ++i)
+            {
+                positions[i].x += velocities[i].x;
+                positions[i].y += velocities[i].y;
+                positions[i].z += velocities[i].z;
+            }
+        };
+        dualJ_schedule_ecs(query, 1024, job, nullptr, nullptr, nullptr, nullptr, nullptr);
+        dualJ_wait_storage(storage);
+    }
+    state.set_items_per_iteration(count);
+    dualQ_release(query);
+    dualJ_unbind_storage(storage);
+    dualS_release(storage);
+    scheduler.unbind();
+}
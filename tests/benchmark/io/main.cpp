@@ -0,0 +1,109 @@
+#include "SkrRT/platform/vfs.h"
+#include "SkrRT/platform/crash.h"
+#include "SkrRT/platform/thread.h"
+#include "SkrRT/misc/log.h"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/io/ram_io.hpp"
+
+#include "SkrTestFramework/benchmark.hpp"
+
+static skr_vfs_t* abs_fs = nullptr;
+
+static struct ProcInitializer
+{
+    ProcInitializer()
+    {
+        ::skr_log_set_level(SKR_LOG_LEVEL_WARN);
+        ::skr_initialize_crash_handler();
+        ::skr_log_initialize_async_worker();
+
+        skr_vfs_desc_t abs_fs_desc = {};
+        abs_fs_desc.app_name = u8"io-benchmark";
+        abs_fs_desc.mount_type = SKR_MOUNT_TYPE_ABSOLUTE;
+        abs_fs = skr_create_vfs(&abs_fs_desc);
+    }
+    ~ProcInitializer()
+    {
+        skr_free_vfs(abs_fs);
+
+        ::skr_log_finalize_async_worker();
+        ::skr_finalize_crash_handler();
+    }
+} init;
+
+static void write_bench_file(const char8_t* path, uint64_t size)
+{
+    skr::vector<uint8_t> content(size, (uint8_t)0x5A);
+    auto f = skr_vfs_fopen(abs_fs, path, SKR_FM_READ_WRITE, SKR_FILE_CREATION_ALWAYS_NEW);
+    skr_vfs_fwrite(f, content.data(), 0, content.size());
+    skr_vfs_fclose(f);
+}
+
+// end to end latency of a single whole-file read through the RAM service
+SKR_BENCHMARK_ARGS(io_ram_read, 4 * 1024, 1024 * 1024)
+{
+    const auto size = (uint64_t)state.arg();
+    write_bench_file(u8"io-benchmark-file", size);
+
+    skr_ram_io_service_desc_t ioServiceDesc = {};
+    ioServiceDesc.name = u8"IOBenchmark";
+    ioServiceDesc.use_dstorage = false;
+    auto ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+    ioService->run();
+    while (state.keep_running())
+    {
+        skr_io_future_t future = {};
+        skr::BlobId blob = nullptr;
+        {
+            auto rq = ioService->open_request();
+            rq->set_vfs(abs_fs);
+            rq->set_path(u8"io-benchmark-file");
+            rq->add_block({}); // read all
+            blob = ioService->request(rq, &future);
+        }
+        while (!future.is_ready())
+            skr_thread_sleep(0);
+        skr::bench::do_not_optimize(blob->get_data());
+    }
+    state.set_bytes_per_iteration(size);
+    skr_io_ram_service_t::destroy(ioService);
+}
+
+// throughput of many small requests in flight at the same time
+SKR_BENCHMARK_ARGS(io_ram_read_batch, 16, 256)
+{
+    const auto count = (uint64_t)state.arg();
+    write_bench_file(u8"io-benchmark-small", 4 * 1024);
+
+    skr_ram_io_service_desc_t ioServiceDesc = {};
+    ioServiceDesc.name = u8"IOBenchmark";
+    ioServiceDesc.use_dstorage = false;
+    auto ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+    ioService->run();
+    skr::vector<skr_io_future_t> futures(count);
+    skr::vector<skr::BlobId> blobs(count);
+    while (state.keep_running())
+    {
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            futures[i] = {};
+            auto rq = ioService->open_request();
+            rq->set_vfs(abs_fs);
+            rq->set_path(u8"io-benchmark-small");
+            rq->add_block({});
+            blobs[i] = ioService->request(rq, &futures[i]);
+        }
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            while (!futures[i].is_ready())
+                skr_thread_sleep(0);
+        }
+        state.pause_timing();
+        for (auto& blob : blobs)
+            blob.reset();
+        state.resume_timing();
+    }
+    state.set_items_per_iteration(count);
+    state.set_bytes_per_iteration(count * 4 * 1024);
+    skr_io_ram_service_t::destroy(ioService);
+}
@@ -0,0 +1,116 @@
+#include "SkrRT/platform/crash.h"
+#include "SkrRT/misc/log.h"
+#include "SkrRT/misc/log.hpp"
+// sinks are only reachable through the manager, see the LogBenchmark target
+#include "misc/log/log_manager.hpp"
+
+#include "SkrTestFramework/benchmark.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// drops every event, the worker still dequeues, formats and patterns them
+struct NullLogSink : public skr::log::LogSink
+{
+    NullLogSink() SKR_NOEXCEPT : LogSink(skr::log::LogConstants::kDefaultPatternId) {}
+    void sink(const skr::log::LogEvent& event, skr::string_view content) SKR_NOEXCEPT override {}
+};
+
+static struct ProcInitializer
+{
+    ProcInitializer()
+    {
+        // every event of this process is enqueued and nothing reaches the console or log file,
+        // sinks are swapped before the worker exists so it never sees the default ones
+        ::skr_log_set_level(SKR_LOG_LEVEL_INFO);
+        auto manager = skr::log::LogManager::Get();
+        manager->sinks_.clear();
+        manager->RegisterSink(eastl::make_unique<NullLogSink>());
+        ::skr_initialize_crash_handler();
+        ::skr_log_initialize_async_worker();
+    }
+    ~ProcInitializer()
+    {
+        ::skr_log_finalize_async_worker();
+        ::skr_finalize_crash_handler();
+    }
+} init;
+
+static constexpr int32_t kEventsPerProducer = 256;
+
+// printf style, formatted in place by the producer
+static void ProduceFormatted()
+{
+    for (int32_t i = 0; i < kEventsPerProducer; ++i)
+        SKR_LOG_INFO(u8"benchmark event %d of %s", i, "producer");
+}
+
+// fmt style with copyable arguments, formatted later by the worker
+static void ProduceDeferred()
+{
+    for (int32_t i = 0; i < kEventsPerProducer; ++i)
+        SKR_LOG_FMT_INFO(u8"benchmark event {} of {}", i, 0.5f);
+}
+
+// every iteration the producers, the benchmark thread being one of them, enqueue kEventsPerProducer events at once.
+// the queue is flushed between iterations with the timer paused, so it does not grow over the run
+template <void (*Produce)()>
+static void EnqueueContended(skr::bench::State& state)
+{
+    const auto producers = (uint32_t)state.arg();
+    std::atomic<uint64_t> round = 0;
+    std::atomic<uint32_t> produced = 0;
+    std::atomic<uint32_t> flushed = 0;
+    std::atomic<bool> quit = false;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 1; t < producers; ++t)
+    {
+        threads.emplace_back([&]() {
+            uint64_t seen = 0;
+            for (;;)
+            {
+                uint64_t current;
+                while ((current = round.load(std::memory_order_acquire)) == seen)
+                {
+                    if (quit.load(std::memory_order_acquire)) return;
+                    std::this_thread::yield();
+                }
+                seen = current;
+                Produce();
+                produced.fetch_add(1, std::memory_order_release);
+                skr_log_flush();
+                flushed.fetch_add(1, std::memory_order_release);
+            }
+        });
+    }
+    while (state.keep_running())
+    {
+        produced.store(0, std::memory_order_relaxed);
+        flushed.store(0, std::memory_order_relaxed);
+        round.fetch_add(1, std::memory_order_release);
+        Produce();
+        while (produced.load(std::memory_order_acquire) != producers - 1)
+            std::this_thread::yield();
+
+        state.pause_timing();
+        skr_log_flush();
+        while (flushed.load(std::memory_order_acquire) != producers - 1)
+            std::this_thread::yield();
+        state.resume_timing();
+    }
+    quit.store(true, std::memory_order_release);
+    for (auto& thread : threads)
+        thread.join();
+    state.set_items_per_iteration(producers * kEventsPerProducer);
+}
+
+SKR_BENCHMARK_ARGS(log_enqueue_formatted, 1, 2, 4, 8)
+{
+    EnqueueContended<&ProduceFormatted>(state);
+}
+
+SKR_BENCHMARK_ARGS(log_enqueue_deferred, 1, 2, 4, 8)
+{
+    EnqueueContended<&ProduceDeferred>(state);
+}
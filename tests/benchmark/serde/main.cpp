@@ -0,0 +1,90 @@
+#include "SkrRT/platform/crash.h"
+#include "SkrRT/misc/log.h"
+#include "SkrRT/serde/binary/writer.h"
+#include "SkrRT/serde/binary/reader.h"
+#include "SkrRT/containers/string.hpp"
+#include "SkrRT/containers/span.hpp"
+#include "SkrRT/containers/vector.hpp"
+
+#include "SkrTestFramework/benchmark.hpp"
+
+static struct ProcInitializer
+{
+    ProcInitializer()
+    {
+        ::skr_log_set_level(SKR_LOG_LEVEL_WARN);
+        ::skr_initialize_crash_handler();
+        ::skr_log_initialize_async_worker();
+    }
+    ~ProcInitializer()
+    {
+        ::skr_log_finalize_async_worker();
+        ::skr_finalize_crash_handler();
+    }
+} init;
+
+SKR_BENCHMARK_ARGS(serde_binary_write_u64_array, 1024, 65536)
+{
+    skr::vector<uint64_t> values(state.arg());
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = i * 0x9E3779B97F4A7C15ull;
+    eastl::vector<uint8_t> buffer;
+    skr::binary::VectorWriter writer;
+    writer.buffer = &buffer;
+    skr_binary_writer_t warchive{ writer };
+    while (state.keep_running())
+    {
+        buffer.clear();
+        skr::binary::Archive(&warchive, values);
+        skr::bench::do_not_optimize(buffer.data());
+    }
+    state.set_bytes_per_iteration(values.size() * sizeof(uint64_t));
+}
+
+SKR_BENCHMARK_ARGS(serde_binary_read_u64_array, 1024, 65536)
+{
+    skr::vector<uint64_t> values(state.arg());
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = i * 0x9E3779B97F4A7C15ull;
+    eastl::vector<uint8_t> buffer;
+    skr::binary::VectorWriter writer;
+    writer.buffer = &buffer;
+    skr_binary_writer_t warchive{ writer };
+    skr::binary::Archive(&warchive, values);
+
+    skr::vector<uint64_t> readValues;
+    skr::binary::SpanReader reader;
+    skr_binary_reader_t rarchive{ reader };
+    while (state.keep_running())
+    {
+        reader.data = skr::span<uint8_t>(buffer.data(), buffer.size());
+        reader.offset = 0;
+        skr::binary::Archive(&rarchive, readValues);
+        skr::bench::do_not_optimize(readValues.data());
+    }
+    state.set_bytes_per_iteration(values.size() * sizeof(uint64_t));
+}
+
+SKR_BENCHMARK_ARGS(serde_binary_roundtrip_strings, 256, 4096)
+{
+    skr::vector<skr::string> values;
+    for (int64_t i = 0; i < state.arg(); ++i)
+        values.emplace_back(skr::format(u8"resource/path/to/asset_{}.bin", i));
+    eastl::vector<uint8_t> buffer;
+    skr::binary::VectorWriter writer;
+    writer.buffer = &buffer;
+    skr_binary_writer_t warchive{ writer };
+    skr::vector<skr::string> readValues;
+    skr::binary::SpanReader reader;
+    skr_binary_reader_t rarchive{ reader };
+    while (state.keep_running())
+    {
+        buffer.clear();
+        skr::binary::Archive(&warchive, values);
+        reader.data = skr::span<uint8_t>(buffer.data(), buffer.size());
+        reader.offset = 0;
+        skr::binary::Archive(&rarchive, readValues);
+        skr::bench::do_not_optimize(readValues.data());
+    }
+    state.set_items_per_iteration(values.size());
+}
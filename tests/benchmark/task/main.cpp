@@ -0,0 +1,96 @@
+#include "SkrRT/platform/crash.h"
+#include "SkrRT/misc/log.h"
+
+#include "SkrTestFramework/benchmark.hpp"
+
+static struct ProcInitializer
+{
+    ProcInitializer()
+    {
+        ::skr_log_set_level(SKR_LOG_LEVEL_WARN);
+        ::skr_initialize_crash_handler();
+        ::skr_log_initialize_async_worker();
+    }
+    ~ProcInitializer()
+    {
+        ::skr_log_finalize_async_worker();
+        ::skr_finalize_crash_handler();
+    }
+} init;
+
+#if __cpp_impl_coroutine
+#include "SkrRT/async/co_task.hpp"
+#include <atomic>
+
+struct Task2Scope
+{
+    skr::task2::scheduler_t scheduler;
+    Task2Scope() SKR_NOEXCEPT
+    {
+        scheduler.initialize({});
+        scheduler.bind();
+    }
+    ~Task2Scope() SKR_NOEXCEPT
+    {
+        scheduler.unbind();
+        scheduler.shutdown();
+    }
+};
+
+// schedule + notify + sync round trip of a single empty job
+SKR_BENCHMARK(task2_single_job)
+{
+    Task2Scope scope;
+    using namespace skr::task2;
+    while (state.keep_running())
+    {
+        event_t event;
+        schedule([&]() { event.notify(); });
+        sync(event);
+    }
+    state.set_items_per_iteration(1);
+}
+
+// fan out N small jobs and join them with a counter
+SKR_BENCHMARK_ARGS(task2_fan_out, 64, 1024)
+{
+    Task2Scope scope;
+    using namespace skr::task2;
+    const auto count = state.arg();
+    while (state.keep_running())
+    {
+        counter_t counter;
+        std::atomic<int64_t> sum = 0;
+        counter.add((uint32_t)count);
+        for (int64_t i = 0; i < count; ++i)
+        {
+            schedule([&, i]() {
+                sum.fetch_add(i, std::memory_order_relaxed);
+                counter.decrease();
+            });
+        }
+        sync(counter);
+        skr::bench::do_not_optimize(sum.load());
+    }
+    state.set_items_per_iteration(count);
+}
+
+// coroutine job suspended on an event and resumed by another job
+SKR_BENCHMARK(task2_co_await)
+{
+    Task2Scope scope;
+    using namespace skr::task2;
+    while (state.keep_running())
+    {
+        event_t ready;
+        event_t done;
+        schedule([](event_t ready, event_t done) -> skr_task_t {
+            co_await co_wait(ready);
+            done.notify();
+        }(ready, done));
+        schedule([&]() { ready.notify(); });
+        sync(done);
+    }
+    state.set_items_per_iteration(1);
+}
+#endif
@@ -0,0 +1,45 @@
+-- run with `xmake test --group=05.tests/benchmark` or launch a target with `--out=result.json`,
+-- then compare two runs with tools/benchmark/compare.py
+target("ECSBenchmark")
+    set_kind("binary")
+    set_group("05.tests/benchmark")
+    public_dependency("SkrRT", engine_version)
+    add_deps("SkrBenchmarkFramework", {public = false})
+    add_files("ecs/main.cpp")
+
+target("SerdeBenchmark")
+    set_kind("binary")
+    set_group("05.tests/benchmark")
+    public_dependency("SkrRT", engine_version)
+    add_deps("SkrBenchmarkFramework", {public = false})
+    add_files("serde/main.cpp")
+
+target("IOBenchmark")
+    set_kind("binary")
+    set_group("05.tests/benchmark")
+    public_dependency("SkrRT", engine_version)
+    add_deps("SkrBenchmarkFramework", {public = false})
+    add_files("io/main.cpp")
+
+target("TaskBenchmark")
+    set_kind("binary")
+    set_group("05.tests/benchmark")
+    public_dependency("SkrRT", engine_version)
+    add_deps("SkrBenchmarkFramework", {public = false})
+    add_files("task/main.cpp")
+
+target("ContainersBenchmark")
+    set_kind("binary")
+    set_group("05.tests/benchmark")
+    public_dependency("SkrRT", engine_version)
+    add_deps("SkrBenchmarkFramework", {public = false})
+    add_files("containers/main.cpp")
+
+target("LogBenchmark")
+    set_kind("binary")
+    set_group("05.tests/benchmark")
+    public_dependency("SkrRT", engine_version)
+    add_deps("SkrBenchmarkFramework", {public = false})
+    -- replaces the default sinks through the internal log manager
+    add_includedirs("$(projectdir)/modules/runtime/src", {public = false})
+    add_files("log/main.cpp")
@@ -0,0 +1,171 @@
+#include "cgpu/cgpux.hpp"
+#include "SkrRT/misc/make_zeroed.hpp"
+
+#include "SkrTestFramework/framework.hpp"
+
+// bind tables only talk to the device through the descriptor set procs,
+// so they can be checked against a stub device without a gpu
+namespace
+{
+struct StubDescriptorSet : public CGPUDescriptorSet {
+    uint32_t writes = 0;
+    uint32_t written_descriptors = 0;
+};
+
+CGPUDescriptorSetId stub_create_descriptor_set(CGPUDeviceId device, const struct CGPUDescriptorSetDescriptor* desc)
+{
+    return new StubDescriptorSet();
+}
+
+void stub_update_descriptor_set(CGPUDescriptorSetId set, const struct CGPUDescriptorData* datas, uint32_t count)
+{
+    auto stub = (StubDescriptorSet*)set;
+    stub->writes++;
+    stub->written_descriptors += count;
+}
+
+void stub_free_descriptor_set(CGPUDescriptorSetId set)
+{
+    delete (StubDescriptorSet*)set;
+}
+} // namespace
+
+class BindTable
+{
+protected:
+    BindTable()
+    {
+        procs = make_zeroed<CGPUProcTable>();
+        const_cast<CGPUProcCreateDescriptorSet&>(procs.create_descriptor_set) = &stub_create_descriptor_set;
+        const_cast<CGPUProcUpdateDescriptorSet&>(procs.update_descriptor_set) = &stub_update_descriptor_set;
+        const_cast<CGPUProcFreeDescriptorSet&>(procs.free_descriptor_set) = &stub_free_descriptor_set;
+        device.proc_table_cache = &procs;
+
+        // set0: albedo, normal | set1: params
+        set0_resources[0] = make_zeroed<CGPUShaderResource>();
+        set0_resources[0].name = u8"albedo";
+        set0_resources[0].type = CGPU_RESOURCE_TYPE_TEXTURE;
+        set0_resources[0].binding = 0;
+        set0_resources[1] = make_zeroed<CGPUShaderResource>();
+        set0_resources[1].name = u8"normal";
+        set0_resources[1].type = CGPU_RESOURCE_TYPE_TEXTURE;
+        set0_resources[1].binding = 1;
+        set1_resources[0] = make_zeroed<CGPUShaderResource>();
+        set1_resources[0].name = u8"params";
+        set1_resources[0].type = CGPU_RESOURCE_TYPE_UNIFORM_BUFFER;
+        set1_resources[0].binding = 0;
+        tables[0] = { set0_resources, 2, 0 };
+        tables[1] = { set1_resources, 1, 1 };
+        root_signature = make_zeroed<CGPURootSignature>();
+        root_signature.device = &device;
+        root_signature.tables = tables;
+        root_signature.table_count = 2;
+    }
+
+    CGPUXBindTableId CreateTable(uint32_t versions_count)
+    {
+        static const CGPUXName names[] = { u8"albedo", u8"normal", u8"params", u8"unused" };
+        CGPUXBindTableDescriptor desc = {};
+        desc.root_signature = &root_signature;
+        desc.names = names;
+        desc.names_count = 4;
+        desc.versions_count = versions_count;
+        return cgpux_create_bind_table(&device, &desc);
+    }
+
+    static CGPUDescriptorData Texture(CGPUTextureViewId* view)
+    {
+        auto data = make_zeroed<CGPUDescriptorData>();
+        data.binding_type = CGPU_RESOURCE_TYPE_TEXTURE;
+        data.count = 1;
+        data.textures = view;
+        return data;
+    }
+
+    CGPUProcTable procs;
+    CGPUDevice device;
+    CGPUShaderResource set0_resources[2];
+    CGPUShaderResource set1_resources[1];
+    CGPUParameterTable tables[2];
+    CGPURootSignature root_signature;
+};
+
+TEST_CASE_METHOD(BindTable, "Slots")
+{
+    auto table = CreateTable(1);
+    const auto albedo = cgpux_bind_table_find_slot(table, u8"albedo");
+    const auto normal = cgpux_bind_table_find_slot(table, u8"normal");
+    EXPECT_EQ(albedo, 0);
+    EXPECT_EQ(normal, 1);
+    EXPECT_EQ(cgpux_bind_table_find_slot(table, u8"params"), 2);
+    // not in the root signature or not in the table
+    EXPECT_EQ(cgpux_bind_table_find_slot(table, u8"unused"), CGPUX_INVALID_BIND_TABLE_SLOT);
+    EXPECT_EQ(cgpux_bind_table_find_slot(table, u8"missing"), CGPUX_INVALID_BIND_TABLE_SLOT);
+
+    auto set0 = (StubDescriptorSet*)table->GetDescriptorSet(0);
+    auto set1 = (StubDescriptorSet*)table->GetDescriptorSet(1);
+    REQUIRE(set0 != nullptr);
+    REQUIRE(set1 != nullptr);
+
+    CGPUTextureViewId views[2] = { (CGPUTextureViewId)0x10, (CGPUTextureViewId)0x20 };
+    CGPUXBindTableSlot slots[2] = { albedo, normal };
+    CGPUDescriptorData datas[2] = { Texture(&views[0]), Texture(&views[1]) };
+    cgpux_bind_table_update_slots(table, slots, datas, 2);
+    // one batched write, the untouched set stays clean
+    EXPECT_EQ(set0->writes, 1);
+    EXPECT_EQ(set0->written_descriptors, 2);
+    EXPECT_EQ(set1->writes, 0);
+
+    // same values are not written again
+    cgpux_bind_table_update_slots(table, slots, datas, 2);
+    EXPECT_EQ(set0->writes, 1);
+
+    // single change only writes the changed descriptor in place
+    CGPUTextureViewId other = (CGPUTextureViewId)0x30;
+    auto changed = Texture(&other);
+    cgpux_bind_table_update_slots(table, &normal, &changed, 1);
+    EXPECT_EQ(table->GetDescriptorSet(0), (CGPUDescriptorSetId)set0);
+    EXPECT_EQ(set0->writes, 2);
+    EXPECT_EQ(set0->written_descriptors, 3);
+
+    // name updates land on the same slots
+    changed.name = u8"normal";
+    cgpux_bind_table_update(table, &changed, 1);
+    EXPECT_EQ(set0->writes, 2);
+
+    cgpux_free_bind_table(table);
+}
+
+TEST_CASE_METHOD(BindTable, "Versions")
+{
+    auto table = CreateTable(3);
+    const auto albedo = cgpux_bind_table_find_slot(table, u8"albedo");
+    const auto normal = cgpux_bind_table_find_slot(table, u8"normal");
+    const auto initial = table->GetDescriptorSet(0);
+
+    CGPUTextureViewId views[4] = { (CGPUTextureViewId)0x10, (CGPUTextureViewId)0x20, (CGPUTextureViewId)0x30, (CGPUTextureViewId)0x40 };
+    CGPUXBindTableSlot slots[2] = { albedo, normal };
+    CGPUDescriptorData datas[2] = { Texture(&views[0]), Texture(&views[1]) };
+    cgpux_bind_table_update_slots(table, slots, datas, 2);
+    const auto first = table->GetDescriptorSet(0);
+    EXPECT_NE(first, initial);
+
+    // the bound version is never written, the next one gets every descriptor of the set
+    auto changed = Texture(&views[2]);
+    cgpux_bind_table_update_slots(table, &normal, &changed, 1);
+    const auto second = table->GetDescriptorSet(0);
+    EXPECT_NE(second, first);
+    EXPECT_EQ(((StubDescriptorSet*)first)->writes, 1);
+    EXPECT_EQ(((StubDescriptorSet*)second)->written_descriptors, 2);
+
+    // the ring wraps back to the first set
+    changed = Texture(&views[3]);
+    cgpux_bind_table_update_slots(table, &normal, &changed, 1);
+    EXPECT_EQ(table->GetDescriptorSet(0), initial);
+    changed = Texture(&views[1]);
+    cgpux_bind_table_update_slots(table, &normal, &changed, 1);
+    EXPECT_EQ(table->GetDescriptorSet(0), first);
+    EXPECT_EQ(((StubDescriptorSet*)first)->writes, 2);
+
+    cgpux_free_bind_table(table);
+}
@@ -132,6 +132,8 @@ void ResourceCreation<backend>::test_all()
         desc.depth = 1;
         auto texture = cgpu_create_texture(device, &desc);
         EXPECT_NE(texture, CGPU_NULLPTR);
+        // render graph pools budget against the reported footprint
+        EXPECT_GE(texture->info->size_in_bytes, 512 * 512 * 4);
         cgpu_free_texture(texture);
     }
 
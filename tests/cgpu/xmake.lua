@@ -18,6 +18,8 @@ target("CGPUTests")
         -- RSPool
         "RootSignaturePool/RootSignaturePool.cpp",
         "RootSignaturePool/shaders/**.hlsl",
+        -- BindTable
+        "BindTable/BindTable.cpp",
         -- ResourceCreation
         "ResourceCreation/ResourceCreation.cpp",
         -- SwapChainCreation
@@ -0,0 +1,102 @@
+#pragma once
+#include <cstdint>
+#include <chrono>
+#include <initializer_list>
+
+// Minimal benchmark harness for runtime hot paths.
+// Register a function with SKR_BENCHMARK and measure its body inside `while (state.keep_running())`.
+// The runner calibrates the iteration count, repeats each benchmark several times, prints a table
+// and writes machine readable results with --out=<file.json>, see tools/benchmark/compare.py.
+namespace skr
+{
+namespace bench
+{
+struct State
+{
+    using clock = std::chrono::steady_clock;
+
+    State(uint64_t iterations, int64_t argument)
+        : maxIterations(iterations), argument(argument)
+    {
+    }
+
+    // run the next iteration, the timer starts on the first call and stops when this returns false
+    bool keep_running()
+    {
+        if (count == 0)
+            start = clock::now();
+        if (count < maxIterations)
+        {
+            ++count;
+            return true;
+        }
+        elapsed += clock::now() - start;
+        return false;
+    }
+    // exclude setup work inside the loop from the measurement
+    void pause_timing() { elapsed += clock::now() - start; }
+    void resume_timing() { start = clock::now(); }
+
+    // value the benchmark was registered with through SKR_BENCHMARK_ARGS
+    int64_t arg() const { return argument; }
+    uint64_t iterations() const { return maxIterations; }
+    // per iteration throughput counters
+    void set_items_per_iteration(uint64_t n) { itemsPerIteration = n; }
+    void set_bytes_per_iteration(uint64_t n) { bytesPerIteration = n; }
+
+    uint64_t maxIterations = 0;
+    uint64_t count = 0;
+    clock::time_point start;
+    clock::duration elapsed = clock::duration::zero();
+    uint64_t itemsPerIteration = 0;
+    uint64_t bytesPerIteration = 0;
+    int64_t argument = 0;
+};
+
+using BenchmarkFunc = void (*)(State&);
+
+// parse command line options and run every registered benchmark, used by the default main
+int run_benchmarks(int argc, char** argv);
+
+struct Registrar
+{
+    Registrar(const char* name, BenchmarkFunc func, std::initializer_list<int64_t> args = {});
+};
+
+// keep the optimizer from discarding a computed value
+template <class T>
+inline void do_not_optimize(T const& value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    static volatile const void* sink;
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+inline void clobber_memory()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : : "memory");
+#endif
+}
+} // namespace bench
+} // namespace skr
+
+#define SKR_BENCHMARK_CONCAT_INNER(x, y) x##y
+#define SKR_BENCHMARK_CONCAT(x, y) SKR_BENCHMARK_CONCAT_INNER(x, y)
+
+// SKR_BENCHMARK(name) { while (state.keep_running()) { ... } }
+#define SKR_BENCHMARK(name)                                                                                      \
+    static void name(::skr::bench::State& state);                                                                \
+    static ::skr::bench::Registrar SKR_BENCHMARK_CONCAT(skr_bench_registrar_, __LINE__)(#name, &name); \
+    static void name(::skr::bench::State& state)
+
+// SKR_BENCHMARK_ARGS(name, 100, 10000) registers name/100 and name/10000, read the value with state.arg()
+#define SKR_BENCHMARK_ARGS(name, ...)                                                                            \
+    static void name(::skr::bench::State& state);                                                                \
+    static ::skr::bench::Registrar SKR_BENCHMARK_CONCAT(skr_bench_registrar_, __LINE__)(#name, &name, { __VA_ARGS__ }); \
+    static void name(::skr::bench::State& state)
@@ -0,0 +1,216 @@
+#include "SkrTestFramework/benchmark.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace skr
+{
+namespace bench
+{
+struct Entry {
+    std::string name;
+    BenchmarkFunc func;
+    int64_t argument;
+};
+
+struct Result {
+    std::string name;
+    uint64_t iterations;
+    std::vector<double> samples; // ns per iteration
+    double median;
+    double mean;
+    double min;
+    double stddev;
+    double itemsPerSecond;
+    double bytesPerSecond;
+};
+
+struct Options {
+    const char* filter = nullptr;
+    const char* out = nullptr;
+    double minTime = 0.1;
+    uint32_t repetitions = 5;
+    bool list = false;
+};
+
+static std::vector<Entry>& registry()
+{
+    static std::vector<Entry> entries;
+    return entries;
+}
+
+Registrar::Registrar(const char* name, BenchmarkFunc func, std::initializer_list<int64_t> args)
+{
+    if (args.size() == 0)
+        registry().push_back({ name, func, 0 });
+    for (auto arg : args)
+        registry().push_back({ std::string(name) + "/" + std::to_string(arg), func, arg });
+}
+
+static double run_once(const Entry& entry, uint64_t iterations, State* out = nullptr)
+{
+    State state(iterations, entry.argument);
+    entry.func(state);
+    if (out)
+        *out = state;
+    return std::chrono::duration<double>(state.elapsed).count();
+}
+
+static Result run_entry(const Entry& entry, const Options& options)
+{
+    // grow the iteration count until one run takes at least minTime
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        double seconds = run_once(entry, iterations);
+        if (seconds >= options.minTime || iterations >= 1000000000ull)
+            break;
+        double multiplier = seconds > 0.0 ? options.minTime * 1.4 / seconds : 100.0;
+        multiplier = std::min(100.0, std::max(2.0, multiplier));
+        iterations = (uint64_t)(iterations * multiplier);
+    }
+
+    Result result;
+    result.name = entry.name;
+    result.iterations = iterations;
+    State state(0, 0);
+    for (uint32_t i = 0; i < options.repetitions; ++i)
+    {
+        double seconds = run_once(entry, iterations, &state);
+        result.samples.push_back(seconds * 1e9 / (double)iterations);
+    }
+    std::vector<double> sorted = result.samples;
+    std::sort(sorted.begin(), sorted.end());
+    const size_t n = sorted.size();
+    result.median = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) * 0.5;
+    result.min = sorted.front();
+    double sum = 0.0;
+    for (auto s : sorted)
+        sum += s;
+    result.mean = sum / (double)n;
+    double variance = 0.0;
+    for (auto s : sorted)
+        variance += (s - result.mean) * (s - result.mean);
+    result.stddev = n > 1 ? std::sqrt(variance / (double)(n - 1)) : 0.0;
+    result.itemsPerSecond = state.itemsPerIteration ? state.itemsPerIteration * 1e9 / result.median : 0.0;
+    result.bytesPerSecond = state.bytesPerIteration ? state.bytesPerIteration * 1e9 / result.median : 0.0;
+    return result;
+}
+
+static void write_json_string(FILE* f, const std::string& str)
+{
+    fputc('"', f);
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+            fputc('\\', f);
+        fputc(c, f);
+    }
+    fputc('"', f);
+}
+
+static bool write_json(const char* path, const char* executable, const std::vector<Result>& results)
+{
+    FILE* f = fopen(path, "w");
+    if (!f)
+        return false;
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    fprintf(f, "{\n  \"context\": {\n    \"executable\": ");
+    write_json_string(f, executable);
+    fprintf(f, ",\n    \"date\": \"%s\",\n    \"num_cpus\": %u,\n", date, std::thread::hardware_concurrency());
+#ifdef NDEBUG
+    fprintf(f, "    \"build_type\": \"release\"\n  },\n");
+#else
+    fprintf(f, "    \"build_type\": \"debug\"\n  },\n");
+#endif
+    fprintf(f, "  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r = results[i];
+        fprintf(f, "    {\n      \"name\": ");
+        write_json_string(f, r.name);
+        fprintf(f, ",\n      \"iterations\": %llu,\n      \"repetitions\": %zu,\n", (unsigned long long)r.iterations, r.samples.size());
+        fprintf(f, "      \"median_ns\": %.4f,\n      \"mean_ns\": %.4f,\n      \"min_ns\": %.4f,\n      \"stddev_ns\": %.4f,\n", r.median, r.mean, r.min, r.stddev);
+        fprintf(f, "      \"items_per_second\": %.4f,\n      \"bytes_per_second\": %.4f,\n", r.itemsPerSecond, r.bytesPerSecond);
+        fprintf(f, "      \"samples_ns\": [");
+        for (size_t j = 0; j < r.samples.size(); ++j)
+            fprintf(f, j ? ", %.4f" : "%.4f", r.samples[j]);
+        fprintf(f, "]\n    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+}
+
+static bool parse_options(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--filter=", 9) == 0)
+            options.filter = arg + 9;
+        else if (std::strncmp(arg, "--out=", 6) == 0)
+            options.out = arg + 6;
+        else if (std::strncmp(arg, "--min-time=", 11) == 0)
+            options.minTime = std::atof(arg + 11);
+        else if (std::strncmp(arg, "--repetitions=", 14) == 0)
+            options.repetitions = (uint32_t)std::max(1, std::atoi(arg + 14));
+        else if (std::strcmp(arg, "--list") == 0)
+            options.list = true;
+        else
+        {
+            fprintf(stderr, "unknown option %s\n"
+                            "usage: %s [--filter=<substring>] [--out=<file.json>] [--min-time=<seconds>] [--repetitions=<n>] [--list]\n",
+                    arg, argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+int run_benchmarks(int argc, char** argv)
+{
+    Options options;
+    if (!parse_options(argc, argv, options))
+        return 1;
+    std::vector<Result> results;
+    printf("%-48s %14s %14s %10s %14s\n", "benchmark", "median(ns)", "min(ns)", "cv(%)", "iterations");
+    for (const auto& entry : registry())
+    {
+        if (options.filter && entry.name.find(options.filter) == std::string::npos)
+            continue;
+        if (options.list)
+        {
+            printf("%s\n", entry.name.c_str());
+            continue;
+        }
+        results.push_back(run_entry(entry, options));
+        const auto& r = results.back();
+        printf("%-48s %14.2f %14.2f %10.2f %14llu\n", r.name.c_str(), r.median, r.min,
+               r.mean > 0.0 ? r.stddev * 100.0 / r.mean : 0.0, (unsigned long long)r.iterations);
+        fflush(stdout);
+    }
+    if (options.out && !write_json(options.out, argv[0], results))
+    {
+        fprintf(stderr, "failed to write %s\n", options.out);
+        return 1;
+    }
+    return 0;
+}
+} // namespace bench
+} // namespace skr
+
+#ifndef SKR_BENCHMARK_CUSTOM_MAIN
+int main(int argc, char** argv)
+{
+    return skr::bench::run_benchmarks(argc, argv);
+}
+#endif
@@ -195,6 +195,92 @@ TEST_CASE_METHOD(ECSTest, "remove_component")
     EXPECT_EQ(dualV_get_owned_ro(&view, type_test), nullptr);
 }
 
+TEST_CASE_METHOD(ECSTest, "timestamp")
+{
+    dual_chunk_view_t view;
+    dualS_access(storage, e1, &view);
+    const auto version = dualS_get_version(storage);
+    EXPECT_EQ(dualC_get_timestamp(view.chunk, type_test), version);
+    dualS_set_version(storage, version + 1);
+    EXPECT_EQ(dualS_get_version(storage), version + 1);
+
+    // reads do not stamp
+    dualV_get_owned_ro(&view, type_test);
+    EXPECT_EQ(dualC_get_timestamp(view.chunk, type_test), version);
+
+    // entities constructed into the chunk do
+    dual_chunk_view_t view2;
+    dual_entity_type_t entityType;
+    entityType.type = { &type_test, 1 };
+    entityType.meta = { nullptr, 0 };
+    auto callback = [&](dual_chunk_view_t* inView) { view2 = *inView; };
+    dualS_allocate_type(storage, &entityType, 1, DUAL_LAMBDA(callback));
+    REQUIRE(view2.chunk == view.chunk);
+    EXPECT_EQ(dualC_get_timestamp(view.chunk, type_test), version + 1);
+
+    // and so do writes
+    dualS_set_version(storage, version + 2);
+    dualV_get_owned_rw(&view, type_test);
+    EXPECT_EQ(dualC_get_timestamp(view.chunk, type_test), version + 2);
+}
+
+TEST_CASE_METHOD(ECSTest, "repeated_cast")
+{
+    dual_chunk_view_t view;
+    dual_delta_type_t addType;
+    zero(addType);
+    addType.added = { { &type_test2, 1 } };
+    dual_delta_type_t removeType;
+    zero(removeType);
+    removeType.removed = { { &type_test2, 1 } };
+    dual_delta_type_t swapType;
+    zero(swapType);
+    swapType.removed = { { &type_test2, 1 } };
+    swapType.added = { { &type_test3, 1 } };
+    dual_delta_type_t removeType3;
+    zero(removeType3);
+    removeType3.removed = { { &type_test3, 1 } };
+    // same deltas are resolved from the group transition cache after the first cast
+    for (int i = 0; i < 4; ++i)
+    {
+        dualS_access(storage, e1, &view);
+        dualS_cast_view_delta(storage, &view, &addType, nullptr, nullptr);
+        dualS_access(storage, e1, &view);
+        EXPECT_NE(dualV_get_owned_ro(&view, type_test2), nullptr);
+        dualS_cast_view_delta(storage, &view, &swapType, nullptr, nullptr);
+        dualS_access(storage, e1, &view);
+        EXPECT_EQ(dualV_get_owned_ro(&view, type_test2), nullptr);
+        EXPECT_NE(dualV_get_owned_ro(&view, type_test3), nullptr);
+        dualS_cast_view_delta(storage, &view, &removeType3, nullptr, nullptr);
+        dualS_access(storage, e1, &view);
+        EXPECT_EQ(dualV_get_owned_ro(&view, type_test3), nullptr);
+        EXPECT_NE(dualV_get_owned_ro(&view, type_test), nullptr);
+        // removing a missing component lands in the same group
+        dualS_cast_view_delta(storage, &view, &removeType, nullptr, nullptr);
+    }
+    EXPECT_TRUE(dualS_exist(storage, e1));
+}
+
+TEST_CASE_METHOD(ECSTest, "simd_layout")
+{
+    dual_storage_t* simdStorage = dualS_create();
+    dualS_set_simd_layout(simdStorage, true);
+    dual_type_index_t types[] = { type_test, type_test2 };
+    std::sort(types, types + 2);
+    dual_entity_type_t entityType;
+    entityType.type = { types, 2 };
+    entityType.meta = { nullptr, 0 };
+    auto callback = [&](dual_chunk_view_t* view) {
+        EXPECT_EQ(dualC_get_capacity(view->chunk) % dual::kSimdLaneCount, 0);
+        auto data = (TestComp*)dualV_get_owned_rw(view, type_test);
+        auto data2 = (TestComp*)dualV_get_owned_rw(view, type_test2);
+        EXPECT_EQ(((size_t)(data - view->start)) % dual::kSimdColumnAlignment, 0);
+        EXPECT_EQ(((size_t)(data2 - view->start)) % dual::kSimdColumnAlignment, 0);
+    };
+    dualS_allocate_type(simdStorage, &entityType, 10000, DUAL_LAMBDA(callback));
+    dualS_release(simdStorage);
+}
+
 TEST_CASE_METHOD(ECSTest, "pin")
 {
     dual_entity_t e2;
@@ -346,6 +432,73 @@ TEST_CASE_METHOD(ECSTest, "batch")
     dualS_batch(storage, es.data(), 20, DUAL_LAMBDA(callback2));
 }
 
+TEST_CASE_METHOD(ECSTest, "batch_scattered")
+{
+    dual_chunk_view_t view;
+    {
+        dual_entity_type_t entityType;
+        entityType.type = { &type_test, 1 };
+        entityType.meta = { nullptr, 0 };
+        auto callback = [&](dual_chunk_view_t* inView) {
+            view = *inView;
+            auto t = (TestComp*)dualV_get_owned_rw(inView, type_test);
+            for (EIndex i = 0; i < inView->count; ++i)
+                t[i] = (TestComp)i;
+        };
+        dualS_allocate_type(storage, &entityType, 100, DUAL_LAMBDA(callback));
+    }
+    std::vector<dual_entity_t> all(dualV_get_entities(&view), dualV_get_entities(&view) + 100);
+    // unordered with a duplicate: [40, 50) and [10, 20) reversed, plus 70
+    std::vector<dual_entity_t> es;
+    for (int i = 49; i >= 40; --i)
+        es.push_back(all[i]);
+    es.push_back(all[70]);
+    for (int i = 19; i >= 10; --i)
+        es.push_back(all[i]);
+    es.push_back(all[45]);
+    int n = 0;
+    EIndex total = 0;
+    auto callback = [&](dual_chunk_view_t* inView) {
+        ++n;
+        total += inView->count;
+    };
+    dualS_batch_scattered(storage, es.data(), (EIndex)es.size(), DUAL_LAMBDA(callback));
+    EXPECT_EQ(n, 3);
+    EXPECT_EQ(total, 21);
+
+    SUBCASE("cast")
+    {
+        dual_delta_type_t deltaType;
+        zero(deltaType);
+        deltaType.added = { { &type_test2, 1 } };
+        dualS_cast_entities_delta(storage, es.data(), (EIndex)es.size(), &deltaType, nullptr, nullptr);
+        for (int i = 0; i < 100; ++i)
+        {
+            dual_chunk_view_t v;
+            dualS_access(storage, all[i], &v);
+            const bool casted = (i >= 10 && i < 20) || (i >= 40 && i < 50) || i == 70;
+            EXPECT_EQ(dualV_get_owned_ro(&v, type_test2) != nullptr, casted);
+            EXPECT_EQ(*(const TestComp*)dualV_get_owned_ro(&v, type_test), i);
+        }
+    }
+
+    SUBCASE("destroy")
+    {
+        dualS_destroy_entities(storage, es.data(), (EIndex)es.size());
+        for (int i = 0; i < 100; ++i)
+        {
+            const bool destroyed = (i >= 10 && i < 20) || (i >= 40 && i < 50) || i == 70;
+            EXPECT_EQ((bool)dualS_exist(storage, all[i]), !destroyed);
+            if (!destroyed)
+            {
+                dual_chunk_view_t v;
+                dualS_access(storage, all[i], &v);
+                EXPECT_EQ(*(const TestComp*)dualV_get_owned_ro(&v, type_test), i);
+            }
+        }
+    }
+}
+
 TEST_CASE_METHOD(ECSTest, "filter")
 {
     dual_filter_t filter;
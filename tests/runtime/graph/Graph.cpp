@@ -89,4 +89,210 @@ TEST_CASE_METHOD(GraphTest, "RenderGraphFrontEnd")
     render_graph::RenderPassExecuteFunction());
     render_graph::RenderGraphViz::write_graphviz(*graph, "render_graph.gv");
     render_graph::RenderGraph::destroy(graph);
-}
\ No newline at end of file
+}
+#include "SkrRenderGraph/frontend/render_graph_pipeline.hpp"
+
+TEST_CASE_METHOD(GraphTest, "RenderGraphPipeline")
+{
+    namespace render_graph = skr::render_graph;
+    auto pipeline = render_graph::RenderGraphPipeline::create(
+    [](render_graph::RenderGraphBuilder& builder) {
+        builder.frontend_only();
+    });
+    uint64_t setup_frames[3] = { UINT64_MAX, UINT64_MAX, UINT64_MAX };
+    const auto frame = [&](uint32_t i) {
+        return [&setup_frames, i](render_graph::RenderGraph& g) {
+            setup_frames[i] = g.get_frame_index();
+            g.create_texture(
+            [](render_graph::RenderGraph&, render_graph::TextureBuilder& builder) {
+                builder.set_name(u8"backbuffer")
+                    .extent(1920, 1080)
+                    .format(CGPU_FORMAT_B8G8R8A8_UNORM);
+            });
+        };
+    };
+    // a frame executes one call after it was set up
+    EXPECT_EQ(pipeline->execute(frame(0)), UINT64_MAX);
+    EXPECT_EQ(pipeline->execute(frame(1)), 0);
+    EXPECT_EQ(pipeline->execute(frame(2)), 1);
+    EXPECT_TRUE(pipeline->has_pending_frame());
+    EXPECT_EQ(pipeline->flush(), 2);
+    EXPECT_FALSE(pipeline->has_pending_frame());
+    EXPECT_EQ(pipeline->flush(), UINT64_MAX);
+    // setup sees the index its frame executes with
+    for (uint64_t i = 0; i < 3; i++)
+        EXPECT_EQ(setup_frames[i], i);
+    render_graph::RenderGraphPipeline::destroy(pipeline);
+}
+
+#include "SkrRenderGraph/backend/buffer_pool.hpp"
+#include "SkrRenderGraph/backend/texture_pool.hpp"
+
+// pools only talk to the device through cgpu_create_*/cgpu_free_*, a stub proc table is enough
+struct StubDevice
+{
+    struct Buffer { CGPUBuffer buffer; CGPUBufferInfo info; };
+    struct Texture { CGPUTexture texture; CGPUTextureInfo info; };
+
+    StubDevice()
+    {
+        *(CGPUProcCreateBuffer*)&procs.create_buffer = +[](CGPUDeviceId device, const CGPUBufferDescriptor* desc) -> CGPUBufferId {
+            auto stub = new Buffer();
+            stub->info.size = desc->size;
+            stub->buffer.info = &stub->info;
+            ((StubDevice*)device)->alive++;
+            return &stub->buffer;
+        };
+        *(CGPUProcFreeBuffer*)&procs.free_buffer = +[](CGPUBufferId buffer) {
+            ((StubDevice*)buffer->device)->alive--;
+            delete (Buffer*)buffer;
+        };
+        *(CGPUProcCreateTexture*)&procs.create_texture = +[](CGPUDeviceId device, const CGPUTextureDescriptor* desc) -> CGPUTextureId {
+            auto stub = new Texture();
+            stub->info.width = desc->width;
+            stub->info.height = desc->height;
+            stub->info.size_in_bytes = desc->width * desc->height * 4;
+            stub->texture.info = &stub->info;
+            ((StubDevice*)device)->alive++;
+            return &stub->texture;
+        };
+        *(CGPUProcFreeTexture*)&procs.free_texture = +[](CGPUTextureId texture) {
+            ((StubDevice*)texture->device)->alive--;
+            delete (Texture*)texture;
+        };
+        device.proc_table_cache = &procs;
+    }
+
+    CGPUDevice device; // must stay first, callbacks cast the device back to StubDevice
+    CGPUProcTable procs = {};
+    int32_t alive = 0;
+};
+
+TEST_CASE_METHOD(GraphTest, "BufferPool")
+{
+    using namespace skr::render_graph;
+    StubDevice stub;
+    BufferPool pool;
+    pool.initialize(&stub.device);
+
+    CGPUBufferDescriptor desc = {};
+    desc.descriptors = CGPU_RESOURCE_TYPE_UNIFORM_BUFFER;
+    desc.size = 100;
+    const auto allocated = pool.allocate(desc, { 1, 0 }, UINT64_MAX);
+    const auto buffer = allocated.first;
+    const auto state = allocated.second;
+    REQUIRE(buffer);
+    EXPECT_EQ(buffer->info->size, 128);
+    pool.deallocate(desc, buffer, state, { 1, 0 });
+    pool.deallocate(desc, buffer, state, { 1, 0 }); // multiple edges of a pass release twice
+    EXPECT_EQ(pool.get_pooled_count(), 1);
+    EXPECT_EQ(pool.get_pooled_bytes(), 128);
+
+    SUBCASE("size_class")
+    {
+        // same class is served from the free list, a larger one is not
+        desc.size = 120;
+        auto reused = pool.allocate(desc, { 2, 0 }, UINT64_MAX).first;
+        EXPECT_EQ(reused, buffer);
+        desc.size = 200;
+        auto larger = pool.allocate(desc, { 2, 0 }, UINT64_MAX).first;
+        EXPECT_NE(larger, buffer);
+        EXPECT_EQ(larger->info->size, 256);
+        EXPECT_EQ(pool.get_allocated_bytes(), 128 + 256);
+        EXPECT_EQ(pool.get_pooled_bytes(), 0);
+        pool.deallocate(desc, larger, state, { 2, 0 });
+        desc.size = 120;
+        pool.deallocate(desc, reused, state, { 2, 0 });
+    }
+
+    SUBCASE("in_flight")
+    {
+        // dynamic buffers still used by an unfinished frame are not handed out
+        auto fresh = pool.allocate(desc, { 2, kRenderGraphDynamicResourceTag }, 0).first;
+        EXPECT_NE(fresh, buffer);
+        pool.deallocate(desc, fresh, state, { 2, 0 });
+    }
+
+    SUBCASE("trim")
+    {
+        pool.set_max_idle_frames(10);
+        EXPECT_EQ(pool.trim(5, 5), 0);
+        EXPECT_EQ(pool.trim(20, 0), 0); // not finished on GPU yet
+        EXPECT_EQ(pool.trim(20, 20), 1);
+        EXPECT_EQ(pool.get_allocated_bytes(), 0);
+        EXPECT_EQ(stub.alive, 0);
+    }
+
+    SUBCASE("budget")
+    {
+        desc.size = 1000;
+        auto big = pool.allocate(desc, { 2, 0 }, UINT64_MAX).first;
+        pool.deallocate(desc, big, state, { 2, 0 });
+        EXPECT_EQ(pool.get_allocated_bytes(), 128 + 1024);
+        pool.set_budget(1024);
+        EXPECT_EQ(pool.trim(3, 3), 1); // oldest goes first
+        EXPECT_EQ(pool.get_allocated_bytes(), 1024);
+        EXPECT_EQ(pool.get_pooled_count(), 1);
+    }
+
+    pool.finalize();
+    EXPECT_EQ(stub.alive, 0);
+}
+
+TEST_CASE_METHOD(GraphTest, "TexturePool")
+{
+    using namespace skr::render_graph;
+    StubDevice stub;
+    TexturePool pool;
+    pool.initialize(&stub.device);
+
+    CGPUTextureDescriptor desc = {};
+    desc.width = 16;
+    desc.height = 16;
+    desc.format = CGPU_FORMAT_B8G8R8A8_UNORM;
+    const auto allocated = pool.allocate(desc, { 0, 0 });
+    const auto texture = allocated.first;
+    const auto state = allocated.second;
+    pool.deallocate(desc, texture, state, { 0, 0 });
+    pool.deallocate(desc, texture, state, { 0, 0 });
+    EXPECT_EQ(pool.get_pooled_count(), 1);
+    EXPECT_EQ(pool.allocate(desc, { 1, 0 }).first, texture);
+    pool.deallocate(desc, texture, state, { 1, 0 });
+
+    // resolution change leaves the old texture idle until it ages out
+    desc.width = 32;
+    auto resized = pool.allocate(desc, { 2, 0 }).first;
+    EXPECT_NE(resized, texture);
+    pool.deallocate(desc, resized, state, { 2, 0 });
+
+    uint32_t released = 0;
+    pool.set_max_idle_frames(4);
+    EXPECT_EQ(pool.trim(4, 4, [&](CGPUTextureId) { released++; }), 0);
+    EXPECT_EQ(pool.trim(6, 6, [&](CGPUTextureId t) { EXPECT_EQ(t, texture); released++; }), 1);
+    EXPECT_EQ(released, 1);
+    EXPECT_EQ(pool.get_allocated_bytes(), 32 * 16 * 4);
+
+    SUBCASE("budget")
+    {
+        // idle textures are released oldest first until the pool fits, in-flight ones are kept
+        desc.width = 16;
+        auto small = pool.allocate(desc, { 7, 0 }).first;
+        pool.deallocate(desc, small, state, { 7, 0 });
+        desc.width = 64;
+        auto large = pool.allocate(desc, { 8, 0 }).first;
+        pool.deallocate(desc, large, state, { 8, 0 });
+        EXPECT_EQ(pool.get_allocated_bytes(), (32 + 16 + 64) * 16 * 4);
+        pool.set_budget(64 * 16 * 4);
+        EXPECT_EQ(pool.trim(8, 7, [&](CGPUTextureId t) { EXPECT_NE(t, large); }), 2);
+        EXPECT_EQ(pool.get_allocated_bytes(), 64 * 16 * 4);
+        EXPECT_EQ(pool.get_pooled_bytes(), 64 * 16 * 4);
+        pool.set_budget(1);
+        EXPECT_EQ(pool.trim(8, 7, [&](CGPUTextureId) {}), 0); // frame 8 is still on the GPU
+        EXPECT_EQ(pool.trim(9, 8, [&](CGPUTextureId) {}), 1);
+        EXPECT_EQ(pool.get_allocated_bytes(), 0);
+        EXPECT_EQ(stub.alive, 0);
+    }
+
+    pool.finalize();
+    EXPECT_EQ(stub.alive, 0);
+}
@@ -0,0 +1,177 @@
+#include "cgpu/api.h"
+#include "SkrRenderGraph/frontend/render_graph_pipeline.hpp"
+
+#include "SkrTestFramework/framework.hpp"
+
+#include <vector>
+
+// runs RenderGraphPipeline on a real device, the second graph borrows the backend of the first one
+template <ECGPUBackend backend>
+class RenderGraphPipelineTest
+{
+protected:
+    RenderGraphPipelineTest()
+    {
+        DECLARE_ZERO(CGPUInstanceDescriptor, desc)
+        desc.backend = backend;
+        desc.enable_debug_layer = true;
+        desc.enable_gpu_based_validation = false;
+        desc.enable_set_name = true;
+        instance = cgpu_create_instance(&desc);
+        EXPECT_NE(instance, CGPU_NULLPTR);
+
+        uint32_t adapters_count = 0;
+        cgpu_enum_adapters(instance, nullptr, &adapters_count);
+        std::vector<CGPUAdapterId> adapters;
+        adapters.resize(adapters_count);
+        cgpu_enum_adapters(instance, adapters.data(), &adapters_count);
+        for (auto a : adapters)
+        {
+            if (!cgpu_query_queue_count(a, CGPU_QUEUE_TYPE_GRAPHICS))
+                continue;
+            CGPUQueueGroupDescriptor queue_group = { CGPU_QUEUE_TYPE_GRAPHICS, 1 };
+            DECLARE_ZERO(CGPUDeviceDescriptor, descriptor)
+            descriptor.queue_groups = &queue_group;
+            descriptor.queue_group_count = 1;
+            device = cgpu_create_device(a, &descriptor);
+            gfx_queue = cgpu_get_queue(device, CGPU_QUEUE_TYPE_GRAPHICS, 0);
+            break;
+        }
+        REQUIRE(device);
+        REQUIRE(gfx_queue);
+    }
+
+    ~RenderGraphPipelineTest()
+    {
+        cgpu_free_queue(gfx_queue);
+        cgpu_free_device(device);
+        cgpu_free_instance(instance);
+    }
+
+    struct FrameRecord {
+        uint64_t setup_frame = UINT64_MAX;
+        uint64_t executed_frame = UINT64_MAX;
+        skr::render_graph::RenderGraph* graph = nullptr;
+        CGPUCommandBufferId cmd = nullptr;
+        CGPUBufferId src = nullptr;
+        CGPUBufferId dst = nullptr;
+    };
+
+    skr::render_graph::RenderGraphPipeline* create_pipeline()
+    {
+        return skr::render_graph::RenderGraphPipeline::create(
+        [this](skr::render_graph::RenderGraphBuilder& builder) {
+            builder.with_device(device)
+                .with_gfx_queue(gfx_queue)
+                .backend_api(backend);
+        });
+    }
+
+    // a lone copy pass between two pooled buffers of different size classes, its executor records where the frame ran
+    static skr::render_graph::RenderGraphPipeline::FrameSetupFunction frame(FrameRecord* record)
+    {
+        namespace render_graph = skr::render_graph;
+        return [record](render_graph::RenderGraph& g) {
+            record->setup_frame = g.get_frame_index();
+            auto src = g.create_buffer(
+            [](render_graph::RenderGraph&, render_graph::BufferBuilder& builder) {
+                builder.set_name(u8"src")
+                    .size(1024)
+                    .memory_usage(CGPU_MEM_USAGE_GPU_ONLY);
+            });
+            auto dst = g.create_buffer(
+            [](render_graph::RenderGraph&, render_graph::BufferBuilder& builder) {
+                builder.set_name(u8"dst")
+                    .size(4096)
+                    .memory_usage(CGPU_MEM_USAGE_GPU_ONLY);
+            });
+            g.add_copy_pass(
+            [=](render_graph::RenderGraph&, render_graph::CopyPassBuilder& builder) {
+                builder.set_name(u8"copy")
+                    .buffer_to_buffer(src.range(0, 1024), dst.range(0, 1024))
+                    .can_be_lone();
+            },
+            [record, src, dst](render_graph::RenderGraph& g, render_graph::CopyPassContext& context) {
+                record->executed_frame = g.get_frame_index();
+                record->graph = &g;
+                record->cmd = context.cmd;
+                record->src = context.resolve(src);
+                record->dst = context.resolve(dst);
+            });
+        };
+    }
+
+    void test_all();
+
+    CGPUInstanceId instance = nullptr;
+    CGPUDeviceId device = nullptr;
+    CGPUQueueId gfx_queue = nullptr;
+};
+
+template <ECGPUBackend backend>
+void RenderGraphPipelineTest<backend>::test_all()
+{
+    namespace render_graph = skr::render_graph;
+    // odd in flight count, so frames on both graphs land on every executor
+    static constexpr uint32_t kFrames = 2 * RG_MAX_FRAME_IN_FLIGHT + 1;
+
+    SUBCASE("SharedBackend")
+    {
+        auto pipeline = create_pipeline();
+        FrameRecord records[kFrames];
+        for (uint32_t i = 0; i < kFrames; i++)
+        {
+            const auto executed = pipeline->execute(frame(&records[i]));
+            EXPECT_EQ(executed, i ? i - 1 : UINT64_MAX);
+        }
+        EXPECT_EQ(pipeline->flush(), kFrames - 1);
+
+        // both graphs run on the frame counter of the primary one
+        EXPECT_EQ(pipeline->get_primary()->get_frame_index(), kFrames);
+        EXPECT_NE(records[0].graph, records[1].graph);
+        EXPECT_EQ(records[0].graph, pipeline->get_primary());
+        for (uint32_t i = 0; i < kFrames; i++)
+        {
+            EXPECT_EQ(records[i].setup_frame, i);
+            EXPECT_EQ(records[i].executed_frame, i);
+            EXPECT_EQ(records[i].graph, records[i % 2].graph);
+            // executors are borrowed, a frame records into the one of its index whichever graph runs it
+            EXPECT_EQ(records[i].cmd, records[i % RG_MAX_FRAME_IN_FLIGHT].cmd);
+            // pools are shared, the buffers released by a frame are taken by the next one on the other graph
+            EXPECT_EQ(records[i].src, records[0].src);
+            EXPECT_EQ(records[i].dst, records[0].dst);
+        }
+        EXPECT_NE(records[0].cmd, records[1].cmd);
+        EXPECT_NE(records[0].src, records[0].dst);
+
+        cgpu_wait_queue_idle(gfx_queue);
+        render_graph::RenderGraphPipeline::destroy(pipeline);
+    }
+
+    SUBCASE("DestroyPending")
+    {
+        // destroy executes the pending frame and waits for it before the borrower and then the owner are finalized
+        auto pipeline = create_pipeline();
+        FrameRecord records[2];
+        EXPECT_EQ(pipeline->execute(frame(&records[0])), UINT64_MAX);
+        EXPECT_EQ(pipeline->execute(frame(&records[1])), 0);
+        EXPECT_TRUE(pipeline->has_pending_frame());
+        render_graph::RenderGraphPipeline::destroy(pipeline);
+        EXPECT_EQ(records[1].executed_frame, 1);
+        EXPECT_NE(records[1].graph, records[0].graph);
+    }
+}
+
+#ifdef CGPU_USE_D3D12
+TEST_CASE_METHOD(RenderGraphPipelineTest<CGPU_BACKEND_D3D12>, "RenderGraphPipeline-d3d12")
+{
+    test_all();
+}
+#endif
+
+#ifdef CGPU_USE_VULKAN
+TEST_CASE_METHOD(RenderGraphPipelineTest<CGPU_BACKEND_VULKAN>, "RenderGraphPipeline-vulkan")
+{
+    test_all();
+}
+#endif
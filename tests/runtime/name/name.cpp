@@ -0,0 +1,70 @@
+#include "SkrRT/containers/name.hpp"
+#include "SkrRT/containers/hashmap.hpp"
+
+#include "SkrTestFramework/framework.hpp"
+
+class NameTests
+{
+
+};
+
+TEST_CASE_METHOD(NameTests, "Intern")
+{
+    skr::Name a = u8"GBuffer";
+    skr::string s = u8"GBuffer";
+    skr::Name b = s;
+    skr::Name c = skr::string_view(u8"GBufferDepth", 7);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a, c);
+    EXPECT_EQ(a.u8_str(), b.u8_str());
+    EXPECT_EQ(a.size(), 7);
+    EXPECT_EQ(a.hash(), skr::hash_crc32(std::basic_string_view<char8_t>(u8"GBuffer")));
+    EXPECT_NE(a, skr::Name(u8"GBufferDepth"));
+}
+
+TEST_CASE_METHOD(NameTests, "Empty")
+{
+    skr::Name empty;
+    EXPECT_TRUE(empty.is_empty());
+    EXPECT_EQ(empty, skr::Name(u8""));
+    EXPECT_EQ(empty, skr::Name(nullptr));
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_EQ(empty.u8_str()[0], 0);
+}
+
+TEST_CASE_METHOD(NameTests, "Literal")
+{
+    constexpr skr::NameLiteral literal = u8"ShadowMap";
+    static_assert(literal.size == 9, "literal size is folded");
+    static_assert(literal.hash == skr::hash_crc32(std::basic_string_view<char8_t>(u8"ShadowMap")), "literal hash is folded");
+    const skr::Name& n = SKR_NAME(u8"ShadowMap");
+    EXPECT_EQ(n, skr::Name(u8"ShadowMap"));
+    EXPECT_EQ(SKR_NAME(u8"ShadowMap"), n);
+}
+
+TEST_CASE_METHOD(NameTests, "Find")
+{
+    EXPECT_TRUE(skr::Name::Find(u8"NameTests.NeverInterned").is_empty());
+    skr::Name interned = u8"NameTests.Interned";
+    EXPECT_EQ(skr::Name::Find(u8"NameTests.Interned"), interned);
+}
+
+TEST_CASE_METHOD(NameTests, "Grow")
+{
+    // enough names to grow every shard a few times
+    skr::flat_hash_map<skr::Name, uint32_t, skr::hash<skr::Name>> names;
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        auto str = skr::format(u8"name_{}", i);
+        names.emplace(skr::Name(str), i);
+    }
+    EXPECT_EQ(names.size(), 20000);
+    for (uint32_t i = 0; i < 20000; i += 97)
+    {
+        auto str = skr::format(u8"name_{}", i);
+        auto found = skr::Name::Find(str.u8_str());
+        REQUIRE(!found.is_empty());
+        EXPECT_EQ(names[found], i);
+        EXPECT_EQ(found.view(), str.view());
+    }
+}
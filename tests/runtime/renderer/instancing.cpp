@@ -0,0 +1,139 @@
+#include "SkrRenderer/render_instancing.h"
+
+#include "SkrTestFramework/framework.hpp"
+
+#include <string.h>
+
+class InstancingTests
+{
+protected:
+    // 12 bytes per instance, so a second group has to be padded to the 16 bytes alignment
+    struct Payload {
+        float x, y, z;
+    };
+    static constexpr uint32_t kStride = sizeof(Payload);
+
+    InstancingTests()
+    {
+        instancing = SRenderInstancing::Create();
+        vbvs[0] = { (CGPUBufferId)0x10, 0, 12 };
+        vbvs[1] = { (CGPUBufferId)0x10, 0, 12 };
+        vbvs[2] = { (CGPUBufferId)0x10, 64, 12 };
+    }
+
+    ~InstancingTests()
+    {
+        SRenderInstancing::Free(instancing);
+    }
+
+    skr_primitive_draw_t Draw(uintptr_t pipeline, const skr_vertex_buffer_view_t* vbv, const Payload* payload)
+    {
+        skr_primitive_draw_t draw = {};
+        draw.pipeline = (CGPURenderPipelineId)pipeline;
+        draw.vertex_buffers = vbv;
+        draw.vertex_buffer_count = 1;
+        draw.index_buffer = { (CGPUBufferId)0x20, 0, 2, 36, 0 };
+        draw.instance_data = (const uint8_t*)payload;
+        draw.instance_stride = payload ? kStride : 0;
+        return draw;
+    }
+
+    void Merge(skr::span<skr_primitive_draw_t> draws)
+    {
+        skr_primitive_draw_list_view_t list = { draws.data(), (uint32_t)draws.size(), nullptr };
+        skr_primitive_draw_packet_t packet = { &list, 1, nullptr };
+        instancing->merge(kPass, { &packet, 1 });
+    }
+
+    bool HasPayload(uint32_t offset, const Payload& payload) const
+    {
+        const auto data = instancing->get_instance_data(kPass);
+        return offset + kStride <= data.size() && !memcmp(data.data() + offset, &payload, kStride);
+    }
+
+    static constexpr const char8_t* kPass = u8"InstancingTests";
+    SRenderInstancing* instancing = nullptr;
+    skr_vertex_buffer_view_t vbvs[3];
+    Payload payloads[6] = {
+        { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f }, { 2.f, 2.f, 2.f },
+        { 3.f, 3.f, 3.f }, { 4.f, 4.f, 4.f }, { 5.f, 5.f, 5.f }
+    };
+};
+
+TEST_CASE_METHOD(InstancingTests, "Grouping")
+{
+    skr_primitive_draw_t draws[] = {
+        Draw(1, &vbvs[0], &payloads[0]),
+        Draw(2, &vbvs[0], &payloads[1]),
+        // equal views in another array still share the geometry
+        Draw(1, &vbvs[1], &payloads[2]),
+        // same buffer at another offset is other geometry
+        Draw(1, &vbvs[2], &payloads[3]),
+        Draw(1, &vbvs[0], &payloads[4]),
+    };
+    Merge(draws);
+
+    // the first draw of a group carries it, in submission order, the others are dropped
+    EXPECT_EQ(draws[0].instance_count, 3);
+    EXPECT_FALSE(draws[0].desperated);
+    EXPECT_TRUE(draws[2].desperated);
+    EXPECT_TRUE(draws[4].desperated);
+    EXPECT_TRUE(HasPayload(draws[0].instance_offset, payloads[0]));
+    EXPECT_TRUE(HasPayload(draws[0].instance_offset + kStride, payloads[2]));
+    EXPECT_TRUE(HasPayload(draws[0].instance_offset + 2 * kStride, payloads[4]));
+
+    EXPECT_EQ(draws[1].instance_count, 1);
+    EXPECT_FALSE(draws[1].desperated);
+    EXPECT_TRUE(HasPayload(draws[1].instance_offset, payloads[1]));
+    EXPECT_EQ(draws[3].instance_count, 1);
+    EXPECT_FALSE(draws[3].desperated);
+    EXPECT_TRUE(HasPayload(draws[3].instance_offset, payloads[3]));
+}
+
+TEST_CASE_METHOD(InstancingTests, "Alignment")
+{
+    skr_primitive_draw_t draws[] = {
+        Draw(1, &vbvs[0], &payloads[0]),
+        Draw(1, &vbvs[0], &payloads[1]),
+        Draw(1, &vbvs[0], &payloads[2]),
+        Draw(2, &vbvs[0], &payloads[3]),
+        Draw(3, &vbvs[0], &payloads[4]),
+    };
+    Merge(draws);
+
+    // 3 x 12 bytes are padded to 48, every group starts on 16 bytes
+    for (const auto& draw : draws)
+    {
+        if (draw.desperated) continue;
+        EXPECT_EQ(draw.instance_offset % 16, 0);
+    }
+    EXPECT_EQ(draws[0].instance_offset, 0);
+    EXPECT_EQ(draws[3].instance_offset, 48);
+    EXPECT_EQ(draws[4].instance_offset, 64);
+    EXPECT_EQ(instancing->get_instance_data(kPass).size(), 64 + kStride);
+}
+
+TEST_CASE_METHOD(InstancingTests, "Skipped")
+{
+    skr_primitive_draw_t draws[] = {
+        Draw(1, &vbvs[0], &payloads[0]),
+        // without instance data
+        Draw(1, &vbvs[0], nullptr),
+        // already dropped by an earlier stage
+        Draw(1, &vbvs[0], &payloads[1]),
+    };
+    draws[2].desperated = true;
+    draws[1].instance_count = 7;
+    Merge(draws);
+
+    EXPECT_EQ(draws[0].instance_count, 1);
+    EXPECT_FALSE(draws[1].desperated);
+    EXPECT_EQ(draws[1].instance_count, 0);
+    EXPECT_EQ(draws[2].instance_count, 0);
+    EXPECT_EQ(instancing->get_instance_data(kPass).size(), kStride);
+
+    // a merge without candidates leaves nothing of the previous one
+    Merge({ draws + 1, 1 });
+    EXPECT_EQ(instancing->get_instance_data(kPass).size(), 0);
+    EXPECT_EQ(instancing->get_instance_data(u8"UnknownPass").size(), 0);
+}
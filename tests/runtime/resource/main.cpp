@@ -0,0 +1,255 @@
+#include "SkrRT/platform/vfs.h"
+#include "SkrRT/platform/crash.h"
+#include "SkrRT/platform/guid.hpp"
+#include "SkrRT/misc/log.h"
+#include "SkrRT/async/wait_timeout.hpp"
+#include "SkrRT/io/ram_io.hpp"
+#include "SkrRT/resource/local_resource_registry.hpp"
+#include "SkrRT/resource/resource_bundle.hpp"
+#include "SkrRT/serde/binary/writer.h"
+
+#include "SkrTestFramework/framework.hpp"
+
+static struct ProcInitializer
+{
+    ProcInitializer()
+    {
+        ::skr_log_set_level(SKR_LOG_LEVEL_WARN);
+        ::skr_initialize_crash_handler();
+        ::skr_log_initialize_async_worker();
+    }
+    ~ProcInitializer()
+    {
+        ::skr_log_finalize_async_worker();
+        ::skr_finalize_crash_handler();
+    }
+} init;
+
+// stands in for the resource system's request, only records what the registry reports back
+struct ResourceTestRequest : public skr::resource::SResourceRequest {
+    ResourceTestRequest(skr_guid_t guid) : guid(guid) {}
+
+    skr_guid_t GetGuid() const override { return guid; }
+    skr::span<const uint8_t> GetData() const override { return {}; }
+#ifdef SKR_RESOURCE_DEV_MODE
+    skr::span<const uint8_t> GetArtifactsData() const override { return {}; }
+#endif
+    skr::span<const skr_guid_t> GetDependencies() const override { return {}; }
+
+    void UpdateLoad(bool requestInstall) override {}
+    void UpdateUnload() override {}
+    void Update() override {}
+
+    bool Okay() override { return false; }
+    bool Yielded() override { return false; }
+    bool Failed() override { return false; }
+    bool AsyncSerde() override { return false; }
+
+    void OnRequestFileFinished() override { file_finished++; }
+    void OnRequestLoadFinished() override {}
+
+    void LoadTask() override {}
+
+protected:
+    void _LoadDependencies() override {}
+    void _UnloadDependencies() override {}
+    void _LoadFinished() override {}
+    void _InstallFinished() override {}
+    void _UnloadResource() override {}
+
+public:
+    skr_guid_t guid;
+    uint32_t file_finished = 0;
+};
+
+struct ResourceTest
+{
+    ResourceTest()
+    {
+        skr_vfs_desc_t abs_fs_desc = {};
+        abs_fs_desc.app_name = u8"resource-test";
+        abs_fs_desc.mount_type = SKR_MOUNT_TYPE_ABSOLUTE;
+        abs_fs = skr_create_vfs(&abs_fs_desc);
+        REQUIRE(abs_fs != nullptr);
+
+        skr_ram_io_service_desc_t ioServiceDesc = {};
+        ioServiceDesc.name = u8"ResourceTest";
+        ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+        ioService->run();
+    }
+
+    ~ResourceTest()
+    {
+        skr_io_ram_service_t::destroy(ioService);
+        skr_free_vfs(abs_fs);
+    }
+
+    skr_vfs_t* abs_fs = nullptr;
+    skr_io_ram_service_t* ioService = nullptr;
+};
+
+TEST_CASE_METHOD(ResourceTest, "MissingHeader")
+{
+    using namespace skr::guid::literals;
+    ResourceTestRequest request = u8"2a6b7e8d-3c1f-4a2b-9e5d-0f1e2d3c4b5a"_guid;
+    auto registry = SkrNew<skr::resource::SLocalResourceRegistry>(abs_fs, ioService);
+    // the header read is queued and only goes out with the next update
+    EXPECT_TRUE(registry->RequestResourceFile(&request));
+    EXPECT_EQ(request.file_finished, 0);
+
+    // the missing .rh fails the io request with an empty buffer, the registry reports the request as finished without a url
+    wait_timeout([&]() -> bool {
+        registry->Update();
+        return request.file_finished != 0;
+    });
+    EXPECT_EQ(request.file_finished, 1);
+    SkrDelete(registry);
+}
+
+static skr::resource::SResourceBundleIndex MakeBundleIndex()
+{
+    using namespace skr::guid::literals;
+    skr::resource::SResourceBundleIndex index;
+    index.bundle_uri = u8"resource-test.bundle";
+    const skr_guid_t guids[] = {
+        u8"6f0c3b1e-8a4d-4e2f-b1c7-2d9e5a3f7c10"_guid,
+        u8"0b7d2e4a-5c6f-4f1e-8d3a-9c2b1e0f4a6d"_guid, // empty payload
+        u8"d41e9a6c-2b3f-4c5d-a8e7-1f0b6c2d3e4f"_guid,
+    };
+    const uint64_t sizes[] = { 100, 0, 5000 };
+    uint64_t offset = 0;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        skr::resource::SResourceBundleEntry entry;
+        entry.header.version = 1;
+        entry.header.guid = guids[i];
+        entry.header.type = guids[i];
+        entry.offset = offset;
+        entry.size = sizes[i];
+        index.entries.emplace_back(entry);
+        offset = (offset + sizes[i] + index.alignment - 1) & ~(uint64_t)(index.alignment - 1);
+    }
+    return index;
+}
+
+TEST_CASE_METHOD(ResourceTest, "BundleIndexRoundTrip")
+{
+    const auto index = MakeBundleIndex();
+    eastl::vector<uint8_t> buffer;
+    index.Write(buffer);
+
+    skr::resource::SResourceBundleIndex read;
+    REQUIRE(read.Read({ buffer.data(), buffer.size() }));
+    EXPECT_EQ(read.bundle_uri, index.bundle_uri);
+    EXPECT_EQ(read.alignment, index.alignment);
+    REQUIRE(read.entries.size() == index.entries.size());
+    for (uint32_t i = 0; i < index.entries.size(); i++)
+    {
+        EXPECT_EQ(read.entries[i].header.guid, index.entries[i].header.guid);
+        EXPECT_EQ(read.entries[i].header.type, index.entries[i].header.type);
+        EXPECT_EQ(read.entries[i].header.version, index.entries[i].header.version);
+        EXPECT_EQ(read.entries[i].offset, index.entries[i].offset);
+        EXPECT_EQ(read.entries[i].size, index.entries[i].size);
+    }
+
+    // truncated
+    EXPECT_FALSE(read.Read({ buffer.data(), buffer.size() - 1 }));
+    // misaligned entry
+    {
+        auto misaligned = index;
+        misaligned.entries[2].offset += 1;
+        eastl::vector<uint8_t> misalignedBuffer;
+        misaligned.Write(misalignedBuffer);
+        EXPECT_FALSE(read.Read({ misalignedBuffer.data(), misalignedBuffer.size() }));
+    }
+    // alignment that is not a power of two
+    {
+        auto odd = index;
+        odd.alignment = 3;
+        for (auto& entry : odd.entries)
+            entry.offset = 0;
+        eastl::vector<uint8_t> oddBuffer;
+        odd.Write(oddBuffer);
+        EXPECT_FALSE(read.Read({ oddBuffer.data(), oddBuffer.size() }));
+    }
+    // entry count far beyond the data, rejected before anything is reserved
+    {
+        namespace bin = skr::binary;
+        eastl::vector<uint8_t> hugeBuffer;
+        bin::VectorWriter writer{&hugeBuffer};
+        skr_binary_writer_t archive(writer);
+        bin::Write(&archive, skr::resource::SResourceBundleIndex::kMagic);
+        bin::Write(&archive, skr::resource::SResourceBundleIndex::kVersion);
+        bin::Write(&archive, index.bundle_uri);
+        bin::Write(&archive, index.alignment);
+        bin::Write(&archive, UINT32_MAX);
+        EXPECT_FALSE(read.Read({ hugeBuffer.data(), hugeBuffer.size() }));
+    }
+}
+
+TEST_CASE_METHOD(ResourceTest, "BundledResolution")
+{
+    using namespace skr::guid::literals;
+    const auto index = MakeBundleIndex();
+    {
+        eastl::vector<uint8_t> buffer;
+        index.Write(buffer);
+        auto file = skr_vfs_fopen(abs_fs, u8"resource-test.bundle.idx", SKR_FM_WRITE_BINARY, SKR_FILE_CREATION_ALWAYS_NEW);
+        REQUIRE(file != nullptr);
+        EXPECT_EQ(skr_vfs_fwrite(file, buffer.data(), 0, buffer.size()), buffer.size());
+        skr_vfs_fclose(file);
+    }
+
+    auto registry = SkrNew<skr::resource::SLocalResourceRegistry>(abs_fs, ioService);
+    EXPECT_FALSE(registry->LoadBundleIndex(u8"resource-test.missing.bundle.idx"));
+    REQUIRE(registry->LoadBundleIndex(u8"resource-test.bundle.idx"));
+    for (const auto& entry : index.entries)
+    {
+        const auto location = registry->ResolveLocation(entry.header.guid);
+        EXPECT_EQ(location.uri, index.bundle_uri);
+        EXPECT_EQ(location.offset, entry.offset);
+        // an empty payload keeps its explicit size instead of reading the rest of the bundle
+        EXPECT_EQ(location.size, entry.size);
+    }
+
+    // resources outside the bundle still come from their loose files
+    const auto loose = u8"9e8d7c6b-5a4f-4e3d-b2c1-0a9b8c7d6e5f"_guid;
+    const auto location = registry->ResolveLocation(loose);
+    EXPECT_EQ(location.uri, skr::format(u8"{}.bin", loose));
+    EXPECT_EQ(location.offset, 0);
+    EXPECT_EQ(location.size, skr::resource::SResourceRegistry::kReadToEnd);
+    SkrDelete(registry);
+}
+
+TEST_CASE_METHOD(ResourceTest, "HeaderIndexRoundTrip")
+{
+    const auto index = MakeBundleIndex();
+    {
+        eastl::vector<uint8_t> buffer;
+        index.Write(buffer);
+        auto file = skr_vfs_fopen(abs_fs, u8"resource-test.bundle.idx", SKR_FM_WRITE_BINARY, SKR_FILE_CREATION_ALWAYS_NEW);
+        REQUIRE(file != nullptr);
+        EXPECT_EQ(skr_vfs_fwrite(file, buffer.data(), 0, buffer.size()), buffer.size());
+        skr_vfs_fclose(file);
+    }
+    {
+        // the bundle index fills the header cache, save it as a plain header index
+        auto registry = SkrNew<skr::resource::SLocalResourceRegistry>(abs_fs, ioService);
+        REQUIRE(registry->LoadBundleIndex(u8"resource-test.bundle.idx"));
+        EXPECT_TRUE(registry->SaveHeaderIndex(u8"resource-test.header.idx"));
+        SkrDelete(registry);
+    }
+
+    auto registry = SkrNew<skr::resource::SLocalResourceRegistry>(abs_fs, ioService);
+    EXPECT_FALSE(registry->LoadHeaderIndex(u8"resource-test.missing.header.idx"));
+    EXPECT_FALSE(registry->LoadHeaderIndex(u8"resource-test.bundle.idx")); // wrong magic
+    REQUIRE(registry->LoadHeaderIndex(u8"resource-test.header.idx"));
+    for (const auto& entry : index.entries)
+    {
+        // indexed headers are served from the cache, no .rh is read and no update is needed
+        ResourceTestRequest request = entry.header.guid;
+        EXPECT_TRUE(registry->RequestResourceFile(&request));
+        EXPECT_EQ(request.file_finished, 1);
+    }
+    SkrDelete(registry);
+}
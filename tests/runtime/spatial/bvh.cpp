@@ -0,0 +1,111 @@
+#include "SkrScene/spatial.h"
+
+#include "SkrTestFramework/framework.hpp"
+
+class DynamicBVHTests
+{
+protected:
+    static skr::scene::AABB Box(float x, float y, float z, float e = 0.5f)
+    {
+        return { { x - e, y - e, z - e }, { x + e, y + e, z + e } };
+    }
+
+    // 16 x 16 grid of unit boxes on the xz plane, entity i at (2 * (i % 16), 0, 2 * (i / 16))
+    void Fill()
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+            proxies[i] = bvh.create_proxy(Box(2.f * (i % 16), 0.f, 2.f * (i / 16)), i);
+    }
+
+    uint32_t CountAABB(const skr::scene::AABB& aabb)
+    {
+        uint32_t count = 0;
+        bvh.query_aabb(aabb, [&](dual_entity_t) { count++; return true; });
+        return count;
+    }
+
+    skr::scene::DynamicBVH bvh;
+    skr::scene::DynamicBVH::ProxyId proxies[256];
+};
+
+TEST_CASE_METHOD(DynamicBVHTests, "Insert")
+{
+    Fill();
+    EXPECT_EQ(bvh.get_proxy_count(), 256);
+    EXPECT_TRUE(bvh.validate());
+    // rotations keep the tree close to log2(256)
+    EXPECT_TRUE(bvh.get_height() <= 16);
+    EXPECT_EQ(CountAABB(Box(0.f, 0.f, 0.f, 0.1f)), 1);
+    EXPECT_EQ(CountAABB(Box(3.f, 0.f, 3.f, 1.6f)), 4);
+    EXPECT_EQ(CountAABB(Box(100.f, 0.f, 0.f)), 0);
+
+    for (uint32_t i = 0; i < 256; i += 2)
+        bvh.destroy_proxy(proxies[i]);
+    EXPECT_EQ(bvh.get_proxy_count(), 128);
+    EXPECT_TRUE(bvh.validate());
+    EXPECT_EQ(CountAABB(Box(0.f, 0.f, 0.f, 0.1f)), 0);
+    EXPECT_EQ(CountAABB(Box(3.f, 0.f, 3.f, 1.6f)), 2);
+}
+
+TEST_CASE_METHOD(DynamicBVHTests, "Move")
+{
+    Fill();
+    // small motions stay inside the fat bounds and only update the leaf
+    EXPECT_TRUE(!bvh.move_proxy(proxies[0], Box(0.05f, 0.f, 0.f), { 0.05f, 0.f, 0.f }));
+    EXPECT_TRUE(bvh.move_proxy(proxies[0], Box(50.f, 0.f, 0.f), { 49.95f, 0.f, 0.f }));
+    EXPECT_TRUE(bvh.validate());
+    EXPECT_EQ(CountAABB(Box(0.f, 0.f, 0.f, 0.1f)), 0);
+    EXPECT_EQ(CountAABB(Box(50.f, 0.f, 0.f, 0.1f)), 1);
+}
+
+TEST_CASE_METHOD(DynamicBVHTests, "Rebuild")
+{
+    Fill();
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        bvh.rebuild_partial(32);
+        REQUIRE(bvh.validate());
+    }
+    bvh.rebuild_full();
+    EXPECT_TRUE(bvh.validate());
+    EXPECT_EQ(bvh.get_proxy_count(), 256);
+    EXPECT_TRUE(bvh.get_height() <= 12);
+    EXPECT_EQ(CountAABB(Box(3.f, 0.f, 3.f, 1.6f)), 4);
+}
+
+TEST_CASE_METHOD(DynamicBVHTests, "Queries")
+{
+    Fill();
+    skr::scene::RayHit hit;
+    skr::scene::Ray ray = { { -10.f, 0.f, 2.f }, { 1.f, 0.f, 0.f } };
+    REQUIRE(bvh.raycast(ray, hit));
+    EXPECT_EQ(hit.entity, 16);
+    EXPECT_TRUE(fabsf(hit.distance - 9.5f) < 1e-4f);
+    ray.max_distance = 5.f;
+    EXPECT_TRUE(!bvh.raycast(ray, hit));
+
+    uint32_t count = 0;
+    bvh.query_sphere({ { 0.f, 0.f, 0.f }, 2.f }, [&](dual_entity_t) { count++; return true; });
+    // the origin box and its two direct neighbours
+    EXPECT_EQ(count, 3);
+
+    // visitors stop the query
+    count = 0;
+    bvh.query_aabb(Box(15.f, 0.f, 15.f, 100.f), [&](dual_entity_t) { return ++count < 10; });
+    EXPECT_EQ(count, 10);
+
+    skr::scene::Frustum frustum;
+    // x in [0, 4.6] and x in [0, 0.6] as box shaped frustums
+    frustum.planes[0] = { 1.f, 0.f, 0.f, 0.f };
+    frustum.planes[1] = { -1.f, 0.f, 0.f, 4.6f };
+    frustum.planes[2] = { 0.f, 1.f, 0.f, 100.f };
+    frustum.planes[3] = { 0.f, -1.f, 0.f, 100.f };
+    frustum.planes[4] = { 0.f, 0.f, 1.f, 100.f };
+    frustum.planes[5] = { 0.f, 0.f, -1.f, 100.f };
+    skr::scene::Frustum frustums[2] = { frustum, frustum };
+    frustums[1].planes[1].w = 0.6f;
+    skr::vector<dual_entity_t> results[2];
+    bvh.query_frustum_batch(frustums, results);
+    EXPECT_EQ(results[0].size(), 3 * 16);
+    EXPECT_EQ(results[1].size(), 16);
+}
@@ -8,6 +8,7 @@
 #include "SkrRT/async/thread_job.hpp"
 #include "SkrRT/async/wait_timeout.hpp"
 #include "SkrRT/io/ram_io.hpp"
+#include "SkrRT/io/io_trace.hpp"
 
 #include <string>
 
@@ -128,6 +129,76 @@ SUBCASE("seqread")
     EXPECT_EQ(skr_vfs_fclose(f), true);
 }
 
+SUBCASE("sharedread")
+{
+    ZoneScopedN("sharedread");
+
+    // read-only handles of one path may share a descriptor, positional reads must not interfere
+    auto f = skr_vfs_fopen(abs_fs, u8"testfile2", SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+    auto f2 = skr_vfs_fopen(abs_fs, u8"testfile2", (ESkrFileMode)(SKR_FM_READ_BINARY | SKR_FM_SEQUENTIAL), SKR_FILE_CREATION_OPEN_EXISTING);
+    REQUIRE(f != nullptr);
+    REQUIRE(f2 != nullptr);
+    char8_t string_out[256];
+    char8_t string_out2[256];
+    std::memset((void*)string_out, 0, 256);
+    std::memset((void*)string_out2, 0, 256);
+    skr_vfs_fread(f, string_out, 7, 6);
+    skr_vfs_fread(f2, string_out2, 0, 5);
+    EXPECT_EQ(std::string((const char*)string_out), std::string("World2"));
+    EXPECT_EQ(std::string((const char*)string_out2), std::string("Hello"));
+    EXPECT_EQ(skr_vfs_fclose(f), true);
+    std::memset((void*)string_out2, 0, 256);
+    skr_vfs_fread(f2, string_out2, 0, 256);
+    EXPECT_EQ(std::string((const char*)string_out2), std::string("Hello, World2!"));
+    EXPECT_EQ(skr_vfs_fsize(f2), strlen("Hello, World2!") + 1);
+    EXPECT_EQ(skr_vfs_fclose(f2), true);
+
+    // rewriting the file must not leave readers on the old contents
+    auto w = skr_vfs_fopen(abs_fs, u8"testfile3", SKR_FM_WRITE_BINARY, SKR_FILE_CREATION_ALWAYS_NEW);
+    EXPECT_EQ(skr_vfs_fwrite(w, "first", 0, 6), 6);
+    skr_vfs_fclose(w);
+    auto r = skr_vfs_fopen(abs_fs, u8"testfile3", SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+    skr_vfs_fclose(r);
+    w = skr_vfs_fopen(abs_fs, u8"testfile3", SKR_FM_WRITE_BINARY, SKR_FILE_CREATION_ALWAYS_NEW);
+    EXPECT_EQ(skr_vfs_fwrite(w, "second", 0, 7), 7);
+    skr_vfs_fclose(w);
+    r = skr_vfs_fopen(abs_fs, u8"testfile3", SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+    std::memset((void*)string_out, 0, 256);
+    skr_vfs_fread(r, string_out, 0, 7);
+    EXPECT_EQ(std::string((const char*)string_out), std::string("second"));
+    EXPECT_EQ(skr_vfs_fsize(r), 7);
+    skr_vfs_fclose(r);
+
+    // files changed behind the vfs, through another descriptor or a rename, are not served from a stale descriptor
+    const auto write_outside = [](const char* path, const char* content) {
+        auto f = fopen(path, "wb");
+        REQUIRE(f != nullptr);
+        fwrite(content, 1, strlen(content) + 1, f);
+        fclose(f);
+    };
+    const auto read_through_vfs = [&](std::string& out) {
+        auto f = skr_vfs_fopen(abs_fs, u8"testfile4", SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+        REQUIRE(f != nullptr);
+        const auto size = skr_vfs_fsize(f);
+        out.resize(size);
+        EXPECT_EQ(skr_vfs_fread(f, out.data(), 0, size), size);
+        skr_vfs_fclose(f);
+    };
+    std::string content;
+    write_outside("testfile4", "original");
+    read_through_vfs(content);
+    EXPECT_EQ(content, std::string("original", 9));
+    write_outside("testfile4", "rewritten in place");
+    read_through_vfs(content);
+    EXPECT_EQ(content, std::string("rewritten in place", 19));
+    write_outside("testfile4.tmp", "renamed");
+    std::error_code ec = {};
+    skr::filesystem::rename("testfile4.tmp", "testfile4", ec);
+    REQUIRE(!ec);
+    read_through_vfs(content);
+    EXPECT_EQ(content, std::string("renamed", 8));
+}
+
 for (uint32_t i = 0; i < 1; i++)
 {
     const auto dstorage = (i == 0);
@@ -168,6 +239,38 @@ for (uint32_t i = 0; i < 1; i++)
         skr_io_ram_service_t::destroy(ioService);
     }
 
+    SUBCASE("missingfile")
+    {
+        ZoneScopedN("missingfile");
+
+        skr_ram_io_service_desc_t ioServiceDesc = {};
+        ioServiceDesc.name = u8"Test";
+        ioServiceDesc.use_dstorage = dstorage;
+        auto ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+        ioService->run();
+
+        // a file that can not be opened completes as failed instead of being cancelled
+        skr_io_future_t future = {};
+        skr::BlobId blob = nullptr;
+        {
+            auto rq = ioService->open_request();
+            rq->set_vfs(abs_fs);
+            rq->set_path(u8"testfile_missing");
+            rq->add_block({}); // read all
+            blob = ioService->request(rq, &future);
+        }
+
+        wait_timeout([&future]()->bool
+        {
+            return future.is_ready() || future.is_cancelled();
+        });
+        EXPECT_TRUE(future.is_ready());
+        EXPECT_TRUE(future.is_failed());
+        EXPECT_FALSE(skr_atomicu32_load_acquire(&future.request_cancel));
+        EXPECT_EQ(blob->get_size(), 0);
+        skr_io_ram_service_t::destroy(ioService);
+    }
+
     SUBCASE("asyncread2")
     {
         ZoneScopedN("asyncread2");
@@ -215,6 +318,115 @@ for (uint32_t i = 0; i < 1; i++)
         SkrDelete(io_job_queue);
     }
 
+    SUBCASE("qos")
+    {
+        ZoneScopedN("qos");
+
+        SKR_TEST_INFO(u8"dstorage enabled: {}", dstorage);
+
+        skr_ram_io_service_desc_t ioServiceDesc = {};
+        ioServiceDesc.name = u8"Test";
+        ioServiceDesc.use_dstorage = dstorage;
+        // after the first background read the class stays in debt for seconds
+        ioServiceDesc.qos_budgets[SKR_IO_QOS_CLASS_BACKGROUND].bytes_per_second = 1;
+        ioServiceDesc.qos_budgets[SKR_IO_QOS_CLASS_BACKGROUND].burst_bytes = 1;
+        auto ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+        ioService->run();
+
+        const auto read = [&](const char8_t* path, skr_io_block_t block, ESkrIOQoSClass qos, skr_io_future_t* future) {
+            auto rq = ioService->open_request();
+            rq->set_vfs(abs_fs);
+            rq->set_path(path);
+            rq->add_block(block);
+            rq->set_qos_class(qos);
+            return ioService->request(rq, future);
+        };
+        skr_io_future_t background_futures[2] = {};
+        skr_io_future_t streaming_future = {};
+        auto background0 = read(u8"testfile", {}, SKR_IO_QOS_CLASS_BACKGROUND, &background_futures[0]);
+        auto background1 = read(u8"testfile2", {}, SKR_IO_QOS_CLASS_BACKGROUND, &background_futures[1]);
+        auto streaming = read(u8"testfile2", { 0, 5 }, SKR_IO_QOS_CLASS_STREAMING, &streaming_future);
+
+        // streaming is not held back by the throttled background class
+        wait_timeout([&]()->bool
+        {
+            return streaming_future.is_ready() && (background_futures[0].is_ready() || background_futures[1].is_ready());
+        });
+        EXPECT_TRUE(streaming_future.is_ready());
+        EXPECT_NE(background_futures[0].is_ready(), background_futures[1].is_ready());
+        EXPECT_EQ(std::string((const char*)streaming->get_data(), 5), std::string("Hello"));
+
+        const auto streaming_stats = ioService->get_qos_stats(SKR_IO_QOS_CLASS_STREAMING);
+        EXPECT_EQ(streaming_stats.dispatched_requests, 1);
+        EXPECT_EQ(streaming_stats.dispatched_bytes, 5);
+        const auto background_stats = ioService->get_qos_stats(SKR_IO_QOS_CLASS_BACKGROUND);
+        EXPECT_EQ(background_stats.dispatched_requests, 1);
+        EXPECT_TRUE(background_stats.throttled_count > 0);
+
+        // lifting the budget releases the held request
+        ioService->set_qos_budget(SKR_IO_QOS_CLASS_BACKGROUND, {});
+        wait_timeout([&]()->bool
+        {
+            return background_futures[0].is_ready() && background_futures[1].is_ready();
+        });
+        EXPECT_EQ(std::string((const char*)background0->get_data()), std::string("Hello, World!"));
+        EXPECT_EQ(std::string((const char*)background1->get_data()), std::string("Hello, World2!"));
+        EXPECT_EQ(ioService->get_qos_stats(SKR_IO_QOS_CLASS_BACKGROUND).dispatched_requests, 2);
+
+        skr_io_ram_service_t::destroy(ioService);
+    }
+
+    SUBCASE("trace")
+    {
+        ZoneScopedN("trace");
+
+        SKR_TEST_INFO(u8"dstorage enabled: {}", dstorage);
+
+        skr_ram_io_service_desc_t ioServiceDesc = {};
+        ioServiceDesc.name = u8"Test";
+        ioServiceDesc.use_dstorage = dstorage;
+        auto ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+        ioService->run();
+
+        REQUIRE(ioService->begin_trace(abs_fs, u8"testfile.iotrace"));
+        skr_io_future_t futures[2] = {};
+        skr::BlobId blobs[2] = {};
+        for (uint32_t j = 0; j < 2; j++)
+        {
+            auto rq = ioService->open_request();
+            rq->set_vfs(abs_fs);
+            rq->set_path(u8"testfile2");
+            rq->add_block(j ? skr_io_block_t{ 7, 6 } : skr_io_block_t{});
+            rq->set_qos_class(j ? SKR_IO_QOS_CLASS_BACKGROUND : SKR_IO_QOS_CLASS_DEFAULT);
+            blobs[j] = ioService->request(rq, &futures[j], j ? SKR_ASYNC_SERVICE_PRIORITY_LOW : SKR_ASYNC_SERVICE_PRIORITY_NORMAL);
+        }
+        wait_timeout([&]()->bool
+        {
+            return futures[0].is_ready() && futures[1].is_ready();
+        });
+        ioService->drain();
+        ioService->end_trace();
+        skr_io_ram_service_t::destroy(ioService);
+
+        skr::vector<skr::io::IOTraceRecord> records;
+        REQUIRE(skr::io::IOTrace::Load(abs_fs, u8"testfile.iotrace", records));
+        REQUIRE(records.size() == 2);
+        for (const auto& record : records)
+        {
+            EXPECT_EQ(record.endpoint, SKR_IO_ENDPOINT_RAM);
+            EXPECT_EQ(record.final_stage, SKR_IO_STAGE_COMPLETED);
+            EXPECT_EQ(record.path, skr::string(u8"testfile2"));
+            REQUIRE(record.blocks.size() == 1);
+            EXPECT_NE(record.stage_usecs[SKR_IO_STAGE_LOADED], skr::io::IOTraceRecord::kStageSkipped);
+            EXPECT_TRUE(record.stage_usecs[SKR_IO_STAGE_COMPLETED] >= record.get_enqueue_usec());
+            const bool partial = (record.priority == SKR_ASYNC_SERVICE_PRIORITY_LOW);
+            // whole file reads record the resolved size
+            EXPECT_EQ(record.bytes, partial ? 6 : 15);
+            EXPECT_EQ(record.blocks[0].size, partial ? 6 : 15);
+            EXPECT_EQ(record.qos_class, partial ? SKR_IO_QOS_CLASS_BACKGROUND : SKR_IO_QOS_CLASS_DEFAULT);
+        }
+    }
+
     SUBCASE("chunking")
     {
         ZoneScopedN("chunking");
@@ -252,6 +464,102 @@ for (uint32_t i = 0; i < 1; i++)
         skr_io_ram_service_t::destroy(ioService);
     }
 
+    SUBCASE("destination")
+    {
+        ZoneScopedN("destination");
+
+        SKR_TEST_INFO(u8"dstorage enabled: {}", dstorage);
+
+        skr_ram_io_service_desc_t ioServiceDesc = {};
+        ioServiceDesc.name = u8"Test";
+        ioServiceDesc.use_dstorage = dstorage;
+        auto ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+        ioService->run();
+
+        // "Hello, " lands in caller memory, the rest in the service owned buffer
+        char8_t head[8] = {};
+        skr_io_future_t future = {};
+        skr::BlobId blob = nullptr;
+        {
+            auto rq = ioService->open_request();
+            rq->set_vfs(abs_fs);
+            rq->set_path(u8"testfile2");
+            rq->add_block({ 0, 7 }, (uint8_t*)head);
+            rq->add_block({ 7, 0 }); // read rest
+            blob = ioService->request(rq, &future);
+        }
+        wait_timeout([&future]()->bool
+        {
+            return future.is_ready();
+        });
+        EXPECT_EQ(std::string((const char*)head), std::string("Hello, "));
+        EXPECT_EQ(blob->get_size(), 8);
+        EXPECT_EQ(std::string((const char*)blob->get_data()), std::string("World2!"));
+
+        blob.reset();
+        skr_io_ram_service_t::destroy(ioService);
+    }
+
+    SUBCASE("dedup")
+    {
+        ZoneScopedN("dedup");
+
+        SKR_TEST_INFO(u8"dstorage enabled: {}", dstorage);
+
+        skr_ram_io_service_desc_t ioServiceDesc = {};
+        ioServiceDesc.name = u8"Test";
+        ioServiceDesc.use_dstorage = dstorage;
+        auto ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+
+        // identical reads queued before the runner starts share one buffer
+        skr_io_future_t futures[3] = {};
+        skr::BlobId blobs[3] = {};
+        for (uint32_t j = 0; j < 3; j++)
+        {
+            auto rq = ioService->open_request();
+            rq->set_vfs(abs_fs);
+            rq->set_path(u8"testfile2");
+            rq->add_block({}); // read all
+            blobs[j] = ioService->request(rq, &futures[j]);
+        }
+        // one waiter giving up must not abort the shared read
+        ioService->cancel(&futures[1]);
+        ioService->run();
+        ioService->drain();
+        for (uint32_t j = 0; j < 3; j++)
+        {
+            REQUIRE(futures[j].is_ready());
+            EXPECT_EQ(blobs[j].get(), blobs[0].get());
+        }
+        EXPECT_EQ(std::string((const char*)blobs[0]->get_data()), std::string("Hello, World2!"));
+        skr_io_ram_service_t::destroy(ioService);
+
+        // the read is aborted only when every waiter cancels
+        ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+        skr_io_future_t future = {};
+        skr_io_future_t future2 = {};
+        {
+            auto rq = ioService->open_request();
+            rq->set_vfs(abs_fs);
+            rq->set_path(u8"testfile");
+            rq->add_block({}); // read all
+            auto rq2 = ioService->open_request();
+            rq2->set_vfs(abs_fs);
+            rq2->set_path(u8"testfile");
+            rq2->add_block({}); // read all
+            auto blob = ioService->request(rq, &future);
+            auto blob2 = ioService->request(rq2, &future2);
+            EXPECT_EQ(blob.get(), blob2.get());
+            ioService->cancel(&future);
+            ioService->cancel(&future2);
+            ioService->run();
+            ioService->drain();
+            EXPECT_TRUE(future.is_cancelled());
+            EXPECT_TRUE(future2.is_cancelled());
+        }
+        skr_io_ram_service_t::destroy(ioService);
+    }
+
     #define TEST_CYCLES_COUNT 100
 
     SUBCASE("defer_cancel")
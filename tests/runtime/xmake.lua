@@ -5,6 +5,27 @@ target("MathTest")
     add_deps("SkrTestFramework", {public = false})
     add_files("math/math.cpp")
 
+target("NameTest")
+    set_group("05.tests/base")
+    set_kind("binary")
+    public_dependency("SkrRT", engine_version)
+    add_deps("SkrTestFramework", {public = false})
+    add_files("name/name.cpp")
+
+target("SpatialTest")
+    set_group("05.tests/base")
+    set_kind("binary")
+    public_dependency("SkrScene", engine_version)
+    add_deps("SkrTestFramework", {public = false})
+    add_files("spatial/bvh.cpp")
+
+target("InstancingTest")
+    set_group("05.tests/base")
+    set_kind("binary")
+    public_dependency("SkrRenderer", engine_version)
+    add_deps("SkrTestFramework", {public = false})
+    add_files("renderer/instancing.cpp")
+
 target("GraphTest")
     set_group("05.tests/base")
     set_kind("binary")
@@ -13,6 +34,14 @@ target("GraphTest")
     add_deps("SkrTestFramework", {public = false})
     add_files("graph/graph.cpp")
 
+target("RenderGraphPipelineTest")
+    set_group("05.vid_tests/render_graph")
+    set_kind("binary")
+    public_dependency("SkrRT", engine_version)
+    public_dependency("SkrRenderGraph", engine_version)
+    add_deps("SkrTestFramework", {public = false})
+    add_files("graph/Pipeline.cpp")
+
 target("VFSTest")
     set_group("05.tests/base")
     set_kind("binary")
@@ -20,6 +49,13 @@ target("VFSTest")
     add_deps("SkrTestFramework", {public = false})
     add_files("vfs/main.cpp")
 
+target("ResourceTest")
+    set_group("05.tests/base")
+    set_kind("binary")
+    public_dependency("SkrRT", engine_version)
+    add_deps("SkrTestFramework", {public = false})
+    add_files("resource/main.cpp")
+
 target("SerdeTest")
     set_group("05.tests/base")
     set_kind("binary")
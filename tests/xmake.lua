@@ -6,7 +6,15 @@ target("SkrTestFramework")
     add_files("framework/src/framework.cpp")
     add_deps("SkrRT")
 
+target("SkrBenchmarkFramework")
+    set_kind("static")
+    set_group("05.tests/framework")
+    add_includedirs("framework/include", {public = true})
+    add_files("framework/src/benchmark.cpp")
+    add_deps("SkrRT")
+
 -- includes("daS/xmake.lua")
 includes("cgpu/xmake.lua")
 includes("runtime/xmake.lua")
-includes("async/xmake.lua")
\ No newline at end of file
+includes("async/xmake.lua")
+includes("benchmark/xmake.lua")
@@ -0,0 +1,64 @@
+"""Compare two benchmark result files written with `--out=<file.json>`.
+
+usage: compare.py <baseline.json> <contender.json> [--threshold 0.05] [--noise 2.0]
+
+A benchmark regresses when its median time grows by more than `threshold` (relative)
+and the growth is larger than `noise` times the larger of both standard deviations.
+Exits with 1 when any benchmark regressed, so the script can gate CI jobs.
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path, "r", encoding="utf-8") as f:
+        data = json.load(f)
+    return {b["name"]: b for b in data.get("benchmarks", [])}
+
+
+def classify(old, new, threshold, noise):
+    old_t, new_t = old["median_ns"], new["median_ns"]
+    if old_t <= 0.0:
+        return "n/a", 0.0
+    change = (new_t - old_t) / old_t
+    spread = noise * max(old.get("stddev_ns", 0.0), new.get("stddev_ns", 0.0))
+    if abs(new_t - old_t) <= spread or abs(change) <= threshold:
+        return "same", change
+    return ("REGRESSED" if change > 0 else "improved"), change
+
+
+def main():
+    parser = argparse.ArgumentParser(description="compare two benchmark result files")
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=0.05, help="relative change tolerated, default 5%%")
+    parser.add_argument("--noise", type=float, default=2.0, help="changes within noise * stddev are ignored")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    contender = load(args.contender)
+
+    regressions = 0
+    print("%-48s %14s %14s %9s  %s" % ("benchmark", "old(ns)", "new(ns)", "change", "verdict"))
+    for name, new in contender.items():
+        old = baseline.get(name)
+        if old is None:
+            print("%-48s %14s %14.2f %9s  %s" % (name, "-", new["median_ns"], "-", "new"))
+            continue
+        verdict, change = classify(old, new, args.threshold, args.noise)
+        if verdict == "REGRESSED":
+            regressions += 1
+        print("%-48s %14.2f %14.2f %+8.1f%%  %s" % (name, old["median_ns"], new["median_ns"], change * 100.0, verdict))
+    for name in baseline:
+        if name not in contender:
+            print("%-48s %14.2f %14s %9s  %s" % (name, baseline[name]["median_ns"], "-", "-", "missing"))
+
+    if regressions:
+        print("%d benchmark(s) regressed beyond %.1f%%" % (regressions, args.threshold * 100.0))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -3,6 +3,7 @@
 #include "SkrMeshCore/mesh_processing.hpp"
 #include "SkrRT/io/ram_io.hpp"
 #include <SkrRT/containers/string.hpp>
+#include <SkrRT/containers/span.hpp>
 
 struct cgltf_data;
 struct cgltf_node;
@@ -15,6 +16,11 @@ namespace asset
 GLTFTOOL_API
 cgltf_data* ImportGLTFWithData(skr::string_view assetPath, skr_io_ram_service_t* ioService, struct skr_vfs_t* vfs) SKR_NOEXCEPT;
 
+// parses an in-memory .gltf/.glb, external buffers are loaded relative to fullPath
+// the source bytes are copied into the returned data, which needs to be freed by cgltf_free
+GLTFTOOL_API
+cgltf_data* ParseGLTFWithData(skr::span<const uint8_t> source, const char* fullPath) SKR_NOEXCEPT;
+
 GLTFTOOL_API
 void GetGLTFNodeTransform(const cgltf_node* node, skr_float3_t& translation, skr_float3_t& scale, skr_float4_t& rotation);
 
@@ -3,11 +3,13 @@
 #include "SkrRT/misc/log.hpp"
 #include "SkrRT/misc/parallel_for.hpp"
 #include "SkrToolCore/asset/cook_system.hpp"
+#include "SkrToolCore/asset/import_cache.hpp"
 #include "SkrToolCore/project/project.hpp"
 #include "SkrToolCore/asset/json_utils.hpp"
 #include "SkrGLTFTool/mesh_asset.hpp"
 #include "SkrGLTFTool/mesh_processing.hpp"
 #include "MeshOpt/meshoptimizer.h"
+#include "cgltf/cgltf.h"
 
 #include "tracy/Tracy.hpp"
 
@@ -20,14 +22,35 @@ void* skd::asset::SGltfMeshImporter::Import(skr_io_ram_service_t* ioService, SCo
         return nullptr;
     }
     const auto assetRecord = context->GetAssetRecord();
-    auto path = context->AddFileDependency(relPath).u8string();
-    auto vfs = assetRecord->project->asset_vfs;
-    return ImportGLTFWithData(path.c_str(), ioService, vfs);
+    auto path = context->AddFileDependency(relPath);
+    // meshes and skins cooked from the same gltf share one parsed document, the source is only read on a miss
+    auto fullPath = skr::filesystem::path(assetRecord->project->asset_vfs->mount_dir) / path;
+    const auto fullPathStr = fullPath.string();
+    using namespace skr::guid::literals;
+    static constexpr skr_guid_t kGLTFImportKind = u8"9a5c0f42-6c8e-4b0d-9d7b-3c1e5f2a8e61"_guid;
+    auto cache = GetCookSystem()->GetImportCache();
+    return cache->Acquire(kGLTFImportKind, fullPath,
+    [&](uint64_t& outMemorySize) -> void* {
+        skr::BlobId blob = nullptr;
+        context->AddFileDependencyAndLoad(ioService, relPath, blob);
+        if (!blob || !blob->get_data())
+        {
+            return nullptr;
+        }
+        SKR_DEFER({ blob.reset(); });
+        auto data = ParseGLTFWithData({ blob->get_data(), blob->get_size() }, fullPathStr.c_str());
+        if (!data) return nullptr;
+        outMemorySize = blob->get_size();
+        for (cgltf_size i = 0; i < data->buffers_count; ++i)
+            outMemorySize += data->buffers[i].size;
+        return data;
+    },
+    +[](void* data) { cgltf_free((cgltf_data*)data); });
 }
 
 void skd::asset::SGltfMeshImporter::Destroy(void* resource)
 {
-    cgltf_free((cgltf_data*)resource);
+    GetCookSystem()->GetImportCache()->Release(resource);
 }
 
 bool skd::asset::SMeshCooker::Cook(SCookContext* ctx)
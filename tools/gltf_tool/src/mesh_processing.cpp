@@ -7,6 +7,8 @@
 #include "SkrMeshCore/mesh_processing.hpp"
 #include "SkrGLTFTool/mesh_processing.hpp"
 
+#include <EASTL/algorithm.h>
+
 #include "tracy/Tracy.hpp"
 
 #define MAGIC_SIZE_GLTF_PARSE_READY ~0
@@ -91,31 +93,71 @@ cgltf_data* ImportGLTFWithData(skr::string_view assetPath, skr_io_ram_service_t*
     blob = ioService->request(request, &future);
     counter.wait(false);
     struct cgltf_data* gltf_data_ = nullptr;
+    if (blob->get_data())
     {
-        ZoneScopedN("ParseGLTF");
-        cgltf_options options = {};
-        if (blob->get_data())
+        auto fullPath = skr::filesystem::path(vfs->mount_dir) / u8Path.u8_str();
+        gltf_data_ = ParseGLTFWithData({ blob->get_data(), blob->get_size() }, fullPath.string().c_str());
+    }
+    blob.reset();
+    return gltf_data_;
+}
+
+cgltf_data* ParseGLTFWithData(skr::span<const uint8_t> source, const char* fullPath) SKR_NOEXCEPT
+{
+    ZoneScopedN("ParseGLTF");
+    if (source.empty()) return nullptr;
+    // cgltf keeps pointing into the source (glb bin chunk, json extras),
+    // so it is owned by the data as its file_data and released by cgltf_free
+    void* fileData = malloc(source.size());
+    memcpy(fileData, source.data(), source.size());
+    cgltf_options options = {};
+    struct cgltf_data* gltf_data_ = nullptr;
+    cgltf_result result = cgltf_parse(&options, fileData, source.size(), &gltf_data_);
+    if (result != cgltf_result_success)
+    {
+        free(fileData);
+        return nullptr;
+    }
+    gltf_data_->file_data = fileData;
+    {
+        ZoneScopedN("LoadGLTFBuffer");
+        result = cgltf_load_buffers(&options, gltf_data_, fullPath);
+    }
+    if (result == cgltf_result_success)
+        result = cgltf_validate(gltf_data_);
+    if (result != cgltf_result_success)
+    {
+        cgltf_free(gltf_data_);
+        return nullptr;
+    }
+    return gltf_data_;
+}
+
+// grows the local bounds with the POSITION min/max that gltf requires on every primitive
+inline static void AccumulateGLTFMeshBounds(const cgltf_mesh* mesh, skr_mesh_resource_t& out_resource)
+{
+    for (uint32_t i = 0; i < mesh->primitives_count; i++)
+    {
+        const auto& prim = mesh->primitives[i];
+        for (uint32_t j = 0; j < prim.attributes_count; j++)
         {
-            cgltf_result result = cgltf_parse(&options, blob->get_data(), blob->get_size(), &gltf_data_);
-            if (result != cgltf_result_success)
+            const auto& attribute = prim.attributes[j];
+            if (attribute.type != cgltf_attribute_type_position) continue;
+            const auto accessor = attribute.data;
+            if (!accessor->has_min || !accessor->has_max) continue;
+            if (!out_resource.has_bounds)
             {
-                gltf_data_ = nullptr;
-            }
-            else
-            {
-                ZoneScopedN("LoadGLTFBuffer");
-                auto fullPath = skr::filesystem::path(vfs->mount_dir) / u8Path.u8_str();
-                result = cgltf_load_buffers(&options, gltf_data_, fullPath.string().c_str());
-                result = cgltf_validate(gltf_data_);
-                if (result != cgltf_result_success)
-                {
-                    gltf_data_ = nullptr;
-                }
+                out_resource.bounds_min = { accessor->min[0], accessor->min[1], accessor->min[2] };
+                out_resource.bounds_max = { accessor->max[0], accessor->max[1], accessor->max[2] };
+                out_resource.has_bounds = true;
+                continue;
             }
+            auto& min = out_resource.bounds_min;
+            auto& max = out_resource.bounds_max;
+            min = { eastl::min(min.x, accessor->min[0]), eastl::min(min.y, accessor->min[1]), eastl::min(min.z, accessor->min[2]) };
+            max = { eastl::max(max.x, accessor->max[0]), eastl::max(max.y, accessor->max[1]), eastl::max(max.z, accessor->max[2]) };
         }
-        blob.reset();
     }
-    return gltf_data_;
 }
 
 void GetGLTFNodeTransform(const cgltf_node* node, skr_float3_t& translation, skr_float3_t& scale, skr_float4_t& rotation)
@@ -153,6 +195,7 @@ void CookGLTFMeshData(const cgltf_data* gltf_data, SMeshCookConfig* cfg, skr_mes
         if (node_->mesh != nullptr)
         {
             SRawMesh raw_mesh = GenerateRawMeshForGLTFMesh(node_->mesh);
+            AccumulateGLTFMeshBounds(node_->mesh, out_resource);
             eastl::vector<skr_mesh_primitive_t> new_primitives;
             // record all indices
             EmplaceAllRawMeshIndices(&raw_mesh, buffer0, new_primitives);
@@ -207,6 +250,7 @@ void CookGLTFMeshData_SplitSkin(const cgltf_data* gltf_data, SMeshCookConfig* cf
         if (node_->mesh != nullptr)
         {
             SRawMesh raw_mesh = GenerateRawMeshForGLTFMesh(node_->mesh);
+            AccumulateGLTFMeshBounds(node_->mesh, out_resource);
             eastl::vector<skr_mesh_primitive_t> new_primitives;
             // record all indices
             EmplaceAllRawMeshIndices(&raw_mesh, buffer0, new_primitives);
@@ -0,0 +1,202 @@
+#include "SkrRT/platform/vfs.h"
+#include "SkrRT/platform/time.h"
+#include "SkrRT/platform/thread.h"
+#include "SkrRT/platform/filesystem.hpp"
+#include "SkrRT/misc/opt.hpp"
+#include "SkrRT/misc/log.h"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/containers/hashmap.hpp"
+#include "SkrRT/module/module_manager.hpp"
+#include "SkrRT/io/ram_io.hpp"
+#include "SkrRT/io/io_trace.hpp"
+
+#include <EASTL/sort.h>
+#include <EASTL/algorithm.h>
+
+// replays a trace written by IIOService::begin_trace against local files and reports latencies.
+// VRAM records are replayed as RAM reads of the same files so no gpu is needed.
+//   SkrIOReplay -t session.iotrace [-r content_dir] [-f] [-d]
+namespace
+{
+struct ReplaySlot
+{
+    const skr::io::IOTraceRecord* record = nullptr;
+    skr_io_future_t future = {};
+    skr::BlobId blob = nullptr;
+    int64_t issue_usec = 0;
+    SAtomicU64 finish_usec = 0;
+};
+
+struct LatencyStats
+{
+    skr::vector<uint64_t> traced;
+    skr::vector<uint64_t> replayed;
+    uint64_t bytes = 0;
+};
+
+uint64_t Percentile(const skr::vector<uint64_t>& sorted, uint32_t percent)
+{
+    if (sorted.empty())
+        return 0;
+    return sorted[(sorted.size() - 1) * percent / 100];
+}
+
+void Report(const char8_t* name, LatencyStats& stats)
+{
+    if (stats.replayed.empty())
+        return;
+    eastl::sort(stats.traced.begin(), stats.traced.end());
+    eastl::sort(stats.replayed.begin(), stats.replayed.end());
+    SKR_LOG_INFO(u8"%s: %llu requests, %.2f MiB", name, (uint64_t)stats.replayed.size(), stats.bytes / (1024.0 * 1024.0));
+    const auto line = [](const char8_t* label, const skr::vector<uint64_t>& sorted) {
+        SKR_LOG_INFO(u8"  %s latency ms: p50 %.3f  p90 %.3f  p99 %.3f  max %.3f", label,
+            Percentile(sorted, 50) * 1e-3, Percentile(sorted, 90) * 1e-3, Percentile(sorted, 99) * 1e-3, sorted.back() * 1e-3);
+    };
+    line(u8"traced  ", stats.traced);
+    line(u8"replayed", stats.replayed);
+}
+
+int Replay(int argc, char** argv)
+{
+    skr::cmd::parser parser(argc, argv);
+    parser.add(u8"trace", u8"trace file written by IIOService::begin_trace", u8"-t", true);
+    parser.add(u8"root", u8"directory traced paths are relative to, absolute paths if omitted", u8"-r", false);
+    parser.add(u8"fast", u8"issue every request at once instead of at its traced time", u8"-f", false, true);
+    parser.add(u8"dstorage", u8"read with direct storage where available", u8"-d", false, true);
+    if (!parser.parse())
+    {
+        SKR_LOG_ERROR(u8"Failed to parse command line arguments.");
+        return 1;
+    }
+    const auto trace_path = parser.get<skr::string>(u8"trace");
+    const auto root = parser.get_optional<skr::string>(u8"root");
+    const bool fast = parser.parsed(u8"fast");
+
+    skr_vfs_desc_t abs_fs_desc = {};
+    abs_fs_desc.app_name = u8"io-replay";
+    abs_fs_desc.mount_type = SKR_MOUNT_TYPE_ABSOLUTE;
+    auto abs_fs = skr_create_vfs(&abs_fs_desc);
+    skr_vfs_t* content_fs = abs_fs;
+    if (root && !root->is_empty())
+    {
+        skr_vfs_desc_t content_fs_desc = {};
+        content_fs_desc.app_name = u8"io-replay";
+        content_fs_desc.mount_type = SKR_MOUNT_TYPE_CONTENT;
+        content_fs_desc.override_mount_dir = root->u8_str();
+        content_fs = skr_create_vfs(&content_fs_desc);
+    }
+
+    skr::vector<skr::io::IOTraceRecord> records;
+    if (!skr::io::IOTrace::Load(abs_fs, trace_path.u8_str(), records))
+        return 1;
+    // cancelled requests tell nothing about read latency, and the service expects files to exist
+    // requests with memory or file handle sources are traced without a path, there is nothing to read them from
+    skr::flat_hash_map<skr::string, bool, skr::hash<skr::string>> exists;
+    const auto readable = [&](const skr::string& path) {
+        auto found = exists.find(path);
+        if (found == exists.end())
+        {
+            auto file = skr_vfs_fopen(content_fs, path.u8_str(), SKR_FM_READ_BINARY, SKR_FILE_CREATION_OPEN_EXISTING);
+            if (file)
+                skr_vfs_fclose(file);
+            else
+                SKR_LOG_WARN(u8"%s is missing, its requests are skipped", path.u8_str());
+            found = exists.emplace(path, file != nullptr).first;
+        }
+        return found->second;
+    };
+    records.erase(eastl::remove_if(records.begin(), records.end(), [&](const auto& record) {
+        return record.final_stage != SKR_IO_STAGE_COMPLETED || record.path.is_empty() || !readable(record.path);
+    }), records.end());
+    SKR_LOG_INFO(u8"replaying %llu requests of %s (%s)", (uint64_t)records.size(), trace_path.u8_str(), fast ? u8"fast" : u8"timed");
+
+    skr_ram_io_service_desc_t ioServiceDesc = {};
+    ioServiceDesc.name = u8"IOReplay";
+    ioServiceDesc.use_dstorage = parser.parsed(u8"dstorage");
+    auto ioService = skr_io_ram_service_t::create(&ioServiceDesc);
+    ioService->run();
+
+    const auto on_finish = +[](skr_io_future_t* future, skr_io_request_t* request, void* data) {
+        auto slot = (ReplaySlot*)data;
+        skr_atomicu64_store_release(&slot->finish_usec, (uint64_t)skr_sys_get_usec(false));
+    };
+    skr::vector<ReplaySlot> slots(records.size());
+    const auto start_usec = skr_sys_get_usec(false);
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const auto& record = records[i];
+        auto& slot = slots[i];
+        if (!fast)
+        {
+            const auto issue_at = start_usec + (int64_t)record.get_enqueue_usec();
+            for (auto now = skr_sys_get_usec(false); now < issue_at; now = skr_sys_get_usec(false))
+                skr_thread_sleep((issue_at - now) > 2000 ? 1 : 0);
+        }
+        auto rq = ioService->open_request();
+        rq->set_vfs(content_fs);
+        rq->set_path(record.path.u8_str());
+        for (const auto& block : record.blocks)
+            rq->add_block(block);
+        if (record.blocks.empty())
+            rq->add_block({}); // read all
+        rq->set_qos_class(record.qos_class);
+        rq->add_callback(SKR_IO_STAGE_COMPLETED, on_finish, &slot);
+        rq->add_callback(SKR_IO_STAGE_CANCELLED, on_finish, &slot);
+        slot.record = &record;
+        slot.issue_usec = skr_sys_get_usec(false);
+        slot.blob = ioService->request(rq, &slot.future, record.priority);
+    }
+    for (auto& slot : slots)
+    {
+        while (!skr_atomicu64_load_acquire(&slot.finish_usec))
+            skr_thread_sleep(0);
+    }
+    const auto wall_usec = skr_sys_get_usec(false) - start_usec;
+
+    LatencyStats total;
+    LatencyStats priorities[SKR_ASYNC_SERVICE_PRIORITY_COUNT];
+    uint64_t failed = 0;
+    for (auto& slot : slots)
+    {
+        if (!slot.future.is_ready())
+        {
+            failed++;
+            continue;
+        }
+        const auto traced = slot.record->get_latency_usec();
+        const auto replayed = skr_atomicu64_load_relaxed(&slot.finish_usec) - (uint64_t)slot.issue_usec;
+        for (auto stats : { &total, &priorities[slot.record->priority] })
+        {
+            stats->traced.emplace_back(traced);
+            stats->replayed.emplace_back(replayed);
+            stats->bytes += slot.blob->get_size();
+        }
+        slot.blob.reset();
+    }
+    skr_io_ram_service_t::destroy(ioService);
+
+    SKR_LOG_INFO(u8"wall time %.3f s, %.2f MiB/s, %llu failed", wall_usec * 1e-6, total.bytes / (1024.0 * 1024.0) / (wall_usec * 1e-6), failed);
+    Report(u8"all", total);
+    Report(u8"urgent", priorities[SKR_ASYNC_SERVICE_PRIORITY_URGENT]);
+    Report(u8"normal", priorities[SKR_ASYNC_SERVICE_PRIORITY_NORMAL]);
+    Report(u8"low", priorities[SKR_ASYNC_SERVICE_PRIORITY_LOW]);
+
+    if (content_fs != abs_fs)
+        skr_free_vfs(content_fs);
+    skr_free_vfs(abs_fs);
+    return failed ? 1 : 0;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto moduleManager = skr_get_module_manager();
+    std::error_code ec = {};
+    auto root = skr::filesystem::current_path(ec);
+    moduleManager->mount(root.u8string().c_str());
+    moduleManager->make_module_graph(u8"SkrIOReplay", true);
+    moduleManager->init_module_graph(argc, argv);
+    const auto result = Replay(argc, argv);
+    moduleManager->destroy_module_graph();
+    return result;
+}
@@ -0,0 +1,5 @@
+executable_module("SkrIOReplay", "SKR_IO_REPLAY", engine_version)
+    set_group("02.tools")
+    set_exceptions("no-cxx")
+    public_dependency("SkrRT", engine_version)
+    add_files("main.cpp")
@@ -22,6 +22,7 @@
 #include "SkrToolCore/project/project.hpp"
 #include "SkrToolCore/asset/cook_system.hpp"
 #include "SkrToolCore/asset/importer.hpp"
+#include "SkrToolCore/asset/resource_bundle.hpp"
 #include "SkrToolCore/assets/config_asset.hpp"
 
 #include "tracy/Tracy.hpp"
@@ -81,17 +82,26 @@ void DestroyResourceSystem(skd::SProject& proj)
     SkrDelete(registry);
 }
 
-skr::vector<skd::SProject*> open_projects(int argc, char** argv)
+struct CompileOptions
+{
+    // io trace (.iotrace) or list of root guids, cooked resources are bundled in this order when set
+    skr::filesystem::path bundleOrder;
+};
+
+skr::vector<skd::SProject*> open_projects(int argc, char** argv, CompileOptions& options)
 {
     skr::cmd::parser parser(argc, argv);
     parser.add(u8"project", u8"project path", u8"-p", false);
     parser.add(u8"workspace", u8"workspace path", u8"-w", true);
+    parser.add(u8"bundle", u8"load order to bundle cooked resources in, an io trace (.iotrace) or a list of root guids", u8"-b", false);
     if(!parser.parse())
     {
         SKR_LOG_ERROR(u8"Failed to parse command line arguments.");
         return {};
     }
     auto projectPath = parser.get_optional<skr::string>(u8"project");
+    if (auto bundleOrder = parser.get_optional<skr::string>(u8"bundle"))
+        options.bundleOrder = bundleOrder->u8_str();
 
     std::error_code ec = {};
     skr::filesystem::path workspace{parser.get<skr::string>(u8"workspace").u8_str()};
@@ -116,7 +126,22 @@ skr::vector<skd::SProject*> open_projects(int argc, char** argv)
     return result;
 }
 
-int compile_project(skd::SProject* project)
+bool bundle_project(skd::SProject* project, const CompileOptions& options)
+{
+    ZoneScopedN("Bundle");
+    using Builder = skd::asset::SResourceBundleBuilder;
+    skr::vector<skr_guid_t> order;
+    const bool loaded = (options.bundleOrder.extension() == ".iotrace") ?
+        Builder::LoadTraceOrder(options.bundleOrder, order) :
+        Builder::LoadDependencyOrder(options.bundleOrder, project->GetOutputPath(), order);
+    if (!loaded)
+        return false;
+    // level1.iotrace -> level1.bundle & level1.bundle.idx
+    const auto name = options.bundleOrder.stem().u8string();
+    return Builder::Write(project->GetOutputPath(), name.c_str(), order);
+}
+
+int compile_project(skd::SProject* project, const CompileOptions& options)
 {
     auto& system = *skd::asset::GetCookSystem();
     InitializeResourceSystem(*project);
@@ -172,6 +197,12 @@ int compile_project(skd::SProject* project)
         resource_system->Update();
     }
     DestroyResourceSystem(*project);
+    //----- bundle cooked resources
+    if (!options.bundleOrder.empty() && !bundle_project(project, options))
+    {
+        SKR_LOG_ERROR(u8"Failed to bundle resources.");
+        return 1;
+    }
     return 0;
 }
 
@@ -185,13 +216,14 @@ int compile_all(int argc, char** argv)
     auto& system = *skd::asset::GetCookSystem();
     system.Initialize();
     //----- register project
-    auto projects = open_projects(argc, argv);
+    CompileOptions options;
+    auto projects = open_projects(argc, argv, options);
     SKR_DEFER({ 
         for(auto& project : projects)
             SkrDelete(project); 
     });
     for(auto& project : projects)
-        compile_project(project);
+        compile_project(project, options);
     
     scheduler.unbind();
     system.Shutdown();
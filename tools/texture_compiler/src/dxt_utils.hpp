@@ -62,16 +62,18 @@ inline static skr::string Util_CompressedTypeString(ECGPUFormat format)
     }
 }
 
-inline static eastl::vector<uint8_t> Util_DXTCompressWithImageCoder(skr::ImageDecoderId decoder, ECGPUFormat compressed_format)
+inline static EImageCoderColorFormat Util_DXTRawColorFormat(skr::ImageDecoderId decoder)
 {
-    // fetch RGBA data
-    const auto bit_depth = decoder->get_bit_depth();
     const auto encoded_format = decoder->get_color_format();
-    const auto raw_format = (encoded_format == IMAGE_CODER_COLOR_FORMAT_BGRA) ? IMAGE_CODER_COLOR_FORMAT_RGBA : encoded_format;
-    bool sucess = decoder->decode(raw_format, bit_depth);
-    uint8_t* rgba_data = rgba_data = decoder->get_data();
-    uint64_t rgba_size = decoder->get_size(); (void)rgba_size;
-    if (!sucess)
+    return (encoded_format == IMAGE_CODER_COLOR_FORMAT_BGRA) ? IMAGE_CODER_COLOR_FORMAT_RGBA : encoded_format;
+}
+
+// compresses a decoder that was already decoded to Util_DXTRawColorFormat, the decoder is only read
+inline static eastl::vector<uint8_t> Util_DXTCompressDecoded(skr::ImageDecoderId decoder, ECGPUFormat compressed_format)
+{
+    const auto raw_format = Util_DXTRawColorFormat(decoder);
+    uint8_t* rgba_data = decoder->get_data();
+    if (!rgba_data)
     {
         SKR_UNREACHABLE_CODE()
         return {};
@@ -141,4 +143,15 @@ inline static eastl::vector<uint8_t> Util_DXTCompressWithImageCoder(skr::ImageDe
             return {};
     }
     return compressed_data;
-} 
\ No newline at end of file
+} 
+inline static eastl::vector<uint8_t> Util_DXTCompressWithImageCoder(skr::ImageDecoderId decoder, ECGPUFormat compressed_format)
+{
+    // fetch RGBA data
+    const auto bit_depth = decoder->get_bit_depth();
+    if (!decoder->decode(Util_DXTRawColorFormat(decoder), bit_depth))
+    {
+        SKR_UNREACHABLE_CODE()
+        return {};
+    }
+    return Util_DXTCompressDecoded(decoder, compressed_format);
+}
@@ -1,4 +1,5 @@
 #include "SkrToolCore/asset/cook_system.hpp"
+#include "SkrToolCore/asset/import_cache.hpp"
 #include "SkrToolCore/project/project.hpp"
 #include "dxt_utils.hpp"
 #include "SkrRT/io/ram_io.hpp"
@@ -34,40 +35,55 @@ struct skr_uncompressed_render_texture_t
 
 void* STextureImporter::Import(skr_io_ram_service_t* ioService, SCookContext* context)
 {
-    skr::BlobId blob = nullptr;
-    {
-        ZoneScopedN("LoadFileDependencies");
-        context->AddFileDependencyAndLoad(ioService, assetPath.c_str(), blob);
-    }
+    const auto assetRecord = context->GetAssetRecord();
+    auto path = context->AddFileDependency(assetPath.c_str());
+    auto fullPath = skr::filesystem::path(assetRecord->project->asset_vfs->mount_dir) / path;
 
-    {
-        ZoneScopedN("TryDecodeTexture");
-        // try decode texture
-        const auto uncompressed_data = blob->get_data();
-        const auto uncompressed_size = blob->get_size();
-        EImageCoderFormat format = skr_image_coder_detect_format((const uint8_t*)uncompressed_data, uncompressed_size);
-        if (auto decoder = skr::IImageDecoder::Create(format))
+    // textures cooked from the same image share one decode, the source is only read on a miss
+    using namespace skr::guid::literals;
+    static constexpr skr_guid_t kImageImportKind = u8"5d2b8e0c-1f7a-4c3e-a6b9-0e4d7c2f8a13"_guid;
+    auto cache = GetCookSystem()->GetImportCache();
+    return cache->Acquire(kImageImportKind, fullPath,
+    [&](uint64_t& outMemorySize) -> void* {
+        skr::BlobId blob = nullptr;
         {
-            return SkrNew<skr_uncompressed_render_texture_t>(decoder, ioService, blob);
+            ZoneScopedN("LoadFileDependencies");
+            context->AddFileDependencyAndLoad(ioService, assetPath.c_str(), blob);
         }
-        else
+        if (!blob || !blob->get_data())
+            return nullptr;
+        SKR_DEFER({ blob.reset(); });
+
+        ZoneScopedN("TryDecodeTexture");
+        // try decode texture
+        EImageCoderFormat format = skr_image_coder_detect_format(blob->get_data(), blob->get_size());
+        auto decoder = skr::IImageDecoder::Create(format);
+        if (!decoder)
+            return nullptr;
+        auto uncompressed = SkrNew<skr_uncompressed_render_texture_t>(decoder, ioService, blob);
+        // decoded once here, cookers only read the shared pixels
+        if (!decoder->decode(Util_DXTRawColorFormat(decoder), decoder->get_bit_depth()))
         {
-            SKR_DEFER({blob.reset();});
+            SkrDelete(uncompressed);
+            return nullptr;
         }
-    }
-
-    return nullptr;
+        outMemorySize = blob->get_size() + decoder->get_size();
+        return uncompressed;
+    },
+    +[](void* resource) { SkrDelete((skr_uncompressed_render_texture_t*)resource); });
 }
 
 void STextureImporter::Destroy(void *resource)
 {
-    SkrDelete((skr_uncompressed_render_texture_t*)resource);
+    GetCookSystem()->GetImportCache()->Release(resource);
 }
 
 bool STextureCooker::Cook(SCookContext *ctx)
 {
     const auto outputPath = ctx->GetOutputPath();
     auto uncompressed = ctx->Import<skr_uncompressed_render_texture_t>();
+    if (!uncompressed)
+        return false;
     SKR_DEFER({ ctx->Destroy(uncompressed); });
     
     // try decode texture & calculate compressed format
@@ -89,7 +105,7 @@ bool STextureCooker::Cook(SCookContext *ctx)
     skr::vector<uint8_t> compressed_data;
     {
         ZoneScopedN("DXTCompress");
-        compressed_data = Util_DXTCompressWithImageCoder(decoder, compressed_format);
+        compressed_data = Util_DXTCompressDecoded(decoder, compressed_format);
     }
     // TODO: ASTC
     // write texture resource
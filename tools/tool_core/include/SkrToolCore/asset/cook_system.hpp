@@ -146,6 +146,8 @@ public:
     virtual void ParallelForEachAsset(uint32_t batch, skr::function_ref<void(skr::span<SAssetRecord*>)> f) = 0;
 
     virtual skr_io_ram_service_t* getIOService() = 0;
+    // source imports shared by the cook tasks of this session
+    virtual SImportCache* GetImportCache() = 0;
 
     static constexpr uint32_t ioServicesMaxCount = 1;
 };
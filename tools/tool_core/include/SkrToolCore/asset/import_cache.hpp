@@ -0,0 +1,40 @@
+#pragma once
+#include "SkrToolCore/fwd_types.hpp"
+#include "SkrRT/platform/guid.hpp"
+#include "SkrRT/platform/filesystem.hpp"
+#include "SkrRT/containers/string.hpp"
+#include <EASTL/functional.h>
+
+namespace skd
+{
+namespace asset
+{
+// Shares expensive source imports (parsed gltf documents, decoded images...) between the cook tasks of a session.
+// Entries are keyed by import kind, source path and the size & write time of the source, so an edited source is
+// imported again while a hit never reads the source at all.
+struct TOOL_CORE_API SImportCache {
+    // reads the source and builds the shared data from it, returns nullptr on failure
+    // outMemorySize is the size kept alive by the data, it is charged against the memory budget
+    using LoadFunc = eastl::function<void*(uint64_t& outMemorySize)>;
+    using FreeFunc = void (*)(void* data);
+
+    static constexpr uint64_t kDefaultMemoryBudget = 1024ull * 1024ull * 1024ull;
+
+    static SImportCache* Create(uint64_t memoryBudget = kDefaultMemoryBudget);
+    static void Destroy(SImportCache* cache);
+
+    virtual ~SImportCache() SKR_NOEXCEPT = default;
+
+    // returns a referenced shared data, the first caller runs load while concurrent callers wait for it
+    // the data is shared by every task, treat it as read-only and hand it back with Release()
+    virtual void* Acquire(skr_guid_t kind, const skr::filesystem::path& path, const LoadFunc& load, FreeFunc free) SKR_NOEXCEPT = 0;
+    virtual void Release(void* data) SKR_NOEXCEPT = 0;
+
+    // unreferenced entries are freed least recently used first while the cache is over budget
+    virtual void SetMemoryBudget(uint64_t bytes) SKR_NOEXCEPT = 0;
+    virtual uint64_t GetMemoryUsage() const SKR_NOEXCEPT = 0;
+    // frees every unreferenced entry, referenced ones are freed on their last release
+    virtual void Clear() SKR_NOEXCEPT = 0;
+};
+} // namespace asset
+} // namespace skd
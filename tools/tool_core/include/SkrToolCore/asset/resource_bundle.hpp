@@ -0,0 +1,28 @@
+#pragma once
+#include "SkrToolCore/fwd_types.hpp"
+#include "SkrRT/platform/guid.hpp"
+#include "SkrRT/platform/filesystem.hpp"
+#include "SkrRT/containers/span.hpp"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/resource/resource_bundle.hpp"
+
+namespace skd
+{
+namespace asset
+{
+// Packs cooked resources of an output directory into one bundle in the order they are loaded,
+// the runtime picks it up with SLocalResourceRegistry::LoadBundleIndex.
+struct TOOL_CORE_API SResourceBundleBuilder {
+    // first access order of the <guid>.rh/<guid>.bin reads in a trace written by IIOService::begin_trace
+    static bool LoadTraceOrder(const skr::filesystem::path& tracePath, skr::vector<skr_guid_t>& outOrder);
+    // every root followed by its static dependencies depth first, as the resource system requests them
+    // roots are read from a text file with one guid per line, lines starting with # are skipped
+    static bool LoadDependencyOrder(const skr::filesystem::path& rootsPath, const skr::filesystem::path& outputDir, skr::vector<skr_guid_t>& outOrder);
+
+    // writes <name>.bundle and <name>.bundle.idx to outputDir, guids without a cooked resource are skipped
+    // loose <guid>.rh/<guid>.bin files are left in place so resources outside the order still load
+    static bool Write(const skr::filesystem::path& outputDir, const char8_t* name, skr::span<const skr_guid_t> order,
+        uint32_t alignment = skr::resource::SResourceBundleIndex::kDefaultAlignment);
+};
+} // namespace asset
+} // namespace skd
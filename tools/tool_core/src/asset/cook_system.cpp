@@ -13,6 +13,7 @@
 
 #include "SkrToolCore/asset/cook_system.hpp"
 #include "SkrToolCore/asset/importer.hpp"
+#include "SkrToolCore/asset/import_cache.hpp"
 #include "SkrToolCore/project/project.hpp"
 
 #include <atomic>
@@ -56,6 +57,7 @@ struct SCookSystemImpl : public skd::asset::SCookSystem
     SAssetRecord* GetAssetRecord(const skr_guid_t& guid) override;
     SAssetRecord* ImportAsset(SProject* project, skr::filesystem::path path) override;
     skr_io_ram_service_t* getIOService() override;
+    SImportCache* GetImportCache() override { return importCache; }
 
     template <class F, class Iter>
     void ParallelFor(Iter begin, Iter end, size_t batch, F f)
@@ -86,6 +88,7 @@ protected:
     skr::flat_hash_map<skr_guid_t, SCooker*, skr::guid::hash> cookers;
     SMutex assetMutex;
     skr_io_ram_service_t* ioServices[ioServicesMaxCount];
+    SImportCache* importCache = nullptr;
 };
 }
 
@@ -97,6 +100,7 @@ struct TOOL_CORE_API SkrToolCoreModule : public skr::IDynamicModule
     {
         skr_init_mutex(&cook_system.ioMutex);
         skr_init_mutex(&cook_system.assetMutex);
+        cook_system.importCache = skd::asset::SImportCache::Create();
 
         auto jqDesc = make_zeroed<skr::JobQueueDesc>();
         jqDesc.thread_count = 1;
@@ -133,6 +137,8 @@ struct TOOL_CORE_API SkrToolCoreModule : public skr::IDynamicModule
                 skr_io_ram_service_t::destroy(ioService);
         }
 
+        skd::asset::SImportCache::Destroy(cook_system.importCache);
+        cook_system.importCache = nullptr;
         skr_destroy_mutex(&cook_system.assetMutex);
         for (auto& pair : cook_system.assets)
             SkrDelete(pair.second);
@@ -0,0 +1,237 @@
+#include "SkrRT/misc/log.hpp"
+#include "SkrRT/platform/thread.h"
+#include "SkrRT/containers/hashmap.hpp"
+#include "SkrRT/containers/vector.hpp"
+#include "SkrRT/async/fib_task.hpp"
+#include "SkrToolCore/asset/import_cache.hpp"
+
+#include <algorithm>
+
+#include "tracy/Tracy.hpp"
+
+namespace skd::asset
+{
+struct SImportCacheImpl : public SImportCache {
+    struct Entry {
+        skr::string key;
+        // stamp of the source when it was loaded
+        uint64_t sourceSize = 0;
+        int64_t sourceTime = 0;
+        void* data = nullptr;
+        uint64_t memorySize = 0;
+        FreeFunc free = nullptr;
+        uint32_t refs = 0;
+        uint64_t lastUse = 0;
+        // false once replaced by a newer version of the source or cleared, freed on its last release
+        bool cached = true;
+        // signaled by the loading task, other tasks asking for the same source wait on it
+        skr::task::event_t loaded;
+    };
+
+    SImportCacheImpl(uint64_t memoryBudget)
+        : memoryBudget(memoryBudget)
+    {
+    }
+
+    ~SImportCacheImpl() SKR_NOEXCEPT
+    {
+        SMutexLock lock(cacheMutex.mMutex);
+        // detached entries only live in datas, cached ones that failed to load only in entries
+        skr::vector<Entry*> alive;
+        for (auto& pair : datas)
+            alive.emplace_back(pair.second);
+        for (auto& pair : entries)
+        {
+            if (!pair.second->data)
+                alive.emplace_back(pair.second);
+        }
+        datas.clear();
+        entries.clear();
+        for (auto entry : alive)
+        {
+            if (entry->refs)
+                SKR_LOG_FMT_WARN(u8"[SImportCache] import {} is still referenced at shutdown!", entry->key);
+            if (entry->data && entry->free)
+                entry->free(entry->data);
+            SkrDelete(entry);
+        }
+    }
+
+    void* Acquire(skr_guid_t kind, const skr::filesystem::path& path, const LoadFunc& load, FreeFunc free) SKR_NOEXCEPT override
+    {
+        ZoneScopedN("ImportCache::Acquire");
+        // a missing source stamps as zero, its load fails and failures are not cached
+        std::error_code ec = {};
+        const auto fileSize = skr::filesystem::file_size(path, ec);
+        const uint64_t sourceSize = ec ? 0 : (uint64_t)fileSize;
+        const auto writeTime = skr::filesystem::last_write_time(path, ec);
+        const int64_t sourceTime = ec ? 0 : (int64_t)writeTime.time_since_epoch().count();
+        auto key = skr::format(u8"{}|{}", kind, path.u8string().c_str());
+        Entry* entry = nullptr;
+        bool owner = false;
+        {
+            SMutexLock lock(cacheMutex.mMutex);
+            auto it = entries.find(key);
+            if (it != entries.end() && (it->second->sourceSize != sourceSize || it->second->sourceTime != sourceTime))
+            {
+                // source changed since it was imported, later acquires get the new version
+                Detach(it->second);
+                entries.erase(it);
+                it = entries.end();
+            }
+            if (it != entries.end())
+            {
+                entry = it->second;
+            }
+            else
+            {
+                entry = SkrNew<Entry>();
+                entry->key = key;
+                entry->sourceSize = sourceSize;
+                entry->sourceTime = sourceTime;
+                entry->free = free;
+                entries.emplace(key, entry);
+                owner = true;
+            }
+            entry->refs++;
+            entry->lastUse = ++useClock;
+        }
+        if (owner)
+        {
+            ZoneScopedN("ImportCache::Load");
+            uint64_t memorySize = 0;
+            void* data = load(memorySize);
+            {
+                SMutexLock lock(cacheMutex.mMutex);
+                entry->data = data;
+                entry->memorySize = data ? memorySize : 0;
+                if (data)
+                {
+                    datas.emplace(data, entry);
+                    if (entry->cached)
+                        memoryUsage += entry->memorySize;
+                }
+                else if (entry->cached)
+                {
+                    // failures are not cached, the next acquire tries again
+                    entries.erase(entry->key);
+                    entry->cached = false;
+                }
+            }
+            entry->loaded.signal();
+        }
+        else
+        {
+            entry->loaded.wait(false);
+        }
+        SMutexLock lock(cacheMutex.mMutex);
+        void* data = entry->data;
+        if (!data)
+            ReleaseEntry(entry);
+        Trim();
+        return data;
+    }
+
+    void Release(void* data) SKR_NOEXCEPT override
+    {
+        if (!data) return;
+        SMutexLock lock(cacheMutex.mMutex);
+        auto it = datas.find(data);
+        if (it == datas.end())
+        {
+            SKR_LOG_ERROR(u8"[SImportCache::Release] releasing data that is not owned by the import cache!");
+            return;
+        }
+        ReleaseEntry(it->second);
+        Trim();
+    }
+
+    void SetMemoryBudget(uint64_t bytes) SKR_NOEXCEPT override
+    {
+        SMutexLock lock(cacheMutex.mMutex);
+        memoryBudget = bytes;
+        Trim();
+    }
+
+    uint64_t GetMemoryUsage() const SKR_NOEXCEPT override
+    {
+        SMutexLock lock(cacheMutex.mMutex);
+        return memoryUsage;
+    }
+
+    void Clear() SKR_NOEXCEPT override
+    {
+        SMutexLock lock(cacheMutex.mMutex);
+        for (auto& pair : entries)
+            Detach(pair.second);
+        entries.clear();
+    }
+
+protected:
+    // caller holds the lock
+    void ReleaseEntry(Entry* entry)
+    {
+        SKR_ASSERT(entry->refs > 0);
+        entry->refs--;
+        if (!entry->refs && !entry->cached)
+            FreeEntry(entry);
+    }
+
+    // drops the entry from the lookup, it dies with its last reference
+    void Detach(Entry* entry)
+    {
+        if (!entry->cached) return;
+        entry->cached = false;
+        memoryUsage -= entry->memorySize;
+        if (!entry->refs)
+            FreeEntry(entry);
+    }
+
+    void FreeEntry(Entry* entry)
+    {
+        if (entry->data)
+        {
+            datas.erase(entry->data);
+            if (entry->free)
+                entry->free(entry->data);
+        }
+        SkrDelete(entry);
+    }
+
+    // evicts unreferenced entries, least recently used first
+    void Trim()
+    {
+        if (memoryUsage <= memoryBudget) return;
+        skr::vector<Entry*> candidates;
+        for (auto& pair : entries)
+        {
+            if (!pair.second->refs && pair.second->data)
+                candidates.emplace_back(pair.second);
+        }
+        std::sort(candidates.begin(), candidates.end(), [](Entry* a, Entry* b) { return a->lastUse < b->lastUse; });
+        for (auto entry : candidates)
+        {
+            if (memoryUsage <= memoryBudget) break;
+            entries.erase(entry->key);
+            Detach(entry);
+        }
+    }
+
+    mutable SMutexObject cacheMutex;
+    skr::flat_hash_map<skr::string, Entry*, skr::hash<skr::string>> entries;
+    skr::flat_hash_map<void*, Entry*> datas;
+    uint64_t memoryBudget = kDefaultMemoryBudget;
+    uint64_t memoryUsage = 0;
+    uint64_t useClock = 0;
+};
+
+SImportCache* SImportCache::Create(uint64_t memoryBudget)
+{
+    return SkrNew<SImportCacheImpl>(memoryBudget);
+}
+
+void SImportCache::Destroy(SImportCache* cache)
+{
+    SkrDelete(cache);
+}
+} // namespace skd::asset
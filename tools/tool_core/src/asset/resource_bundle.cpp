@@ -0,0 +1,188 @@
+#include "SkrRT/platform/vfs.h"
+#include "SkrRT/misc/log.hpp"
+#include "SkrRT/misc/defer.hpp"
+#include "SkrRT/containers/hashmap.hpp"
+#include "SkrRT/serde/binary/reader.h"
+#include "SkrRT/resource/resource_header.hpp"
+#include "SkrRT/io/io_trace.hpp"
+#include "SkrToolCore/asset/resource_bundle.hpp"
+
+#include <EASTL/vector.h>
+#include <EASTL/algorithm.h>
+#include <stdio.h>
+
+#include "tracy/Tracy.hpp"
+
+namespace skd::asset
+{
+namespace
+{
+bool ReadCookedFile(const skr::filesystem::path& path, skr::vector<uint8_t>& outContent)
+{
+    auto file = fopen(path.string().c_str(), "rb");
+    if (!file)
+        return false;
+    SKR_DEFER({ fclose(file); });
+    fseek(file, 0, SEEK_END);
+    const auto size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    outContent.resize(size > 0 ? (size_t)size : 0);
+    return fread(outContent.data(), 1, outContent.size(), file) == outContent.size();
+}
+
+bool ReadCookedHeader(const skr::filesystem::path& outputDir, skr_guid_t guid, skr_resource_header_t& outHeader)
+{
+    skr::vector<uint8_t> content;
+    if (!ReadCookedFile(outputDir / skr::format(u8"{}.rh", guid).c_str(), content))
+        return false;
+    skr::binary::SpanReader reader = { { content.data(), content.size() }, 0 };
+    skr_binary_reader_t archive{reader};
+    return skr::binary::Read(&archive, outHeader) == 0;
+}
+
+void AppendOrder(skr::flat_hash_set<skr_guid_t, skr::guid::hash>& visited, skr::vector<skr_guid_t>& order, skr_guid_t guid)
+{
+    if (visited.insert(guid).second)
+        order.push_back(guid);
+}
+} // namespace
+
+bool SResourceBundleBuilder::LoadTraceOrder(const skr::filesystem::path& tracePath, skr::vector<skr_guid_t>& outOrder)
+{
+    ZoneScopedN("LoadTraceOrder");
+    skr_vfs_desc_t abs_fs_desc = {};
+    abs_fs_desc.app_name = u8"resource-bundle";
+    abs_fs_desc.mount_type = SKR_MOUNT_TYPE_ABSOLUTE;
+    auto abs_fs = skr_create_vfs(&abs_fs_desc);
+    SKR_DEFER({ skr_free_vfs(abs_fs); });
+
+    skr::vector<skr::io::IOTraceRecord> records;
+    if (!skr::io::IOTrace::Load(abs_fs, tracePath.u8string().c_str(), records))
+        return false;
+    // records are sorted by enqueue time, the header read of a resource comes before its data read
+    skr::flat_hash_set<skr_guid_t, skr::guid::hash> visited;
+    for (const auto& record : records)
+    {
+        const skr::filesystem::path path = record.path.u8_str();
+        const auto extension = path.extension();
+        if (extension != ".bin" && extension != ".rh")
+            continue;
+        const auto stem = path.stem().u8string();
+        skr_guid_t guid;
+        if (skr::guid::make_guid({ stem.c_str(), stem.size() }, guid))
+            AppendOrder(visited, outOrder, guid);
+    }
+    return true;
+}
+
+bool SResourceBundleBuilder::LoadDependencyOrder(const skr::filesystem::path& rootsPath, const skr::filesystem::path& outputDir, skr::vector<skr_guid_t>& outOrder)
+{
+    ZoneScopedN("LoadDependencyOrder");
+    skr::vector<uint8_t> content;
+    if (!ReadCookedFile(rootsPath, content))
+    {
+        SKR_LOG_FMT_ERROR(u8"[SResourceBundleBuilder] failed to read root list {}!", rootsPath.u8string().c_str());
+        return false;
+    }
+    skr::vector<skr_guid_t> roots;
+    const auto text = (const char8_t*)content.data();
+    for (size_t begin = 0; begin < content.size();)
+    {
+        size_t end = begin;
+        while (end < content.size() && text[end] != u8'\n')
+            ++end;
+        size_t last = end;
+        while (last > begin && (text[last - 1] == u8'\r' || text[last - 1] == u8' ' || text[last - 1] == u8'\t'))
+            --last;
+        skr_guid_t guid;
+        if (last > begin && text[begin] != u8'#')
+        {
+            if (skr::guid::make_guid({ text + begin, last - begin }, guid))
+                roots.push_back(guid);
+            else
+                SKR_LOG_FMT_WARN(u8"[SResourceBundleBuilder] skipping invalid guid in {}!", rootsPath.u8string().c_str());
+        }
+        begin = end + 1;
+    }
+
+    skr::flat_hash_set<skr_guid_t, skr::guid::hash> visited;
+    skr::vector<skr_guid_t> stack;
+    for (auto root : roots)
+    {
+        stack.push_back(root);
+        while (!stack.empty())
+        {
+            const auto guid = stack.back();
+            stack.pop_back();
+            if (visited.contains(guid))
+                continue;
+            AppendOrder(visited, outOrder, guid);
+            skr_resource_header_t header;
+            if (!ReadCookedHeader(outputDir, guid, header))
+                continue;
+            // pushed in reverse so the first dependency is visited first
+            for (auto dep = header.dependencies.rbegin(); dep != header.dependencies.rend(); ++dep)
+                stack.push_back(dep->get_serialized());
+        }
+    }
+    return true;
+}
+
+bool SResourceBundleBuilder::Write(const skr::filesystem::path& outputDir, const char8_t* name, skr::span<const skr_guid_t> order, uint32_t alignment)
+{
+    ZoneScopedN("WriteResourceBundle");
+    SKR_ASSERT(alignment && (alignment & (alignment - 1)) == 0);
+    const auto bundleName = skr::format(u8"{}.bundle", name);
+    const auto indexName = skr::format(u8"{}.bundle.idx", name);
+    auto bundleFile = fopen((outputDir / bundleName.c_str()).string().c_str(), "wb");
+    if (!bundleFile)
+    {
+        SKR_LOG_FMT_ERROR(u8"[SResourceBundleBuilder] failed to create bundle {}!", bundleName);
+        return false;
+    }
+
+    skr::resource::SResourceBundleIndex index;
+    index.bundle_uri = bundleName;
+    index.alignment = alignment;
+    {
+        SKR_DEFER({ fclose(bundleFile); });
+        uint64_t offset = 0;
+        skr::vector<uint8_t> content, zeros;
+        for (auto guid : order)
+        {
+            auto& entry = index.entries.emplace_back();
+            if (!ReadCookedHeader(outputDir, guid, entry.header) ||
+                !ReadCookedFile(outputDir / skr::format(u8"{}.bin", guid).c_str(), content))
+            {
+                SKR_LOG_FMT_WARN(u8"[SResourceBundleBuilder] resource {} is not cooked, left out of bundle {}!", guid, bundleName);
+                index.entries.pop_back();
+                continue;
+            }
+            const auto padding = ((offset + alignment - 1) & ~(uint64_t)(alignment - 1)) - offset;
+            zeros.resize(eastl::max<uint64_t>(zeros.size(), padding));
+            offset += padding;
+            entry.offset = offset;
+            entry.size = content.size();
+            if (fwrite(zeros.data(), 1, padding, bundleFile) != padding ||
+                fwrite(content.data(), 1, content.size(), bundleFile) != content.size())
+            {
+                SKR_LOG_FMT_ERROR(u8"[SResourceBundleBuilder] failed to write bundle {}!", bundleName);
+                return false;
+            }
+            offset += content.size();
+        }
+        SKR_LOG_FMT_INFO(u8"[SResourceBundleBuilder] bundle {} written, {} resources, {} bytes.", bundleName, index.entries.size(), offset);
+    }
+
+    eastl::vector<uint8_t> buffer;
+    index.Write(buffer);
+    auto indexFile = fopen((outputDir / indexName.c_str()).string().c_str(), "wb");
+    if (!indexFile)
+    {
+        SKR_LOG_FMT_ERROR(u8"[SResourceBundleBuilder] failed to create bundle index {}!", indexName);
+        return false;
+    }
+    SKR_DEFER({ fclose(indexFile); });
+    return fwrite(buffer.data(), 1, buffer.size(), indexFile) == buffer.size();
+}
+} // namespace skd::asset